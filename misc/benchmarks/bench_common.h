@@ -0,0 +1,60 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace bench
+{
+	// Prevents the compiler from removing the computation of the value
+	template <typename T>
+	inline void DoNotOptimize(const T &value)
+	{
+		asm volatile("" : : "r"(&value) : "memory");
+	}
+
+	// The number of iterations is the first argument of the bench (or default_iterations)
+	inline size_t GetIterations(int argc, char *argv[], size_t default_iterations)
+	{
+		if (argc > 1)
+		{
+			auto iterations = std::strtoull(argv[1], nullptr, 10);
+
+			if (iterations > 0)
+			{
+				return iterations;
+			}
+		}
+
+		return default_iterations;
+	}
+
+	// Returns the average duration of the function in nanoseconds.
+	// The function is called (iterations / 10) times before the measurement to warm up the caches.
+	template <typename Tfunction>
+	inline double Measure(size_t iterations, Tfunction function)
+	{
+		for (size_t index = 0; index < (iterations / 10); index++)
+		{
+			function();
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (size_t index = 0; index < iterations; index++)
+		{
+			function();
+		}
+
+		auto elapsed = std::chrono::steady_clock::now() - start;
+
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / iterations;
+	}
+}  // namespace bench
@@ -0,0 +1,187 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+// Measures the XOR of the ULPFEC payloads and the FEC generation of a frame.
+//
+// - XOR of one payload (100/500/1200 bytes) with the byte loop (the previous implementation) and
+//   each kernel of FecXorKernel that the CPU supports
+// - UlpfecGenerator::Encode() of a frame for each scheme and rate
+#include <modules/rtp_rtcp/ulpfec_generator.h>
+
+#include <vector>
+
+#include "bench_common.h"
+
+// The kernels are in the anonymous namespace of fec_xor_kernel.cpp, so it is compiled here
+// (fec_xor_kernel.o is not linked to this bench)
+#include <modules/rtp_rtcp/fec_xor_kernel.cpp>
+
+#define FEC_BENCH_RED_PAYLOAD_TYPE 120
+#define FEC_BENCH_ULPFEC_PAYLOAD_TYPE 121
+#define FEC_BENCH_MEDIA_PAYLOAD_TYPE 100
+// The size of the payload of the media packets of a frame
+#define FEC_BENCH_PAYLOAD_SIZE 1200
+
+namespace
+{
+	// The XOR of UlpfecGenerator before FecXorKernel was added
+	__attribute__((noinline)) void XorByteLoop(uint8_t *dst, const uint8_t *src, size_t length)
+	{
+		for (size_t index = 0; index < length; index++)
+		{
+			dst[index] ^= src[index];
+		}
+	}
+
+	std::vector<Kernel> GetSupportedKernels()
+	{
+		std::vector<Kernel> kernels{{XorByteLoop, "byte loop"}, {XorScalar, "scalar"}};
+
+#if FEC_XOR_KERNEL_X86
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("sse2"))
+		{
+			kernels.push_back({XorSse2, "sse2"});
+		}
+
+		if (__builtin_cpu_supports("avx2"))
+		{
+			kernels.push_back({XorAvx2, "avx2"});
+		}
+#elif FEC_XOR_KERNEL_NEON
+		kernels.push_back({XorNeon, "neon"});
+#endif
+
+		return kernels;
+	}
+
+	void RunXor(size_t iterations)
+	{
+		::printf("XOR of one payload (selected kernel: %s)\n", FecXorKernel::GetName());
+
+		for (size_t length : {100, 500, 1200})
+		{
+			std::vector<uint8_t> dst(length);
+			std::vector<uint8_t> src(length);
+
+			for (size_t index = 0; index < length; index++)
+			{
+				src[index] = static_cast<uint8_t>(index * 31 + 7);
+			}
+
+			::printf("  %4zu bytes:", length);
+
+			for (const auto &kernel : GetSupportedKernels())
+			{
+				auto ns = bench::Measure(iterations, [&]() {
+					kernel.function(dst.data(), src.data(), length);
+					bench::DoNotOptimize(dst);
+				});
+
+				::printf("  %s %.1f ns", kernel.name, ns);
+			}
+
+			::printf("\n");
+		}
+	}
+
+	// The media packets of a frame in the RED format, as RtpPacketizer gives them to UlpfecGenerator
+	std::vector<std::shared_ptr<RedRtpPacket>> CreateFrame(size_t packet_count)
+	{
+		std::vector<std::shared_ptr<RedRtpPacket>> frame;
+
+		for (size_t index = 0; index < packet_count; index++)
+		{
+			RtpPacket rtp_packet;
+
+			rtp_packet.SetPayloadType(FEC_BENCH_MEDIA_PAYLOAD_TYPE);
+			rtp_packet.SetSsrc(0x12345678);
+			rtp_packet.SetSequenceNumber(static_cast<uint16_t>(index));
+			rtp_packet.SetTimestamp(90000);
+			rtp_packet.SetMarker(index == (packet_count - 1));
+
+			auto payload = rtp_packet.AllocatePayload(FEC_BENCH_PAYLOAD_SIZE);
+			for (size_t offset = 0; offset < FEC_BENCH_PAYLOAD_SIZE; offset++)
+			{
+				payload[offset] = static_cast<uint8_t>(index + offset);
+			}
+
+			frame.push_back(std::make_shared<RedRtpPacket>(FEC_BENCH_RED_PAYLOAD_TYPE, rtp_packet));
+		}
+
+		return frame;
+	}
+
+	void RunEncode(size_t iterations)
+	{
+		struct Scheme
+		{
+			WebRtcFecScheme scheme;
+			const char *name;
+		};
+
+		const Scheme schemes[] = {
+			{WebRtcFecScheme::Consecutive, "Consecutive"},
+			{WebRtcFecScheme::Interleaved, "Interleaved"},
+			{WebRtcFecScheme::TwoDimensional, "TwoDimensional"},
+		};
+
+		for (size_t packet_count : {10, 40})
+		{
+			auto frame = CreateFrame(packet_count);
+
+			::printf("Encode() of a frame of %zu packets (%d bytes each)\n", packet_count, FEC_BENCH_PAYLOAD_SIZE);
+
+			for (const auto &scheme : schemes)
+			{
+				::printf("  %-14s", scheme.name);
+
+				for (int rate : {ULPFEC_DEFAULT_PROTECTION_RATE, 25, 50})
+				{
+					UlpfecGenerator generator;
+					generator.SetProtection(scheme.scheme, rate);
+
+					RedRtpPacket fec_packet;
+					fec_packet.SetPayloadType(FEC_BENCH_ULPFEC_PAYLOAD_TYPE);
+					fec_packet.SetUlpfec(true, FEC_BENCH_MEDIA_PAYLOAD_TYPE);
+					fec_packet.PackageAsRed(FEC_BENCH_RED_PAYLOAD_TYPE);
+
+					size_t fec_packet_count = 0;
+
+					auto ns = bench::Measure(iterations, [&]() {
+						// The FEC packets are generated when the last packet (marker) is added
+						for (const auto &packet : frame)
+						{
+							generator.AddRtpPacketAndGenerateFec(packet);
+						}
+
+						fec_packet_count = 0;
+						while (generator.NextPacket(&fec_packet))
+						{
+							fec_packet_count++;
+						}
+					});
+
+					::printf("  rate %2d: %8.1f us (%zu FEC)", rate, ns / 1000.0, fec_packet_count);
+				}
+
+				::printf("\n");
+			}
+		}
+	}
+}  // namespace
+
+int main(int argc, char *argv[])
+{
+	auto iterations = bench::GetIterations(argc, argv, 1000000);
+
+	RunXor(iterations);
+	RunEncode(std::max<size_t>(iterations / 1000, 1));
+
+	return 0;
+}
@@ -0,0 +1,236 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+// Encodes and decodes the header sets of RFC 7541 Appendix C.4 (requests) and C.6 (responses).
+//
+// A connection is simulated by encoding/decoding the 3 header blocks of a set in order with the same
+// encoder/decoder, and a new encoder/decoder is used for each iteration (the dynamic table is empty).
+// The decoder is also checked against the header blocks in the RFC.
+#include <modules/http/hpack/decoder.h>
+#include <modules/http/hpack/encoder.h>
+
+#include "bench_common.h"
+
+using HeaderField = http::hpack::HeaderField;
+using HeaderBlock = std::vector<HeaderField>;
+
+namespace
+{
+	struct HeaderSet
+	{
+		const char *name;
+		// The size of the dynamic table (4096: the default)
+		size_t table_size;
+		std::vector<HeaderBlock> blocks;
+		// The header blocks in the RFC
+		std::vector<std::vector<uint8_t>> encoded_blocks;
+	};
+
+	// https://www.rfc-editor.org/rfc/rfc7541.html#appendix-C.4
+	HeaderSet GetRequestSet()
+	{
+		return {
+			"C.4 requests",
+			4096,
+			{
+				{
+					{":method", "GET"},
+					{":scheme", "http"},
+					{":path", "/"},
+					{":authority", "www.example.com"},
+				},
+				{
+					{":method", "GET"},
+					{":scheme", "http"},
+					{":path", "/"},
+					{":authority", "www.example.com"},
+					{"cache-control", "no-cache"},
+				},
+				{
+					{":method", "GET"},
+					{":scheme", "https"},
+					{":path", "/index.html"},
+					{":authority", "www.example.com"},
+					{"custom-key", "custom-value"},
+				},
+			},
+			{
+				{0x82, 0x86, 0x84, 0x41, 0x8c, 0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff},
+				{0x82, 0x86, 0x84, 0xbe, 0x58, 0x86, 0xa8, 0xeb, 0x10, 0x64, 0x9c, 0xbf},
+				{0x82, 0x87, 0x85, 0xbf, 0x40, 0x88, 0x25, 0xa8, 0x49, 0xe9, 0x5b, 0xa9, 0x7d, 0x7f, 0x89, 0x25,
+				 0xa8, 0x49, 0xe9, 0x5b, 0xb8, 0xe8, 0xb4, 0xbf},
+			}};
+	}
+
+	// https://www.rfc-editor.org/rfc/rfc7541.html#appendix-C.6
+	HeaderSet GetResponseSet()
+	{
+		return {
+			"C.6 responses",
+			256,
+			{
+				{
+					{":status", "302"},
+					{"cache-control", "private"},
+					{"date", "Mon, 21 Oct 2013 20:13:21 GMT"},
+					{"location", "https://www.example.com"},
+				},
+				{
+					{":status", "307"},
+					{"cache-control", "private"},
+					{"date", "Mon, 21 Oct 2013 20:13:21 GMT"},
+					{"location", "https://www.example.com"},
+				},
+				{
+					{":status", "200"},
+					{"cache-control", "private"},
+					{"date", "Mon, 21 Oct 2013 20:13:22 GMT"},
+					{"location", "https://www.example.com"},
+					{"content-encoding", "gzip"},
+					{"set-cookie", "foo=ASDJKHQKBZXOQWEOPIUAXQWEOIU; max-age=3600; version=1"},
+				},
+			},
+			{
+				// The RFC assumes that the size of the dynamic table is 256 bytes,
+				// so the first block starts with a dynamic table size update (3f e1 01)
+				{0x3f, 0xe1, 0x01,
+				 0x48, 0x82, 0x64, 0x02, 0x58, 0x85, 0xae, 0xc3, 0x77, 0x1a, 0x4b, 0x61, 0x96, 0xd0, 0x7a, 0xbe,
+				 0x94, 0x10, 0x54, 0xd4, 0x44, 0xa8, 0x20, 0x05, 0x95, 0x04, 0x0b, 0x81, 0x66, 0xe0, 0x82, 0xa6,
+				 0x2d, 0x1b, 0xff, 0x6e, 0x91, 0x9d, 0x29, 0xad, 0x17, 0x18, 0x63, 0xc7, 0x8f, 0x0b, 0x97, 0xc8,
+				 0xe9, 0xae, 0x82, 0xae, 0x43, 0xd3},
+				{0x48, 0x83, 0x64, 0x0e, 0xff, 0xc1, 0xc0, 0xbf},
+				{0x88, 0xc1, 0x61, 0x96, 0xd0, 0x7a, 0xbe, 0x94, 0x10, 0x54, 0xd4, 0x44, 0xa8, 0x20, 0x05, 0x95,
+				 0x04, 0x0b, 0x81, 0x66, 0xe0, 0x84, 0xa6, 0x2d, 0x1b, 0xff, 0xc0, 0x5a, 0x83, 0x9b, 0xd9, 0xab,
+				 0x77, 0xad, 0x94, 0xe7, 0x82, 0x1d, 0xd7, 0xf2, 0xe6, 0xc7, 0xb3, 0x35, 0xdf, 0xdf, 0xcd, 0x5b,
+				 0x39, 0x60, 0xd5, 0xaf, 0x27, 0x08, 0x7f, 0x36, 0x72, 0xc1, 0xab, 0x27, 0x0f, 0xb5, 0x29, 0x1f,
+				 0x95, 0x87, 0x31, 0x60, 0x65, 0xc0, 0x03, 0xed, 0x4e, 0xe5, 0xb1, 0x06, 0x3d, 0x50, 0x07},
+			}};
+	}
+
+	bool IsSame(const HeaderBlock &expected, const HeaderBlock &actual)
+	{
+		if (expected.size() != actual.size())
+		{
+			return false;
+		}
+
+		for (size_t index = 0; index < expected.size(); index++)
+		{
+			if ((expected[index].GetName() != actual[index].GetName()) ||
+				(expected[index].GetValue() != actual[index].GetValue()))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	std::vector<std::shared_ptr<const ov::Data>> EncodeSet(const HeaderSet &header_set)
+	{
+		http::hpack::Encoder encoder;
+		std::vector<std::shared_ptr<const ov::Data>> encoded_blocks;
+
+		if (header_set.table_size != 4096)
+		{
+			encoder.UpdateDynamicTableSize(header_set.table_size);
+		}
+
+		for (const auto &block : header_set.blocks)
+		{
+			auto data = std::make_shared<ov::Data>();
+			ov::ByteStream stream(data.get());
+
+			if (encoder.Encode(stream, block) == false)
+			{
+				return {};
+			}
+
+			encoded_blocks.push_back(data);
+		}
+
+		return encoded_blocks;
+	}
+
+	bool DecodeSet(const HeaderSet &header_set, const std::vector<std::shared_ptr<const ov::Data>> &encoded_blocks)
+	{
+		http::hpack::Decoder decoder;
+
+		for (size_t index = 0; index < encoded_blocks.size(); index++)
+		{
+			HeaderBlock block;
+
+			if ((decoder.Decode(encoded_blocks[index], block) == false) || (IsSame(header_set.blocks[index], block) == false))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool Run(const HeaderSet &header_set, size_t iterations)
+	{
+		std::vector<std::shared_ptr<const ov::Data>> rfc_blocks;
+		size_t rfc_bytes = 0;
+
+		for (const auto &encoded_block : header_set.encoded_blocks)
+		{
+			rfc_blocks.push_back(std::make_shared<ov::Data>(encoded_block.data(), encoded_block.size()));
+			rfc_bytes += encoded_block.size();
+		}
+
+		// Validation
+		if (DecodeSet(header_set, rfc_blocks) == false)
+		{
+			::printf("%s: could not decode the header blocks of the RFC\n", header_set.name);
+			return false;
+		}
+
+		auto encoded_blocks = EncodeSet(header_set);
+		if ((encoded_blocks.empty()) || (DecodeSet(header_set, encoded_blocks) == false))
+		{
+			::printf("%s: the encoded header blocks could not be decoded to the same headers\n", header_set.name);
+			return false;
+		}
+
+		size_t encoded_bytes = 0;
+		for (const auto &encoded_block : encoded_blocks)
+		{
+			encoded_bytes += encoded_block->GetLength();
+		}
+
+		auto block_count = header_set.blocks.size();
+
+		auto encode_ns = bench::Measure(iterations, [&]() {
+			bench::DoNotOptimize(EncodeSet(header_set));
+		});
+
+		auto decode_ns = bench::Measure(iterations, [&]() {
+			bench::DoNotOptimize(DecodeSet(header_set, rfc_blocks));
+		});
+
+		::printf("%-14s encode: %8.1f ns/block (%zu bytes), decode: %8.1f ns/block (%zu bytes in the RFC)\n",
+				 header_set.name,
+				 encode_ns / block_count, encoded_bytes,
+				 decode_ns / block_count, rfc_bytes);
+
+		return true;
+	}
+}  // namespace
+
+int main(int argc, char *argv[])
+{
+	auto iterations = bench::GetIterations(argc, argv, 100000);
+
+	bool result = true;
+
+	result = Run(GetRequestSet(), iterations) && result;
+	result = Run(GetResponseSet(), iterations) && result;
+
+	return result ? 0 : 1;
+}
@@ -73,16 +73,27 @@ namespace api
 		SetResponse(http::StatusCode::InternalServerError, error->what());
 	}
 
+	ApiResponse::ApiResponse(http::StatusCode status_code, const ov::String &content_type, const std::shared_ptr<const ov::String> &body)
+		: _status_code(status_code),
+		  _content_type(content_type),
+		  _body(body)
+	{
+	}
+
 	ApiResponse::ApiResponse(const ApiResponse &response)
 	{
-		_status_code = response._status_code;
-		_json		 = response._json;
+		_status_code  = response._status_code;
+		_json		  = response._json;
+		_content_type = response._content_type;
+		_body		  = response._body;
 	}
 
 	ApiResponse::ApiResponse(ApiResponse &&response)
 	{
-		_status_code = std::move(response._status_code);
-		_json		 = std::move(response._json);
+		_status_code  = std::move(response._status_code);
+		_json		  = std::move(response._json);
+		_content_type = std::move(response._content_type);
+		_body		  = std::move(response._body);
 	}
 
 	void ApiResponse::SetResponse(http::StatusCode status_code)
@@ -110,6 +121,14 @@ namespace api
 		const auto &response = client->GetResponse();
 
 		response->SetStatusCode(_status_code);
+
+		if (_body != nullptr)
+		{
+			response->SetHeader("Content-Type", _content_type);
+
+			return response->AppendString(*_body);
+		}
+
 		response->SetHeader("Content-Type", "application/json;charset=UTF-8");
 
 		return (_json.isNull() == false) ? response->AppendString(ov::Json::Stringify(_json)) : true;
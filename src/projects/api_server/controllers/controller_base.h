@@ -61,6 +61,9 @@ namespace api
 		// }
 		ApiResponse(const std::exception *error);
 
+		// <body> (not JSON, e.g. the Prometheus exposition)
+		ApiResponse(http::StatusCode status_code, const ov::String &content_type, const std::shared_ptr<const ov::String> &body);
+
 		// Copy ctor
 		ApiResponse(const ApiResponse &response);
 		// Move ctor
@@ -95,6 +98,10 @@ namespace api
 		http::StatusCode _status_code = http::StatusCode::OK;
 		Json::Value _json			  = Json::Value::null;
 
+		// If it is set, it is sent instead of the _json
+		ov::String _content_type;
+		std::shared_ptr<const ov::String> _body;
+
 		bool _is_deferred			  = false;
 	};
 
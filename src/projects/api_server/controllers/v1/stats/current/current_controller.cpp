@@ -20,6 +20,7 @@ namespace api
 			void CurrentController::PrepareHandlers()
 			{
 				RegisterGet(R"()", &CurrentController::OnGetServerMetrics);
+				RegisterGet(R"(\/prometheus)", &CurrentController::OnGetPrometheusMetrics);
 
 				CreateSubController<VHostsController>(R"(\/vhosts)");
 				CreateSubController<InternalsController>(R"(\/internals)");
@@ -30,6 +31,12 @@ namespace api
 				auto serverMetric = MonitorInstance->GetServerMetrics();
 				return ::serdes::JsonFromMetrics(serverMetric);
 			}
+
+			ApiResponse CurrentController::OnGetPrometheusMetrics(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				// The snapshot is rendered by the monitoring periodically
+				return ApiResponse(http::StatusCode::OK, PROMETHEUS_CONTENT_TYPE, MonitorInstance->GetPrometheusSnapshot());
+			}
 		}  // namespace stats
 	}  // namespace v1
 }  // namespace api
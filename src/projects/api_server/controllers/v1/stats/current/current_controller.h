@@ -22,6 +22,8 @@ namespace api
 				void PrepareHandlers() override;
 
 				ApiResponse OnGetServerMetrics(const std::shared_ptr<http::svr::HttpExchange> &client);
+				// Prometheus text exposition format
+				ApiResponse OnGetPrometheusMetrics(const std::shared_ptr<http::svr::HttpExchange> &client);
 			};
 		}  // namespace stats
 	}  // namespace v1
@@ -26,7 +26,7 @@ namespace api
 			ApiResponse VHostsController::OnGetVhost(const std::shared_ptr<http::svr::HttpExchange> &client,
 													 const std::shared_ptr<mon::HostMetrics> &vhost)
 			{
-				return ::serdes::JsonFromMetrics(vhost);
+				return ::serdes::JsonFromHostMetrics(vhost);
 			}
 		}  // namespace stats
 	}  // namespace v1
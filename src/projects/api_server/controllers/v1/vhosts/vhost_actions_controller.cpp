@@ -24,6 +24,13 @@ namespace api
 			RegisterGet(R"()", &VHostActionsController::OnGetDummyAction);
 			RegisterPost(R"((reloadAllCertificates))", &VHostActionsController::OnPostReloadAllCertificates);
 			RegisterPost(R"((reloadCertificate))", &VHostActionsController::OnPostReloadCertificate);
+
+			//----------------------------------------
+			// Prewarm related actions
+			//----------------------------------------
+			RegisterGet(R"((prewarm))", &VHostActionsController::OnGetPrewarm);
+			RegisterPost(R"((startPrewarm))", &VHostActionsController::OnPostStartPrewarm);
+			RegisterPost(R"((stopPrewarm))", &VHostActionsController::OnPostStopPrewarm);
 		};
 
 		// GET /v1/vhosts:reloadCertificates
@@ -61,6 +68,100 @@ namespace api
 			return {http_code};
 		}
 
+		// GET /v1/vhosts/<vhost_name>:prewarm
+		ApiResponse VHostActionsController::OnGetPrewarm(const std::shared_ptr<http::svr::HttpExchange> &client,
+														 const std::shared_ptr<mon::HostMetrics> &vhost)
+		{
+			auto status = ocst::Orchestrator::GetInstance()->GetStreamPrewarmer().GetStatus(vhost->GetName());
+
+			Json::Value response;
+			Json::Value &streams = response["streams"];
+			streams = Json::arrayValue;
+
+			for (const auto &item : status.stream_list)
+			{
+				Json::Value stream;
+
+				stream["app"] = item.vhost_app_name.GetAppName().CStr();
+				stream["stream"] = item.stream_name.CStr();
+				stream["source"] = ocst::StreamPrewarmer::StringFromSource(item.source);
+				stream["pulled"] = item.is_pulled;
+				stream["viewers"] = item.viewers;
+				stream["popularity"] = item.popularity;
+
+				streams.append(stream);
+			}
+
+			auto total_count = status.hit_count + status.miss_count;
+
+			response["hitCount"] = static_cast<Json::UInt64>(status.hit_count);
+			response["missCount"] = static_cast<Json::UInt64>(status.miss_count);
+			response["hitRate"] = (total_count > 0) ? (static_cast<double>(status.hit_count) / total_count) : 0.0;
+
+			return response;
+		}
+
+		std::vector<std::pair<info::VHostAppName, ov::String>> VHostActionsController::ParsePrewarmStreams(const Json::Value &request_body,
+																										   const std::shared_ptr<mon::HostMetrics> &vhost)
+		{
+			auto &streams = request_body["streams"];
+			if (streams.isArray() == false)
+			{
+				throw http::HttpError(http::StatusCode::BadRequest, "streams must be an array: [%s]", vhost->GetName().CStr());
+			}
+
+			auto orchestrator = ocst::Orchestrator::GetInstance();
+			std::vector<std::pair<info::VHostAppName, ov::String>> stream_list;
+
+			for (const auto &stream : streams)
+			{
+				auto tokens = stream.isString() ? ov::String(stream.asCString()).Split("/") : std::vector<ov::String>();
+				if ((tokens.size() != 2) || tokens[0].IsEmpty() || tokens[1].IsEmpty())
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "Each stream must be in the form of <app>/<stream>: [%s]", vhost->GetName().CStr());
+				}
+
+				stream_list.emplace_back(orchestrator->ResolveApplicationName(vhost->GetName(), tokens[0]), tokens[1]);
+			}
+
+			return stream_list;
+		}
+
+		// POST v1/vhosts/<vhost_name>:startPrewarm
+		ApiResponse VHostActionsController::OnPostStartPrewarm(const std::shared_ptr<http::svr::HttpExchange> &client,
+															   const Json::Value &request_body,
+															   const std::shared_ptr<mon::HostMetrics> &vhost)
+		{
+			auto &prewarmer = ocst::Orchestrator::GetInstance()->GetStreamPrewarmer();
+
+			for (const auto &[vhost_app_name, stream_name] : ParsePrewarmStreams(request_body, vhost))
+			{
+				prewarmer.AddStream(vhost_app_name, stream_name);
+			}
+
+			return {http::StatusCode::OK};
+		}
+
+		// POST v1/vhosts/<vhost_name>:stopPrewarm
+		ApiResponse VHostActionsController::OnPostStopPrewarm(const std::shared_ptr<http::svr::HttpExchange> &client,
+															  const Json::Value &request_body,
+															  const std::shared_ptr<mon::HostMetrics> &vhost)
+		{
+			auto &prewarmer = ocst::Orchestrator::GetInstance()->GetStreamPrewarmer();
+
+			for (const auto &[vhost_app_name, stream_name] : ParsePrewarmStreams(request_body, vhost))
+			{
+				if (prewarmer.RemoveStream(vhost_app_name, stream_name) == false)
+				{
+					throw http::HttpError(http::StatusCode::NotFound,
+										  "Could not find prewarm stream: [%s/%s]",
+										  vhost_app_name.CStr(), stream_name.CStr());
+				}
+			}
+
+			return {http::StatusCode::OK};
+		}
+
 		ApiResponse VHostActionsController::OnGetDummyAction(const std::shared_ptr<http::svr::HttpExchange> &client,
 															 const std::shared_ptr<mon::HostMetrics> &vhost)
 		{
@@ -29,9 +29,28 @@ namespace api
 												const Json::Value &request_body,
 												const std::shared_ptr<mon::HostMetrics> &vhost);
 
+			// GET /v1/vhosts/<vhost_name>:prewarm
+			ApiResponse OnGetPrewarm(const std::shared_ptr<http::svr::HttpExchange> &client,
+									 const std::shared_ptr<mon::HostMetrics> &vhost);
+
+			// POST v1/vhosts/<vhost_name>:startPrewarm
+			ApiResponse OnPostStartPrewarm(const std::shared_ptr<http::svr::HttpExchange> &client,
+										   const Json::Value &request_body,
+										   const std::shared_ptr<mon::HostMetrics> &vhost);
+
+			// POST v1/vhosts/<vhost_name>:stopPrewarm
+			ApiResponse OnPostStopPrewarm(const std::shared_ptr<http::svr::HttpExchange> &client,
+										  const Json::Value &request_body,
+										  const std::shared_ptr<mon::HostMetrics> &vhost);
+
 			// GET /v1/vhosts/<vhost_name>:<action>
 			ApiResponse OnGetDummyAction(const std::shared_ptr<http::svr::HttpExchange> &client,
 										 const std::shared_ptr<mon::HostMetrics> &vhost);
+
+		private:
+			// Parse {"streams": ["<app>/<stream>", ...]}
+			std::vector<std::pair<info::VHostAppName, ov::String>> ParsePrewarmStreams(const Json::Value &request_body,
+																					   const std::shared_ptr<mon::HostMetrics> &vhost);
 		};
 	}  // namespace v1
 }  // namespace api
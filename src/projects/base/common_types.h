@@ -124,6 +124,17 @@ enum class WebRtcBandwidthEstimationType : uint8_t
 	None,
 };
 
+// How the media packets of a frame are grouped into the ULPFEC packets
+enum class WebRtcFecScheme : uint8_t
+{
+	// Each FEC packet protects a run of consecutive packets (a random loss in each run is recoverable)
+	Consecutive,
+	// Each FEC packet protects every N-th packet (a burst loss of up to N packets is recoverable)
+	Interleaved,
+	// Both of the above, with half of the FEC packets each (like the 2D parity of FlexFEC)
+	TwoDimensional,
+};
+
 enum class FrameType : int8_t
 {
 	EmptyFrame,
@@ -14,6 +14,9 @@
 
 #include "base/ovlibrary/ovlibrary.h"
 
+// The interval at which the metrics collector samples the statistics of the queues
+#define MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC 1000
+
 namespace info
 {
 	typedef uint32_t managed_queue_id_t;
@@ -129,17 +132,35 @@ namespace info
 		};
 
 	public:
-		explicit ManagedQueue(size_t threshold = 0)
-			: _peak(0),
-			  _size(0),
-			  _threshold(threshold),
-			  _threshold_exceeded_time_in_us(0),
-			  _input_message_count(0),
-			  _output_message_count(0),
-			  _input_message_per_second(0),
-			  _output_message_per_second(0),
-			  _waiting_time_in_us(0),
-			  _drop_message_count(0){};
+		// The counters that are updated by the queue and sampled by the metrics collector (mon::QueueMetrics).
+		// Enqueue/Dequeue only bump them (relaxed, there's only one writer under the lock of the queue),
+		// and the rates/averages are calculated by the collector every MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC.
+		struct Statistics
+		{
+			// Current size of the queue
+			std::atomic<size_t> size{0};
+			// Peak size of the queue
+			std::atomic<size_t> peak{0};
+
+			std::atomic<int64_t> input_message_count{0};
+			std::atomic<int64_t> output_message_count{0};
+			std::atomic<uint64_t> drop_message_count{0};
+
+			// Only the sampled messages are timestamped (see MANAGED_QUEUE_TIMESTAMP_SAMPLING_INTERVAL)
+			std::atomic<int64_t> waiting_time_sum_in_us{0};
+			std::atomic<int64_t> waiting_time_sample_count{0};
+
+			// The messages buffered intentionally are excluded when checking the threshold
+			std::atomic<int> buffering_delay_in_ms{0};
+			int log_interval_in_ms = 0;
+		};
+
+		explicit ManagedQueue(size_t threshold = 0, int log_interval_in_msec = 0)
+			: _threshold(threshold),
+			  _statistics(std::make_shared<Statistics>())
+		{
+			_statistics->log_interval_in_ms = log_interval_in_msec;
+		}
 
 		void SetId(info::managed_queue_id_t id)
 		{
@@ -175,7 +196,7 @@ namespace info
 
 		size_t GetPeak() const
 		{
-			return _peak;
+			return _statistics->peak.load(std::memory_order_relaxed);
 		}
 
 		size_t GetSize() const
@@ -183,29 +204,14 @@ namespace info
 			return _size;
 		}
 
-		size_t GetInputMessagePerSecond() const
-		{
-			return _input_message_per_second;
-		}
-
-		size_t GetOutputMessagePerSecond() const
-		{
-			return _output_message_per_second;
-		}
-
 		uint64_t GetDropCount() const
 		{
-			return _drop_message_count;
+			return _statistics->drop_message_count.load(std::memory_order_relaxed);
 		}
 
-		int64_t GetWaitingTimeInUs() const
+		const std::shared_ptr<Statistics> &GetStatistics() const
 		{
-			return _waiting_time_in_us;
-		}
-
-		int64_t GetThresholdExceededTimeInUs() const
-		{
-			return _threshold_exceeded_time_in_us;
+			return _statistics;
 		}
 
 		void SetUrn(std::shared_ptr<URN> urn, const char* type_name)
@@ -249,36 +255,13 @@ namespace info
 		// Type of template
 		ov::String _type_name;
 
-		// Peak size of the queue
-		size_t _peak = 0;
-
 		// Current size of the queue
 		size_t _size = 0;
 
 		// Threshold of the queue
 		size_t _threshold = 0;
 
-		// threshold_exceeded_time increases from the point the queue is exceeded
-		int64_t _threshold_exceeded_time_in_us;
-
-		// Input Message Count
-		int64_t _input_message_count = 0;
-		int64_t _last_input_message_count = 0;
-		// Output Message Count
-		int64_t _output_message_count = 0;
-		int64_t _last_output_message_count = 0;
-
-		// Input Message Per Second
-		size_t _input_message_per_second = 0;
-
-		// Output Message Per Second
-		size_t _output_message_per_second = 0;
-
-		// Average Waiting Time(microseconds)
-		int64_t _waiting_time_in_us = 0;
-
-		// Drop Count
-		uint64_t _drop_message_count = 0;
+		std::shared_ptr<Statistics> _statistics;
 	};
 
 }  // namespace info
\ No newline at end of file
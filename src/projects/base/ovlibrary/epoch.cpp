@@ -0,0 +1,147 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./epoch.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ov
+{
+	std::atomic<uint64_t> Epoch::_global_epoch{1};
+	std::atomic<Epoch::Record *> Epoch::_record_list{nullptr};
+
+	std::mutex Epoch::_retired_mutex;
+	std::vector<Epoch::Retired> Epoch::_retired_list;
+
+	namespace
+	{
+		// The slot of the current thread, which is released when the thread exits
+		struct ThreadSlot
+		{
+			void *record = nullptr;
+			void (*release)(void *record) = nullptr;
+			// Nested guards only use the outermost one
+			uint32_t depth = 0;
+
+			~ThreadSlot()
+			{
+				if (record != nullptr)
+				{
+					release(record);
+				}
+			}
+		};
+
+		thread_local ThreadSlot thread_slot;
+	}  // namespace
+
+	void Epoch::Enter()
+	{
+		if (thread_slot.depth++ > 0)
+		{
+			return;
+		}
+
+		if (thread_slot.record == nullptr)
+		{
+			thread_slot.record = AcquireRecord();
+			thread_slot.release = [](void *record) {
+				ReleaseRecord(static_cast<Record *>(record));
+			};
+		}
+
+		// Must be visible before the pointer is loaded by the reader
+		static_cast<Record *>(thread_slot.record)->epoch.store(_global_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+	}
+
+	void Epoch::Leave()
+	{
+		if (--thread_slot.depth > 0)
+		{
+			return;
+		}
+
+		static_cast<Record *>(thread_slot.record)->epoch.store(0, std::memory_order_release);
+	}
+
+	Epoch::Record *Epoch::AcquireRecord()
+	{
+		for (auto record = _record_list.load(std::memory_order_acquire); record != nullptr; record = record->next)
+		{
+			bool in_use = false;
+
+			if (record->in_use.compare_exchange_strong(in_use, true))
+			{
+				return record;
+			}
+		}
+
+		auto record = new Record();
+		record->in_use.store(true);
+
+		auto head = _record_list.load(std::memory_order_relaxed);
+
+		do
+		{
+			record->next = head;
+		} while (_record_list.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed) == false);
+
+		return record;
+	}
+
+	void Epoch::ReleaseRecord(Record *record)
+	{
+		record->epoch.store(0, std::memory_order_release);
+		record->in_use.store(false, std::memory_order_release);
+	}
+
+	void Epoch::Retire(std::function<void()> deleter)
+	{
+		std::vector<std::function<void()>> deleter_list;
+
+		{
+			std::lock_guard lock_guard(_retired_mutex);
+
+			// The readers that may have loaded the old pointer entered at this epoch or earlier,
+			// and the readers that enter from now on see the new pointer
+			auto epoch = _global_epoch.fetch_add(1, std::memory_order_seq_cst);
+			_retired_list.push_back({epoch, std::move(deleter)});
+
+			auto min_epoch = std::numeric_limits<uint64_t>::max();
+
+			for (auto record = _record_list.load(std::memory_order_acquire); record != nullptr; record = record->next)
+			{
+				auto record_epoch = record->epoch.load(std::memory_order_seq_cst);
+
+				if (record_epoch != 0)
+				{
+					min_epoch = std::min(min_epoch, record_epoch);
+				}
+			}
+
+			for (auto retired = _retired_list.begin(); retired != _retired_list.end();)
+			{
+				if (retired->epoch < min_epoch)
+				{
+					deleter_list.push_back(std::move(retired->deleter));
+					retired = _retired_list.erase(retired);
+				}
+				else
+				{
+					++retired;
+				}
+			}
+		}
+
+		// The deleters may retire other objects (e.g. a destructor removes an entry from another table)
+		for (auto &retired_deleter : deleter_list)
+		{
+			retired_deleter();
+		}
+	}
+}  // namespace ov
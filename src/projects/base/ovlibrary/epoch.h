@@ -0,0 +1,86 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace ov
+{
+	// Epoch-based reclamation for the objects published through an atomic raw pointer
+	//
+	// A reader holds an Epoch::Guard while it accesses the object. It only stores the current epoch
+	// to a slot of its own thread, so it never waits for a writer or for other readers.
+	// A writer replaces the pointer, and hands the old object over to Retire(). The object is
+	// deleted when every reader that may have loaded the old pointer has released its guard.
+	//
+	// The pointers must be loaded/replaced with std::memory_order_seq_cst.
+	class Epoch
+	{
+	public:
+		class Guard
+		{
+		public:
+			Guard()
+			{
+				Epoch::Enter();
+			}
+
+			~Guard()
+			{
+				Epoch::Leave();
+			}
+
+			Guard(const Guard &) = delete;
+			Guard &operator=(const Guard &) = delete;
+		};
+
+		// Called after the object is unpublished. The deleter is called in a writer (in Retire() of this or a later call)
+		static void Retire(std::function<void()> deleter);
+
+		template <typename T>
+		static void Retire(const T *object)
+		{
+			if (object != nullptr)
+			{
+				Retire([object]() { delete object; });
+			}
+		}
+
+	private:
+		// A slot of a thread. The slots are never freed, but are reused by the next threads
+		struct Record
+		{
+			// 0: The thread is not in a guard
+			std::atomic<uint64_t> epoch{0};
+			std::atomic<bool> in_use{false};
+			Record *next = nullptr;
+		};
+
+		struct Retired
+		{
+			uint64_t epoch;
+			std::function<void()> deleter;
+		};
+
+		static void Enter();
+		static void Leave();
+
+		static Record *AcquireRecord();
+		static void ReleaseRecord(Record *record);
+
+		static std::atomic<uint64_t> _global_epoch;
+		static std::atomic<Record *> _record_list;
+
+		static std::mutex _retired_mutex;
+		static std::vector<Retired> _retired_list;
+	};
+}  // namespace ov
@@ -0,0 +1,133 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+#include <vector>
+
+#include "./string.h"
+
+namespace ov
+{
+	// A lock-free histogram with power-of-two buckets.
+	//
+	// Bucket N counts the values in [2^(N-1), 2^N), and bucket 0 counts 0.
+	// It is intended to be updated from hot paths (e.g. per packet), so Observe() only
+	// does a few relaxed atomic increments.
+	class Histogram
+	{
+	public:
+		static constexpr size_t BucketCount = 64;
+
+		void Observe(uint64_t value)
+		{
+			_buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+			_count.fetch_add(1, std::memory_order_relaxed);
+			_sum.fetch_add(value, std::memory_order_relaxed);
+		}
+
+		uint64_t GetCount() const
+		{
+			return _count.load(std::memory_order_relaxed);
+		}
+
+		uint64_t GetSum() const
+		{
+			return _sum.load(std::memory_order_relaxed);
+		}
+
+		// Inclusive upper bound of the bucket
+		static uint64_t GetBucketUpperBound(size_t index)
+		{
+			return (index == 0) ? 0 : (index >= BucketCount) ? UINT64_MAX : ((1ULL << index) - 1ULL);
+		}
+
+		std::vector<uint64_t> GetBuckets() const
+		{
+			std::vector<uint64_t> buckets(BucketCount);
+
+			for (size_t index = 0; index < BucketCount; index++)
+			{
+				buckets[index] = _buckets[index].load(std::memory_order_relaxed);
+			}
+
+			return buckets;
+		}
+
+		// Returns the upper bound of the bucket that contains the percentile (0.0 ~ 1.0)
+		uint64_t GetPercentile(double percentile) const
+		{
+			auto buckets = GetBuckets();
+
+			uint64_t total = 0;
+			for (auto count : buckets)
+			{
+				total += count;
+			}
+
+			if (total == 0)
+			{
+				return 0;
+			}
+
+			auto target = static_cast<uint64_t>(percentile * total);
+			uint64_t accumulated = 0;
+
+			for (size_t index = 0; index < BucketCount; index++)
+			{
+				accumulated += buckets[index];
+
+				if (accumulated > target)
+				{
+					return GetBucketUpperBound(index);
+				}
+			}
+
+			return GetBucketUpperBound(BucketCount - 1);
+		}
+
+		void Reset()
+		{
+			for (auto &bucket : _buckets)
+			{
+				bucket.store(0, std::memory_order_relaxed);
+			}
+
+			_count.store(0, std::memory_order_relaxed);
+			_sum.store(0, std::memory_order_relaxed);
+		}
+
+		ov::String ToString(const char *unit = "") const
+		{
+			auto count = GetCount();
+
+			return ov::String::FormatString(
+				"count: %" PRIu64 ", avg: %.1f%s, p50: <=%" PRIu64 "%s, p99: <=%" PRIu64 "%s, p999: <=%" PRIu64 "%s",
+				count,
+				(count > 0) ? (static_cast<double>(GetSum()) / count) : 0.0, unit,
+				GetPercentile(0.5), unit,
+				GetPercentile(0.99), unit,
+				GetPercentile(0.999), unit);
+		}
+
+	private:
+		static size_t GetBucketIndex(uint64_t value)
+		{
+			// The number of significant bits: 0 => 0, 1 => 1, 2~3 => 2, 4~7 => 3, ...
+			return (value == 0) ? 0 : std::min<size_t>(64 - __builtin_clzll(value), BucketCount - 1);
+		}
+
+		std::array<std::atomic<uint64_t>, BucketCount> _buckets{};
+		std::atomic<uint64_t> _count{0};
+		std::atomic<uint64_t> _sum{0};
+	};
+}  // namespace ov
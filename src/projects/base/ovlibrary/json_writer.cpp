@@ -0,0 +1,227 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./json_writer.h"
+
+#include <cinttypes>
+
+namespace ov
+{
+	JsonWriter::JsonWriter(size_t capacity)
+	{
+		_output.SetCapacity(capacity);
+	}
+
+	void JsonWriter::BeginValue()
+	{
+		if (_is_after_key)
+		{
+			_is_after_key = false;
+			return;
+		}
+
+		if (_has_value_list.empty() == false)
+		{
+			if (_has_value_list.back())
+			{
+				_output.Append(',');
+			}
+
+			_has_value_list.back() = true;
+		}
+	}
+
+	JsonWriter &JsonWriter::BeginObject()
+	{
+		BeginValue();
+
+		_output.Append('{');
+		_has_value_list.push_back(false);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::EndObject()
+	{
+		_output.Append('}');
+		_has_value_list.pop_back();
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::BeginArray()
+	{
+		BeginValue();
+
+		_output.Append('[');
+		_has_value_list.push_back(false);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::EndArray()
+	{
+		_output.Append(']');
+		_has_value_list.pop_back();
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Key(const char *key)
+	{
+		BeginValue();
+
+		AppendEscapedString(_output, key, ::strlen(key));
+		_output.Append(':');
+
+		_is_after_key = true;
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(const char *value)
+	{
+		BeginValue();
+
+		AppendEscapedString(_output, value, ::strlen(value));
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(const ov::String &value)
+	{
+		BeginValue();
+
+		AppendEscapedString(_output, value.CStr(), value.GetLength());
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(int64_t value)
+	{
+		BeginValue();
+
+		_output.AppendFormat("%" PRId64, value);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(uint64_t value)
+	{
+		BeginValue();
+
+		_output.AppendFormat("%" PRIu64, value);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(int32_t value)
+	{
+		return Value(static_cast<int64_t>(value));
+	}
+
+	JsonWriter &JsonWriter::Value(uint32_t value)
+	{
+		return Value(static_cast<uint64_t>(value));
+	}
+
+	JsonWriter &JsonWriter::Value(bool value)
+	{
+		BeginValue();
+
+		_output.Append(value ? "true" : "false");
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Null()
+	{
+		BeginValue();
+
+		_output.Append("null");
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::RawValue(const ov::String &json)
+	{
+		BeginValue();
+
+		_output.Append(json.CStr(), json.GetLength());
+
+		return *this;
+	}
+
+	const ov::String &JsonWriter::ToString() const
+	{
+		return _output;
+	}
+
+	void JsonWriter::AppendEscapedString(ov::String &output, const char *value, size_t length)
+	{
+		static constexpr char HEX[] = "0123456789abcdef";
+
+		output.Append('"');
+
+		// Append the characters that don't need to be escaped at once
+		size_t start = 0;
+
+		for (size_t index = 0; index < length; index++)
+		{
+			auto character = static_cast<uint8_t>(value[index]);
+			const char *escaped = nullptr;
+
+			switch (character)
+			{
+				case '"':
+					escaped = "\\\"";
+					break;
+				case '\\':
+					escaped = "\\\\";
+					break;
+				case '\b':
+					escaped = "\\b";
+					break;
+				case '\f':
+					escaped = "\\f";
+					break;
+				case '\n':
+					escaped = "\\n";
+					break;
+				case '\r':
+					escaped = "\\r";
+					break;
+				case '\t':
+					escaped = "\\t";
+					break;
+				default:
+					if (character >= 0x20)
+					{
+						continue;
+					}
+					break;
+			}
+
+			output.Append(value + start, index - start);
+			start = index + 1;
+
+			if (escaped != nullptr)
+			{
+				output.Append(escaped);
+			}
+			else
+			{
+				// Other control characters
+				char unicode[] = {'\\', 'u', '0', '0', HEX[character >> 4], HEX[character & 0x0F]};
+				output.Append(unicode, sizeof(unicode));
+			}
+		}
+
+		output.Append(value + start, length - start);
+		output.Append('"');
+	}
+}  // namespace ov
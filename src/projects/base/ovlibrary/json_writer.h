@@ -0,0 +1,73 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <vector>
+
+#include "./string.h"
+
+namespace ov
+{
+	// Writes a compact JSON text directly into a string, without building a ::Json::Value tree.
+	// It is intended for the messages that are generated frequently (signalling messages, ...),
+	// use ov::JsonObject/ov::JsonBuilder for the others.
+	//
+	// Usage:
+	//
+	// ov::JsonWriter writer;
+	//
+	// writer.BeginObject();
+	// writer.Key("command").Value("offer");
+	// writer.Key("candidates").BeginArray();
+	// writer.Value(1).Value(2);
+	// writer.EndArray();
+	// writer.EndObject();
+	//
+	// writer.ToString(); // {"command":"offer","candidates":[1,2]}
+	//
+	// The writer doesn't validate the structure (e.g. Key() in an array), the caller is responsible for it.
+	class JsonWriter
+	{
+	public:
+		JsonWriter() = default;
+		explicit JsonWriter(size_t capacity);
+
+		JsonWriter &BeginObject();
+		JsonWriter &EndObject();
+		JsonWriter &BeginArray();
+		JsonWriter &EndArray();
+
+		JsonWriter &Key(const char *key);
+
+		JsonWriter &Value(const char *value);
+		JsonWriter &Value(const ov::String &value);
+		JsonWriter &Value(int64_t value);
+		JsonWriter &Value(uint64_t value);
+		JsonWriter &Value(int32_t value);
+		JsonWriter &Value(uint32_t value);
+		JsonWriter &Value(bool value);
+		JsonWriter &Null();
+		// Appends the JSON text as it is (e.g. a value serialized in advance)
+		JsonWriter &RawValue(const ov::String &json);
+
+		const ov::String &ToString() const;
+
+		static void AppendEscapedString(ov::String &output, const char *value, size_t length);
+
+	private:
+		// Appends a comma if the current value is not the first one of the object/array
+		void BeginValue();
+
+		ov::String _output;
+
+		// true if a value has been written in the object/array of each depth
+		std::vector<bool> _has_value_list;
+		// true if Key() was just written, so the next value doesn't need a comma
+		bool _is_after_key = false;
+	};
+}  // namespace ov
@@ -43,6 +43,11 @@ namespace ov
 		virtual bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data) = 0;
 		virtual bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) = 0;
 
+		// Receives the packets that are sent together (e.g. the packets of a frame).
+		// The default implementation calls OnDataReceivedFromPrevNode() for each packet,
+		// override it if the node can process the packets in a batch.
+		virtual bool OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list);
+
 	protected:
 		bool SendDataToPrevNode(NodeType node_type, const std::shared_ptr<const ov::Data> &data);
 		bool SendDataToNextNode(NodeType node_type, const std::shared_ptr<ov::Data> &data);
@@ -50,6 +55,8 @@ namespace ov
 		bool SendDataToPrevNode(const std::shared_ptr<const ov::Data> &data);
 		bool SendDataToNextNode(const std::shared_ptr<ov::Data> &data);
 
+		bool SendDataListToNextNode(NodeType node_type, const std::vector<std::shared_ptr<ov::Data>> &data_list);
+
 		std::shared_ptr<Node> GetPrevNode();
 		std::shared_ptr<Node> GetNextNode();
 
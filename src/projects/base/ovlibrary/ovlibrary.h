@@ -21,6 +21,7 @@
 #include "./delay_queue.h"
 #include "./dump_utilities.h"
 #include "./enable_shared_from_this.h"
+#include "./epoch.h"
 #include "./error.h"
 #include "./json.h"
 #include "./log.h"
@@ -36,6 +37,7 @@
 #include "./regex.h"
 #include "./semaphore.h"
 #include "./future.h"
+#include "./histogram.h"
 #include "./flow_utilities.h"
 #include "./fourcc_utilities.h"
 #include "./singleton.h"
@@ -44,6 +46,7 @@
 #include "./string.h"
 #include "./constexpr_utilities.h"
 #include "./time.h"
+#include "./timer_wheel.h"
 #include "./type.h"
 #include "./unique.h"
 #include "./url.h"
@@ -51,5 +54,6 @@
 #include "./precise_timer.h"
 #include "./files.h"
 #include "./sequencial_map.h"
+#include "./sharded_worker_pool.h"
 
 #include "./logger/logger.h"
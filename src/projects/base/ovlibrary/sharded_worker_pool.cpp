@@ -0,0 +1,181 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./sharded_worker_pool.h"
+
+#include <pthread.h>
+
+#include "./logger/thread_helper.h"
+
+namespace ov
+{
+	ShardedWorkerPool::ShardedWorkerPool(const char *name, size_t worker_count, bool drain_on_stop, size_t max_queue_size_per_worker)
+		: _name(name),
+		  _drain_on_stop(drain_on_stop),
+		  _max_queue_size_per_worker(max_queue_size_per_worker)
+	{
+		worker_count = std::max(worker_count, static_cast<size_t>(1));
+
+		for (size_t index = 0; index < worker_count; index++)
+		{
+			auto worker = std::make_unique<Worker>();
+
+			worker->thread = std::thread(&ShardedWorkerPool::WorkerThread, this, worker.get());
+			::pthread_setname_np(worker->thread.native_handle(), String::FormatString("%s%zu", _name.CStr(), index).CStr());
+
+			_worker_list.push_back(std::move(worker));
+		}
+	}
+
+	ShardedWorkerPool::~ShardedWorkerPool()
+	{
+		Stop();
+	}
+
+	void ShardedWorkerPool::Stop()
+	{
+		for (auto &worker : _worker_list)
+		{
+			{
+				std::lock_guard lock_guard(worker->mutex);
+				worker->stop = true;
+			}
+
+			worker->condition.notify_one();
+		}
+
+		for (auto &worker : _worker_list)
+		{
+			if (worker->thread.joinable())
+			{
+				worker->thread.join();
+			}
+		}
+	}
+
+	uint64_t ShardedWorkerPool::IssueKey()
+	{
+		return _last_key.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	ShardedWorkerPool::Worker *ShardedWorkerPool::GetWorker(uint64_t key) const
+	{
+		return _worker_list[key % _worker_list.size()].get();
+	}
+
+	bool ShardedWorkerPool::Post(uint64_t key, Task task)
+	{
+		auto worker = GetWorker(key);
+
+		{
+			std::lock_guard lock_guard(worker->mutex);
+
+			if (worker->stop ||
+				((_max_queue_size_per_worker > 0) && (worker->task_queue.size() >= _max_queue_size_per_worker)))
+			{
+				_dropped_count.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			worker->task_queue.push_back(std::move(task));
+			_queue_depth.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		worker->condition.notify_one();
+
+		return true;
+	}
+
+	bool ShardedWorkerPool::PostDelayed(uint64_t key, Task task, std::chrono::milliseconds delay)
+	{
+		auto worker = GetWorker(key);
+
+		{
+			std::lock_guard lock_guard(worker->mutex);
+
+			if (worker->stop)
+			{
+				_dropped_count.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			worker->delayed_task_queue.push({Clock::now() + delay, worker->last_sequence++, std::move(task)});
+		}
+
+		// The worker may need to wake up earlier than it planned
+		worker->condition.notify_one();
+
+		return true;
+	}
+
+	size_t ShardedWorkerPool::GetWorkerCount() const
+	{
+		return _worker_list.size();
+	}
+
+	size_t ShardedWorkerPool::GetQueueDepth() const
+	{
+		return _queue_depth.load(std::memory_order_relaxed);
+	}
+
+	uint64_t ShardedWorkerPool::GetDroppedCount() const
+	{
+		return _dropped_count.load(std::memory_order_relaxed);
+	}
+
+	void ShardedWorkerPool::WorkerThread(Worker *worker)
+	{
+		logger::ThreadHelper thread_helper;
+
+		while (true)
+		{
+			Task task;
+
+			{
+				std::unique_lock lock(worker->mutex);
+
+				while (true)
+				{
+					if (worker->stop && ((_drain_on_stop == false) || worker->task_queue.empty()))
+					{
+						return;
+					}
+
+					// The delayed tasks that are due are run after the tasks posted before them
+					auto now = Clock::now();
+
+					while ((worker->delayed_task_queue.empty() == false) && (worker->delayed_task_queue.top().time_point <= now))
+					{
+						worker->task_queue.push_back(std::move(const_cast<DelayedTask &>(worker->delayed_task_queue.top()).task));
+						worker->delayed_task_queue.pop();
+						_queue_depth.fetch_add(1, std::memory_order_relaxed);
+					}
+
+					if (worker->task_queue.empty() == false)
+					{
+						break;
+					}
+
+					if (worker->delayed_task_queue.empty())
+					{
+						worker->condition.wait(lock);
+					}
+					else
+					{
+						worker->condition.wait_until(lock, worker->delayed_task_queue.top().time_point);
+					}
+				}
+
+				task = std::move(worker->task_queue.front());
+				worker->task_queue.pop_front();
+				_queue_depth.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			task();
+		}
+	}
+}  // namespace ov
@@ -0,0 +1,97 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "./string.h"
+
+namespace ov
+{
+	// Runs the tasks of many objects (sessions, channels, ...) with a few threads, instead of a thread per object.
+	//
+	// The tasks are sharded by a key (usually one per object, issued by IssueKey()), so the tasks of a key
+	// are never run concurrently, and are run in the order they are posted. A slow task delays only the keys
+	// of the same worker.
+	class ShardedWorkerPool
+	{
+	public:
+		using Task = std::function<void()>;
+		using Clock = std::chrono::steady_clock;
+
+		// name: The threads are named "<name><index>" (up to 15 characters)
+		// drain_on_stop: If true, the queued tasks are run before the threads are stopped (the delayed tasks are dropped)
+		// max_queue_size_per_worker: The tasks over the limit are dropped (0: unlimited)
+		ShardedWorkerPool(const char *name, size_t worker_count, bool drain_on_stop, size_t max_queue_size_per_worker = 0);
+		~ShardedWorkerPool();
+
+		// The tasks posted after this are dropped
+		void Stop();
+
+		uint64_t IssueKey();
+
+		// Returns false if the pool is stopped or the queue of the worker is full
+		bool Post(uint64_t key, Task task);
+		// Posts the task after delay (e.g. retrying later, ticking periodically)
+		bool PostDelayed(uint64_t key, Task task, std::chrono::milliseconds delay);
+
+		size_t GetWorkerCount() const;
+		// The number of tasks waiting in the queues (except the delayed tasks)
+		size_t GetQueueDepth() const;
+		uint64_t GetDroppedCount() const;
+
+	private:
+		struct DelayedTask
+		{
+			Clock::time_point time_point;
+			// To keep the order of the tasks of the same time_point
+			uint64_t sequence;
+			Task task;
+
+			bool operator>(const DelayedTask &other) const
+			{
+				return (time_point != other.time_point) ? (time_point > other.time_point) : (sequence > other.sequence);
+			}
+		};
+
+		struct Worker
+		{
+			std::thread thread;
+
+			std::mutex mutex;
+			std::condition_variable condition;
+			std::deque<Task> task_queue;
+			std::priority_queue<DelayedTask, std::vector<DelayedTask>, std::greater<DelayedTask>> delayed_task_queue;
+			uint64_t last_sequence = 0;
+			bool stop = false;
+		};
+
+		Worker *GetWorker(uint64_t key) const;
+		void WorkerThread(Worker *worker);
+
+		const ov::String _name;
+		const bool _drain_on_stop;
+		const size_t _max_queue_size_per_worker;
+
+		// Doesn't change after the constructor, so Post() can be called while stopping
+		std::vector<std::unique_ptr<Worker>> _worker_list;
+
+		std::atomic<uint64_t> _last_key{0};
+		std::atomic<size_t> _queue_depth{0};
+		std::atomic<uint64_t> _dropped_count{0};
+	};
+}  // namespace ov
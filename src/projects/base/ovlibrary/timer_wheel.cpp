@@ -0,0 +1,245 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./timer_wheel.h"
+
+#include <pthread.h>
+
+#include "./log.h"
+#include "./logger/thread_helper.h"
+#include "./ovlibrary_private.h"
+
+namespace ov
+{
+	TimerWheel::TimerWheel(const char *name, int tick_msec)
+		: _name(name),
+		  _tick(std::max(tick_msec, 1)),
+		  _start_time(std::chrono::steady_clock::now())
+	{
+	}
+
+	TimerWheel::~TimerWheel()
+	{
+		Stop();
+	}
+
+	TimerWheel *TimerWheel::GetSharedInstance()
+	{
+		static TimerWheel instance("Shared");
+		static bool started = instance.Start();
+		(void)started;
+
+		return &instance;
+	}
+
+	bool TimerWheel::Start()
+	{
+		if (_stop.exchange(false) == false)
+		{
+			// Already running
+			return false;
+		}
+
+		_thread = std::thread(&TimerWheel::ThreadProc, this);
+		::pthread_setname_np(_thread.native_handle(), ov::String::FormatString("TW%s", _name.CStr()).CStr());
+
+		return true;
+	}
+
+	bool TimerWheel::Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			if (_stop.exchange(true))
+			{
+				// Already stopped
+				return false;
+			}
+		}
+
+		_stop_condition.notify_all();
+
+		if (_thread.joinable())
+		{
+			_thread.join();
+		}
+
+		return true;
+	}
+
+	TimerWheel::TimerId TimerWheel::Schedule(int64_t after_msec, Callback callback)
+	{
+		// Round up so that the timer never fires earlier than requested
+		auto expire_time = (std::chrono::steady_clock::now() - _start_time) + std::chrono::milliseconds(std::max<int64_t>(after_msec, 0));
+		auto expire_tick = static_cast<uint64_t>((expire_time + _tick - std::chrono::nanoseconds(1)) / _tick);
+
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		auto timer_id = ++_last_timer_id;
+
+		Slot scheduled;
+		scheduled.push_back({timer_id, std::max(expire_tick, _current_tick + 1), std::move(callback)});
+
+		Place(scheduled, scheduled.begin());
+
+		return timer_id;
+	}
+
+	bool TimerWheel::Cancel(TimerId timer_id)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		auto item = _timer_map.find(timer_id);
+		if (item == _timer_map.end())
+		{
+			return false;
+		}
+
+		item->second.slot->erase(item->second.iterator);
+		_timer_map.erase(item);
+
+		return true;
+	}
+
+	size_t TimerWheel::GetCount() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		return _timer_map.size();
+	}
+
+	TimerWheel::Slot &TimerWheel::GetSlot(uint64_t expire_tick)
+	{
+		auto delta = std::min(expire_tick - _current_tick, MaxTicks);
+
+		if (delta < Level0Size)
+		{
+			return _level0[expire_tick & (Level0Size - 1)];
+		}
+
+		// Clamp the timers that are too far away, they will be placed again when they reach level 0
+		expire_tick = _current_tick + delta;
+
+		for (int level = 1; level < LevelCount; level++)
+		{
+			auto shift = Level0Bits + (LevelNBits * level);
+
+			if ((level == (LevelCount - 1)) || (delta < (1ULL << shift)))
+			{
+				auto index = (expire_tick >> (shift - LevelNBits)) & (LevelNSize - 1);
+				return _level_n[level - 1][index];
+			}
+		}
+
+		// Not reachable
+		return _level0[0];
+	}
+
+	void TimerWheel::Place(Slot &from, Slot::iterator iterator)
+	{
+		auto &slot = GetSlot(iterator->expire_tick);
+
+		// splice() keeps the iterator valid
+		slot.splice(slot.end(), from, iterator);
+		_timer_map[iterator->timer_id] = {&slot, iterator};
+	}
+
+	void TimerWheel::Cascade(int level)
+	{
+		auto shift = Level0Bits + (LevelNBits * (level - 1));
+		auto &slot = _level_n[level - 1][(_current_tick >> shift) & (LevelNSize - 1)];
+
+		while (slot.empty() == false)
+		{
+			Place(slot, slot.begin());
+		}
+	}
+
+	void TimerWheel::Advance(std::chrono::steady_clock::time_point now)
+	{
+		auto target_tick = static_cast<uint64_t>((now - _start_time) / _tick);
+
+		while (true)
+		{
+			Slot expired;
+
+			{
+				std::lock_guard<std::mutex> lock_guard(_mutex);
+
+				if (_current_tick >= target_tick)
+				{
+					break;
+				}
+
+				_current_tick++;
+
+				// Move the timers of the upper levels down when the lower level wraps around.
+				// The highest level must be cascaded first, because its timers may move to the slot
+				// of a lower level that is cascaded at the same tick.
+				int cascade_level = 0;
+				while ((cascade_level + 1 < LevelCount) &&
+					   ((_current_tick & ((1ULL << (Level0Bits + (LevelNBits * cascade_level))) - 1)) == 0))
+				{
+					cascade_level++;
+				}
+
+				for (int level = cascade_level; level >= 1; level--)
+				{
+					Cascade(level);
+				}
+
+				auto &slot = _level0[_current_tick & (Level0Size - 1)];
+
+				while (slot.empty() == false)
+				{
+					auto iterator = slot.begin();
+
+					if (iterator->expire_tick > _current_tick)
+					{
+						// Clamped by MaxTicks
+						Place(slot, iterator);
+						continue;
+					}
+
+					_timer_map.erase(iterator->timer_id);
+					expired.splice(expired.end(), slot, iterator);
+				}
+			}
+
+			// Call the callbacks without the lock, so they can schedule/cancel timers
+			for (auto &timer : expired)
+			{
+				timer.callback();
+			}
+		}
+	}
+
+	void TimerWheel::ThreadProc()
+	{
+		logger::ThreadHelper thread_helper;
+
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		while (_stop == false)
+		{
+			auto next_tick_time = _start_time + (_tick * (_current_tick + 1));
+			_stop_condition.wait_until(lock, next_tick_time, [this]() -> bool {
+				return _stop;
+			});
+
+			if (_stop)
+			{
+				break;
+			}
+
+			lock.unlock();
+			Advance(std::chrono::steady_clock::now());
+			lock.lock();
+		}
+	}
+}  // namespace ov
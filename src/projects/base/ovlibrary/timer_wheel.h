@@ -0,0 +1,111 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "./string.h"
+
+namespace ov
+{
+	// A hierarchical timer wheel
+	//
+	// Schedule() and Cancel() are O(1) regardless of the number of timers, so it is suitable for
+	// per-session timeouts (expiry, keepalive, retransmission, ...) of tens of thousands of sessions.
+	//
+	// The resolution is one tick (10 ms by default). The wheel has 4 levels:
+	//   Level 0: 256 slots x 1 tick
+	//   Level 1:  64 slots x 256 ticks
+	//   Level 2:  64 slots x 16384 ticks
+	//   Level 3:  64 slots x 1048576 ticks
+	// Timers in the upper levels are moved down (cascaded) when the lower level wraps around.
+	//
+	// Callbacks are called on the thread of the wheel, so they must not block.
+	// If a callback needs to do a heavy job, it should hand the job over to another thread.
+	class TimerWheel
+	{
+	public:
+		using TimerId = uint64_t;
+		using Callback = std::function<void()>;
+
+		static constexpr TimerId InvalidTimerId = 0;
+
+		TimerWheel(const char *name, int tick_msec = 10);
+		~TimerWheel();
+
+		// A wheel shared by all modules
+		static TimerWheel *GetSharedInstance();
+
+		bool Start();
+		bool Stop();
+
+		// Returns the ID to cancel the timer
+		TimerId Schedule(int64_t after_msec, Callback callback);
+		// Returns false if the timer is already fired or cancelled
+		bool Cancel(TimerId timer_id);
+
+		size_t GetCount() const;
+
+	private:
+		static constexpr int Level0Bits = 8;
+		static constexpr int LevelNBits = 6;
+		static constexpr int LevelCount = 4;
+
+		static constexpr size_t Level0Size = 1 << Level0Bits;
+		static constexpr size_t LevelNSize = 1 << LevelNBits;
+
+		// The maximum number of ticks that can be placed in the wheel
+		static constexpr uint64_t MaxTicks = (1ULL << (Level0Bits + LevelNBits * (LevelCount - 1))) - 1;
+
+		struct Timer
+		{
+			TimerId timer_id;
+			uint64_t expire_tick;
+			Callback callback;
+		};
+
+		using Slot = std::list<Timer>;
+
+		struct TimerLocation
+		{
+			Slot *slot;
+			Slot::iterator iterator;
+		};
+
+		Slot &GetSlot(uint64_t expire_tick);
+		// Must be called with _mutex locked
+		void Place(Slot &from, Slot::iterator iterator);
+		void Cascade(int level);
+		// Processes the ticks elapsed until now
+		void Advance(std::chrono::steady_clock::time_point now);
+		void ThreadProc();
+
+		ov::String _name;
+		const std::chrono::milliseconds _tick;
+
+		std::chrono::steady_clock::time_point _start_time;
+		uint64_t _current_tick = 0;
+
+		mutable std::mutex _mutex;
+		Slot _level0[Level0Size];
+		Slot _level_n[LevelCount - 1][LevelNSize];
+		std::unordered_map<TimerId, TimerLocation> _timer_map;
+		TimerId _last_timer_id = InvalidTimerId;
+
+		std::thread _thread;
+		std::atomic<bool> _stop{true};
+		std::condition_variable _stop_condition;
+	};
+}  // namespace ov
@@ -46,4 +46,115 @@ namespace ov
 	private:
 
 	};
+
+	// Compresses a growing data into a single gzip member without compressing the appended data again.
+	//
+	// Append() compresses the data with Z_SYNC_FLUSH so that the output so far is byte-aligned,
+	// and Finish() completes a copy of the stream with the tail, so the cost of Finish() is
+	// proportional to the tail rather than to the whole data.
+	class GzipStream
+	{
+	public:
+		GzipStream()
+		{
+			Init();
+		}
+
+		~GzipStream()
+		{
+			deflateEnd(&_stream);
+		}
+
+		GzipStream(const GzipStream &) = delete;
+		GzipStream &operator=(const GzipStream &) = delete;
+
+		bool Append(const void *data, size_t length)
+		{
+			if (_is_valid == false)
+			{
+				return false;
+			}
+
+			_is_valid = Deflate(&_stream, data, length, Z_SYNC_FLUSH, _output);
+			return _is_valid;
+		}
+
+		// Returns the gzip data of all appended data followed by the tail.
+		// The stream is kept open, so Append() can be called again.
+		std::shared_ptr<ov::Data> Finish(const void *tail, size_t tail_length)
+		{
+			if (_is_valid == false)
+			{
+				return nullptr;
+			}
+
+			z_stream stream;
+			if (deflateCopy(&stream, &_stream) != Z_OK)
+			{
+				return nullptr;
+			}
+
+			auto output = std::make_shared<ov::Data>(_output.GetLength() + deflateBound(&stream, tail_length));
+			output->Append(&_output);
+
+			auto result = Deflate(&stream, tail, tail_length, Z_FINISH, *output);
+			deflateEnd(&stream);
+
+			return result ? output : nullptr;
+		}
+
+		// Discards all appended data
+		void Reset()
+		{
+			deflateEnd(&_stream);
+			_output.Clear();
+
+			Init();
+		}
+
+		// The size of the compressed data of all appended data
+		size_t GetSize() const
+		{
+			return _output.GetLength();
+		}
+
+	private:
+		void Init()
+		{
+			_stream.zalloc = Z_NULL;
+			_stream.zfree = Z_NULL;
+			_stream.opaque = Z_NULL;
+
+			_is_valid = (deflateInit2(&_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+		}
+
+		static bool Deflate(z_stream *stream, const void *data, size_t length, int flush, ov::Data &output)
+		{
+			stream->avail_in = static_cast<uInt>(length);
+			stream->next_in = static_cast<Bytef *>(const_cast<void *>(data));
+
+			uint8_t buffer[16384];
+
+			do
+			{
+				stream->avail_out = sizeof(buffer);
+				stream->next_out = buffer;
+
+				auto result = deflate(stream, flush);
+				if ((result != Z_OK) && (result != Z_STREAM_END) && (result != Z_BUF_ERROR))
+				{
+					return false;
+				}
+
+				output.Append(buffer, sizeof(buffer) - stream->avail_out);
+			} while (stream->avail_out == 0);
+
+			return true;
+		}
+
+		z_stream _stream;
+		bool _is_valid = false;
+
+		ov::Data _output;
+	};
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include <errno.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <algorithm>
@@ -879,6 +880,47 @@ namespace ov
 				sent_bytes = SendFromToInternal(command.address_pair, data);
 				break;
 
+			case DispatchCommand::Type::SendVector: {
+				auto &data_list = command.data_list;
+				sent_bytes = SendVectorInternal(data_list);
+
+				if (sent_bytes == static_cast<ssize_t>(command.GetDataListLength()))
+				{
+					return DispatchResult::Dispatched;
+				}
+
+				if (sent_bytes == -1)
+				{
+					return DispatchResult::Error;
+				}
+
+				if (sent_bytes > 0)
+				{
+					command.UpdateTime();
+
+					// Drop the data that has been sent
+					size_t bytes_to_drop = sent_bytes;
+					auto item = data_list.begin();
+
+					while ((item != data_list.end()) && (bytes_to_drop >= (*item)->GetLength()))
+					{
+						bytes_to_drop -= (*item)->GetLength();
+						++item;
+					}
+
+					item = data_list.erase(data_list.begin(), item);
+
+					if (bytes_to_drop > 0)
+					{
+						*item = (*item)->Subdata(bytes_to_drop);
+					}
+
+					logad("Part of the data has been sent: %ld bytes, left: %zu bytes (%s)", sent_bytes, command.GetDataListLength(), command.ToString().CStr());
+				}
+
+				return DispatchResult::PartialDispatched;
+			}
+
 			case DispatchCommand::Type::HalfClose:
 				return HalfClose();
 
@@ -1238,6 +1280,131 @@ namespace ov
 		return Send((data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+	ssize_t Socket::SendVectorInternal(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		size_t total_sent_bytes = 0L;
+
+		if (GetType() != SocketType::Tcp)
+		{
+			// UDP must keep the datagram boundaries and SRT limits the message size, so the data are sent one by one
+			for (const auto &data : data_list)
+			{
+				const auto sent = SendInternal(data);
+
+				if (sent < 0L)
+				{
+					return sent;
+				}
+
+				total_sent_bytes += sent;
+
+				if (sent != static_cast<ssize_t>(data->GetLength()))
+				{
+					break;
+				}
+			}
+
+			return total_sent_bytes;
+		}
+
+		constexpr size_t MAX_IOV_COUNT = 64;
+		iovec iov[MAX_IOV_COUNT];
+
+		// Position of the data to send next
+		size_t index = 0;
+		size_t offset = 0;
+
+		while ((index < data_list.size()) && (_force_stop == false))
+		{
+			size_t iov_count = 0;
+
+			for (auto iov_index = index; (iov_index < data_list.size()) && (iov_count < MAX_IOV_COUNT); iov_index++)
+			{
+				const auto &data = data_list[iov_index];
+				const auto data_offset = (iov_index == index) ? offset : 0;
+
+				if (data->GetLength() > data_offset)
+				{
+					// This is intentional conversion
+					iov[iov_count].iov_base = const_cast<uint8_t *>(data->GetDataAs<uint8_t>() + data_offset);
+					iov[iov_count].iov_len = data->GetLength() - data_offset;
+					iov_count++;
+				}
+			}
+
+			if (iov_count == 0)
+			{
+				break;
+			}
+
+			msghdr msg{};
+			msg.msg_iov = iov;
+			msg.msg_iovlen = iov_count;
+
+			logat("Trying to send %zu buffers...", iov_count);
+
+			const auto sent = ::sendmsg(GetNativeHandle(), &msg, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			total_sent_bytes += sent;
+
+			// Advance the position
+			size_t remaining_bytes = sent;
+
+			while ((index < data_list.size()) && ((data_list[index]->GetLength() - offset) <= remaining_bytes))
+			{
+				remaining_bytes -= (data_list[index]->GetLength() - offset);
+				offset = 0;
+				index++;
+			}
+
+			offset += remaining_bytes;
+
+			UpdateLastSentTime();
+		}
+
+		logat("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
+	bool Socket::SendVector(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		if (data_list.empty())
+		{
+			return true;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking: {
+				size_t total_length = 0;
+
+				for (const auto &data : data_list)
+				{
+					total_length += data->GetLength();
+				}
+
+				return (SendVectorInternal(data_list) == static_cast<ssize_t>(total_length));
+			}
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					// The data are immutable, so only the references are queued
+					return AppendCommand({data_list}, true);
+				}
+				break;
+		}
+
+		return false;
+	}
+
 	ssize_t Socket::SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data)
 	{
 		if (GetType() != SocketType::Udp)
@@ -26,6 +26,7 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 // Failure to send data for the specified time period will be considered an error.
 // For example, it can occur when EAGAIN continues to occur for a period of time, or when the peer's TCP window is full and no longer receives data.
@@ -178,6 +179,10 @@ namespace ov
 
 		bool Send(const std::shared_ptr<const Data> &data);
 		bool Send(const void *data, size_t length);
+		// Sends the buffers in order without concatenating them (scatter/gather).
+		// TCP sockets send them with a single sendmsg(), other sockets fall back to sending each buffer.
+		// The buffers are queued without being cloned, so they must not be modified after calling this (they can be shared by many sockets).
+		bool SendVector(const std::vector<std::shared_ptr<const Data>> &data_list);
 
 		bool SendTo(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		bool SendTo(const SocketAddress &address, const void *data, size_t length);
@@ -266,6 +271,8 @@ namespace ov
 				SendTo = 0x02,
 				// Need to send data using sendmsg()
 				SendFromTo = 0x03,
+				// Need to send multiple data using sendmsg() (scatter/gather)
+				SendVector = 0x04,
 
 				// Need to call shutdown(SHUT_WR) (TCP only)
 				HalfClose = CLOSE_TYPE_MASK | 0x01,
@@ -291,6 +298,9 @@ namespace ov
 					case Type::SendFromTo:
 						return "SendFromTo";
 
+					case Type::SendVector:
+						return "SendVector";
+
 					case Type::HalfClose:
 						return "HalfClose";
 
@@ -327,6 +337,13 @@ namespace ov
 			{
 			}
 
+			DispatchCommand(const std::vector<std::shared_ptr<const Data>> &data_list)
+				: type(Type::SendVector),
+				  data_list(data_list),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
 			DispatchCommand(Type type)
 				: type(type),
 				  enqueued_time(std::chrono::system_clock::now())
@@ -347,6 +364,7 @@ namespace ov
 				  address(another_command.address),
 				  address_pair(another_command.address_pair),
 				  data(another_command.data),
+				  data_list(another_command.data_list),
 				  enqueued_time(another_command.enqueued_time)
 			{
 			}
@@ -359,6 +377,7 @@ namespace ov
 				std::swap(address, another_command.address);
 				std::swap(address_pair, another_command.address_pair);
 				std::swap(data, another_command.data);
+				std::swap(data_list, another_command.data_list);
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
 
@@ -372,6 +391,18 @@ namespace ov
 				enqueued_time = std::chrono::system_clock::now();
 			}
 
+			size_t GetDataListLength() const
+			{
+				size_t length = 0;
+
+				for (const auto &item : data_list)
+				{
+					length += item->GetLength();
+				}
+
+				return length;
+			}
+
 			bool IsExpired(int millisecond_time) const
 			{
 				auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - enqueued_time);
@@ -402,6 +433,11 @@ namespace ov
 					description.AppendFormat(", data: %zu bytes", data->GetLength());
 				}
 
+				if (data_list.empty() == false)
+				{
+					description.AppendFormat(", data_list: %zu items, %zu bytes", data_list.size(), GetDataListLength());
+				}
+
 				description.Append('>');
 
 				return description;
@@ -412,6 +448,8 @@ namespace ov
 			SocketAddress address;
 			SocketAddressPair address_pair;
 			std::shared_ptr<const Data> data;
+			// Used by Type::SendVector
+			std::vector<std::shared_ptr<const Data>> data_list;
 			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
 		};
 
@@ -444,6 +482,7 @@ namespace ov
 		ssize_t SendSrtData(const std::shared_ptr<const Data> &data);
 
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
+		ssize_t SendVectorInternal(const std::vector<std::shared_ptr<const Data>> &data_list);
 		ssize_t SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		ssize_t SendFromToInternal(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
 
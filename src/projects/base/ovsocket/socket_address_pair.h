@@ -99,3 +99,19 @@ namespace ov
 		SocketAddress _remote_address;
 	};
 }  // namespace ov
+
+namespace std
+{
+	template <>
+	struct hash<ov::SocketAddressPair>
+	{
+		std::size_t operator()(ov::SocketAddressPair const &pair) const
+		{
+			// Same as boost::hash_combine()
+			auto hash = pair.GetRemoteAddress().Hash();
+			hash ^= pair.GetLocalAddress().Hash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+			return hash;
+		}
+	};
+}  // namespace std
@@ -84,6 +84,7 @@ namespace pvd
 					// Default Properties of PullStream
 					auto is_persistent = false;
 					auto is_failback = false;
+					auto is_prewarm = false;
 					int64_t no_input_timeout_ms = global_no_input_timeout_ms;
 					int64_t unused_stream_timeout_ms = global_unused_stream_timeout_ms;
 					int64_t failback_timeout_ms = global_failback_timeout_ms;
@@ -93,6 +94,7 @@ namespace pvd
 					{
 						is_persistent = props->IsPersistent();
 						is_failback = props->IsFailback();
+						is_prewarm = props->IsPrewarm();
 
 						if (props->GetNoInputFailoverTimeout() > 0)
 						{
@@ -154,7 +156,7 @@ namespace pvd
 						auto elapsed_time_from_last_sent = std::chrono::duration_cast<std::chrono::milliseconds>(current - stream_metrics->GetLastSentTime()).count();
 						auto elapsed_time_from_last_recv = std::chrono::duration_cast<std::chrono::milliseconds>(current - stream_metrics->GetLastRecvTime()).count();
 
-						if((elapsed_time_from_last_sent > unused_stream_timeout_ms) && (!is_persistent))
+						if((elapsed_time_from_last_sent > unused_stream_timeout_ms) && (!is_persistent) && (!is_prewarm))
 						{
 							logtw("%s/%s(%u) stream will be deleted because it hasn't been used for %u milliseconds", stream->GetApplicationInfo().GetVHostAppName().CStr(), stream->GetName().CStr(), stream->GetId(), elapsed_time_from_last_sent);
 							DeleteStream(stream);
@@ -9,6 +9,8 @@
 #pragma once
 #include "../../ovlibrary/string.h"
 
+#include <atomic>
+
 namespace pvd
 {
 	class PullStreamProperties
@@ -41,6 +43,12 @@ namespace pvd
 			return _ignore_rtcp_sr_timestamp;
 		}
 
+		// The stream is kept pulled by the prewarmer even if there are no viewers
+		bool IsPrewarm()
+		{
+			return _prewarm;
+		}
+
 		void EnableFailback(bool failback)
 		{
 			_failback = failback;
@@ -66,6 +74,11 @@ namespace pvd
 			_ignore_rtcp_sr_timestamp = ignore_flag;
 		}
 
+		void EnablePrewarm(bool prewarm)
+		{
+			_prewarm = prewarm;
+		}
+
 		int32_t GetFailbackTimeout()
 		{
 			return _failback_timeout;
@@ -128,6 +141,8 @@ namespace pvd
 		bool _relay = false;
 		bool _from_origin_map_store = false;
 		bool _ignore_rtcp_sr_timestamp = false;
+		// Changed by the prewarmer while the stream is running
+		std::atomic<bool> _prewarm = false;
 
 		// -1 means that the values in configuration file will be used. (Conf/Origins/Properties)
 		int32_t _failback_timeout = -1;
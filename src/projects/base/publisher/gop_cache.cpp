@@ -0,0 +1,83 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "gop_cache.h"
+
+#include "publisher_private.h"
+
+namespace pub
+{
+	GopCache::GopCache(size_t max_size)
+		: _max_size(max_size)
+	{
+	}
+
+	void GopCache::ResetTrack(TrackCache &track_cache, bool is_valid)
+	{
+		_total_size -= track_cache.size;
+
+		track_cache.is_valid = is_valid;
+		track_cache.size = 0;
+		track_cache.packet_list.clear();
+	}
+
+	bool GopCache::Append(uint64_t key, bool is_gop_start, size_t size, const std::any &packet)
+	{
+		std::lock_guard<std::shared_mutex> lock_guard(_track_cache_map_mutex);
+
+		auto &track_cache = _track_cache_map[key];
+
+		if (is_gop_start)
+		{
+			ResetTrack(track_cache, true);
+		}
+		else if (track_cache.is_valid == false)
+		{
+			// Wait for the next GOP
+			return false;
+		}
+
+		if ((_total_size + size) > _max_size)
+		{
+			// An incomplete GOP is useless, so drop the whole GOP of the track
+			logtd("GOP cache of key %" PRIu64 " exceeds the limit (%zu + %zu > %zu bytes), so it is dropped until the next GOP",
+				  key, _total_size.load(), size, _max_size);
+
+			ResetTrack(track_cache, false);
+			_overflow_count++;
+
+			return is_gop_start;
+		}
+
+		track_cache.packet_list.push_back(packet);
+		track_cache.size += size;
+		_total_size += size;
+
+		return is_gop_start;
+	}
+
+	std::vector<std::any> GopCache::GetPackets(uint64_t key) const
+	{
+		std::shared_lock<std::shared_mutex> lock(_track_cache_map_mutex);
+
+		auto item = _track_cache_map.find(key);
+		if ((item == _track_cache_map.end()) || (item->second.is_valid == false))
+		{
+			return {};
+		}
+
+		return {item->second.packet_list.begin(), item->second.packet_list.end()};
+	}
+
+	void GopCache::Clear()
+	{
+		std::lock_guard<std::shared_mutex> lock_guard(_track_cache_map_mutex);
+
+		_track_cache_map.clear();
+		_total_size = 0;
+	}
+}  // namespace pub
@@ -0,0 +1,73 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <any>
+#include <deque>
+#include <map>
+#include <shared_mutex>
+
+namespace pub
+{
+	// Keeps the packets from the last keyframe to now for each track (or any key the publisher chooses),
+	// so that a new session can start playing without waiting for the next keyframe.
+	//
+	// The packets are stored as std::any, so each publisher can cache its own packet type
+	// (MediaPacket, RtpPacket, ...) after packetizing it once for all sessions.
+	class GopCache
+	{
+	public:
+		GopCache(size_t max_size);
+
+		// Returns true if a new GOP is started by the packet
+		bool Append(uint64_t key, bool is_gop_start, size_t size, const std::any &packet);
+
+		// Returns the cached packets of the key in order (empty if there is no complete GOP start)
+		std::vector<std::any> GetPackets(uint64_t key) const;
+
+		void Clear();
+
+		size_t GetMaxSize() const
+		{
+			return _max_size;
+		}
+
+		// Total size of all cached packets
+		size_t GetSize() const
+		{
+			return _total_size;
+		}
+
+		// The number of GOPs dropped because they exceeded the memory limit
+		uint64_t GetOverflowCount() const
+		{
+			return _overflow_count;
+		}
+
+	private:
+		struct TrackCache
+		{
+			// false until a GOP start arrives, or after the GOP exceeded the memory limit
+			bool is_valid = false;
+			size_t size = 0;
+			std::deque<std::any> packet_list;
+		};
+
+		void ResetTrack(TrackCache &track_cache, bool is_valid);
+
+		const size_t _max_size;
+		std::atomic<size_t> _total_size = 0;
+		std::atomic<uint64_t> _overflow_count = 0;
+
+		// key: given by the publisher (e.g. track id)
+		std::map<uint64_t, TrackCache> _track_cache_map;
+		mutable std::shared_mutex _track_cache_map_mutex;
+	};
+}  // namespace pub
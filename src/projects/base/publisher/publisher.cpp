@@ -200,6 +200,9 @@ namespace pub
 			}
 		}
 
+		// The viewer had to wait for the stream to be pulled
+		orchestrator->GetStreamPrewarmer().OnStreamPulledOnDemand(vhost_app_name, stream_name);
+
 		// try one more after pulling stream
 		return GetStream(vhost_app_name, stream_name);
 	}
@@ -2,6 +2,7 @@
 #include "application.h"
 #include "publisher_private.h"
 #include <base/event/command/commands.h>
+#include <monitoring/monitoring.h>
 
 namespace pub
 {
@@ -302,6 +303,17 @@ namespace pub
 
 		worker_lock.unlock();
 
+		if (_gop_cache != nullptr)
+		{
+			_gop_cache->Clear();
+
+			auto stream_metrics = StreamMetrics(*this);
+			if (stream_metrics != nullptr)
+			{
+				stream_metrics->SetGopCacheSize(_gop_cache_publisher_type, 0);
+			}
+		}
+
 		std::lock_guard<std::shared_mutex> session_lock(_session_map_mutex);
 
 		logti("[%s(%u)] %s - Try to stop all sessions (%d)", GetName().CStr(), GetId(), GetApplicationTypeName(), _sessions.size());
@@ -337,6 +349,32 @@ namespace pub
 		return _started_time;
 	}
 
+	void Stream::EnableGopCache(PublisherType publisher_type, size_t max_size)
+	{
+		_gop_cache_publisher_type = publisher_type;
+		_gop_cache = std::make_shared<GopCache>(max_size);
+
+		logti("%s - GOP cache is enabled for [%s(%u)] stream (max: %zu bytes)", GetApplicationTypeName(), GetName().CStr(), GetId(), max_size);
+	}
+
+	void Stream::CacheGopPacket(uint64_t key, bool is_gop_start, size_t size, const std::any &packet)
+	{
+		if (_gop_cache == nullptr)
+		{
+			return;
+		}
+
+		if (_gop_cache->Append(key, is_gop_start, size, packet))
+		{
+			// Report the memory usage once per GOP
+			auto stream_metrics = StreamMetrics(*this);
+			if (stream_metrics != nullptr)
+			{
+				stream_metrics->SetGopCacheSize(_gop_cache_publisher_type, _gop_cache->GetSize());
+			}
+		}
+	}
+
 	std::shared_ptr<Application> Stream::GetApplication() const
 	{
 		return _application;
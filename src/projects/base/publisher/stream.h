@@ -7,6 +7,7 @@
 #include "base/mediarouter/media_buffer.h"
 #include "base/event/media_event.h"
 #include "modules/managed_queue/managed_queue.h"
+#include "gop_cache.h"
 #include "session.h"
 
 #define MAX_STREAM_WORKER_THREAD_COUNT 72
@@ -150,6 +151,12 @@ namespace pub
 		std::shared_ptr<Application> GetApplication() const;
 		const char * GetApplicationTypeName() const;
 
+		// nullptr if the GOP cache is disabled
+		std::shared_ptr<const GopCache> GetGopCache() const
+		{
+			return _gop_cache;
+		}
+
 		// Set the stream state
 		void SetState(State state)
 		{
@@ -167,6 +174,10 @@ namespace pub
 		Stream(const std::shared_ptr<Application> application, const info::Stream &info);
 		virtual ~Stream();
 
+		void EnableGopCache(PublisherType publisher_type, size_t max_size);
+		// Stores a packet that has been broadcast to the sessions in the GOP cache
+		void CacheGopPacket(uint64_t key, bool is_gop_start, size_t size, const std::any &packet);
+
 	private:
 		std::shared_ptr<StreamWorker> GetWorkerBySessionID(session_id_t session_id);
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
@@ -183,5 +194,8 @@ namespace pub
 		std::chrono::system_clock::time_point _started_time;
 
 		State _state = State::CREATED;
+
+		std::shared_ptr<GopCache> _gop_cache;
+		PublisherType _gop_cache_publisher_type = PublisherType::Unknown;
 	};
 }  // namespace pub
\ No newline at end of file
@@ -17,6 +17,37 @@ namespace cfg
 	{
 		namespace sig
 		{
+			struct AdmissionWebhooksCache : public Item
+			{
+			protected:
+				// The maximum number of cached decisions
+				int _max_entries = 10000;
+				// How long an allowed decision is cached if the control server doesn't respond "cache_ttl" (milliseconds)
+				int _ttl_msec = 5000;
+				// How long a denied decision is cached if the control server doesn't respond "cache_ttl" (milliseconds)
+				int _negative_ttl_msec = 1000;
+				// Clients in the same network share the decision
+				int _ipv4_prefix_length = 32;
+				int _ipv6_prefix_length = 128;
+
+			public:
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxEntries, _max_entries)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetTtlMsec, _ttl_msec)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetNegativeTtlMsec, _negative_ttl_msec)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetIPv4PrefixLength, _ipv4_prefix_length)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetIPv6PrefixLength, _ipv6_prefix_length)
+
+			protected:
+				void MakeList() override
+				{
+					Register<Optional>("MaxEntries", &_max_entries);
+					Register<Optional>("TTL", &_ttl_msec);
+					Register<Optional>("NegativeTTL", &_negative_ttl_msec);
+					Register<Optional>("IPv4PrefixLength", &_ipv4_prefix_length);
+					Register<Optional>("IPv6PrefixLength", &_ipv6_prefix_length);
+				}
+			};
+
 			struct AdmissionWebhooks : public Item
 			{
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetControlServerUrl, _control_server_url)
@@ -24,6 +55,7 @@ namespace cfg
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetTimeoutMsec, _timeout_msec)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEnabledProviders, _enables.GetProviders().GetValue())
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEnabledPublishers, _enables.GetPublishers().GetValue())
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetCache, _cache)
 
 				bool IsEnabledProvider(ProviderType type) const
 				{
@@ -44,6 +76,7 @@ namespace cfg
 					Register("SecretKey", &_secret_key);
 					Register("Timeout", &_timeout_msec);
 					Register("Enables", &_enables);
+					Register<Optional>("Cache", &_cache);
 				}
 
 				ov::String _control_server_url;
@@ -51,6 +84,7 @@ namespace cfg
 				int _timeout_msec = 3000;
 
 				Enables _enables;
+				AdmissionWebhooksCache _cache;
 			};
 		}  // namespace sig
 	}  // namespace vhost
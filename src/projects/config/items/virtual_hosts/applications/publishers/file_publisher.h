@@ -29,6 +29,7 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetFilePath, _file_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetInfoPath, _info_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetRootPath, _root_path)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMuxer, _muxer)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamMap, _stream_map)
 
 				protected:
@@ -39,6 +40,7 @@ namespace cfg
 						Register<Optional>("RootPath", &_root_path);
 						Register<Optional>("FilePath", &_file_path);
 						Register<Optional>("InfoPath", &_info_path);
+						Register<Optional>("Muxer", &_muxer);
 
 						// Record is Deprecated
 						Register<Optional>({"Record", "record"}, &_stream_map, nullptr,
@@ -52,6 +54,9 @@ namespace cfg
 					ov::String _root_path = "";
 					ov::String _file_path = "";
 					ov::String _info_path = "";
+					// FFmpeg: Records with libavformat
+					// fMP4: Records a single track to a fragmented MP4 file with the in-tree packager
+					ov::String _muxer = "FFmpeg";
 
 					pub::StreamMap _stream_map;
 				};
@@ -36,6 +36,65 @@ namespace cfg
 					}
 				};
 
+				struct GopCache : public Item
+				{
+				protected:
+					// Maximum memory used by the GOP cache per stream (bytes)
+					int64_t _max_size = 8 * 1024 * 1024;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxSize, _max_size)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("MaxSize", &_max_size);
+					}
+				};
+
+				struct UlpfecProtection : public Item
+				{
+				protected:
+					ov::String _scheme_string = "Consecutive";
+					WebRtcFecScheme _scheme = WebRtcFecScheme::Consecutive;
+					// The number of FEC packets per 100 media packets (about 1 FEC packet per 7 media packets by default)
+					int _rate = 14;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetScheme, _scheme)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetRate, _rate)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("Scheme", &_scheme_string, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							auto scheme = _scheme_string.UpperCaseString();
+
+							if (scheme == "CONSECUTIVE")
+							{
+								_scheme = WebRtcFecScheme::Consecutive;
+							}
+							else if (scheme == "INTERLEAVED")
+							{
+								_scheme = WebRtcFecScheme::Interleaved;
+							}
+							else if (scheme == "TWODIMENSIONAL")
+							{
+								_scheme = WebRtcFecScheme::TwoDimensional;
+							}
+							else
+							{
+								return CreateConfigErrorPtr("Invalid value for Scheme. Valid values are 'Consecutive', 'Interleaved' or 'TwoDimensional'");
+							}
+
+							return nullptr;
+						});
+						Register<Optional>("Rate", &_rate, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							return ((_rate > 0) && (_rate <= 100)) ? nullptr : CreateConfigErrorPtr("Rate must be between 1 and 100");
+						});
+					}
+				};
+
 				struct WebrtcPublisher : public Publisher
 				{
 					PublisherType GetType() const override
@@ -46,8 +105,10 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetTimeout, _timeout)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsRtxEnabled, _rtx)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsUlpfecEnalbed, _ulpfec)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetUlpfecProtection, _ulpfec_protection)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsJitterBufferEnabled, _jitter_buffer)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPlayoutDelay, _playout_delay)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetGopCache, _gop_cache)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetBandwidthEstimationType, _bandwidth_estimation_type)
 					CFG_DECLARE_CONST_REF_GETTER_OF(ShouldCreateDefaultPlaylist, _create_default_playlist)
 
@@ -60,19 +121,19 @@ namespace cfg
 						Register<Optional>("JitterBuffer", &_jitter_buffer);
 						Register<Optional>("Rtx", &_rtx);
 						Register<Optional>("Ulpfec", &_ulpfec);
+						Register<Optional>("UlpfecProtection", &_ulpfec_protection);
 						Register<Optional>("PlayoutDelay", &_playout_delay);
+						Register<Optional>("GopCache", &_gop_cache);
 						Register<Optional>("CreateDefaultPlaylist", &_create_default_playlist);
 						Register<Optional>("BandwidthEstimation", &_bwe, [=]() -> std::shared_ptr<ConfigError> { return nullptr; }, [=]() -> std::shared_ptr<ConfigError> {
 								if (_bwe.UpperCaseString() == "REMB")
 								{
 									_bandwidth_estimation_type = WebRtcBandwidthEstimationType::REMB;
 								}
-								// Not yet supported
-								// else if (_bwe.UpperCaseString() == "TRANSPORTCC")
-								// {
-								// 	_bandwidth_estimation_type = BandwidthEstimationType::TransportCc;
-									
-								// }
+								else if (_bwe.UpperCaseString() == "TRANSPORTCC")
+								{
+									_bandwidth_estimation_type = WebRtcBandwidthEstimationType::TransportCc;
+								}
 								else
 								{
 									return CreateConfigErrorPtr("Invalid value for BWE. Valid values are 'TransportCC' or 'REMB'");
@@ -89,6 +150,8 @@ namespace cfg
 
 					WebRtcBandwidthEstimationType _bandwidth_estimation_type = WebRtcBandwidthEstimationType::REMB;
 					PlayoutDelay _playout_delay;
+					GopCache _gop_cache;
+					UlpfecProtection _ulpfec_protection;
 					bool _create_default_playlist = true;
 				};
 			}  // namespace pub
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "origin.h"
+#include "prewarm.h"
 #include "properties.h"
 
 namespace cfg
@@ -21,16 +22,19 @@ namespace cfg
 			{
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetOriginList, _origin_list)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetProperties, _properties)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetPrewarm, _prewarm)
 
 			protected:
 				void MakeList() override
 				{
 					Register<Optional>("Origin", &_origin_list);
 					Register<Optional>("Properties", &_properties);
+					Register<Optional>("Prewarm", &_prewarm);
 				}
 
 				std::vector<Origin> _origin_list;
 				Properties _properties;
+				Prewarm _prewarm;
 			};
 		}  // namespace orgn
 	}  // namespace vhost
@@ -0,0 +1,58 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace orgn
+		{
+			struct PrewarmStreams : public Item
+			{
+			protected:
+				// <app>/<stream>
+				// Names without wildcards are always kept pulled, and names with wildcards
+				// (e.g. "app/*") limit the streams that can be pulled by popularity
+				std::vector<ov::String> _stream_list;
+
+			public:
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamList, _stream_list)
+
+			protected:
+				void MakeList() override
+				{
+					Register<Optional>("Stream", &_stream_list);
+				}
+			};
+
+			struct Prewarm : public Item
+			{
+			protected:
+				PrewarmStreams _streams;
+				// The number of the most watched streams to keep pulled (0 = disabled)
+				int32_t _popular_stream_count = 0;
+				// Half-life of the popularity score in milliseconds
+				int64_t _popularity_half_life = 60000;
+
+			public:
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetStreams, _streams)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetPopularStreamCount, _popular_stream_count)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetPopularityHalfLife, _popularity_half_life)
+
+			protected:
+				void MakeList() override
+				{
+					Register<Optional>("Streams", &_streams);
+					Register<Optional>("PopularStreamCount", &_popular_stream_count);
+					Register<Optional>("PopularityHalfLife", &_popularity_half_life);
+				}
+			};
+		}  // namespace orgn
+	}  // namespace vhost
+}  // namespace cfg
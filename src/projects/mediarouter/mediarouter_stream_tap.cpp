@@ -9,6 +9,8 @@
 
 #include "mediarouter_stream_tap.h"
 
+#include "mediarouter_private.h"
+
 std::shared_ptr<MediaRouterStreamTap> MediaRouterStreamTap::Create(size_t buffer_size)
 {
     return std::make_shared<MediaRouterStreamTap>(buffer_size);
@@ -51,6 +53,42 @@ bool MediaRouterStreamTap::DoesNeedPastData() const
 	return _need_past_data;
 }
 
+void MediaRouterStreamTap::SetReadyCallback(ReadyCallback callback)
+{
+    std::lock_guard lock_guard(_ready_callback_mutex);
+    _ready_callback = std::move(callback);
+}
+
+void MediaRouterStreamTap::NotifyReady()
+{
+    std::lock_guard lock_guard(_ready_callback_mutex);
+
+    if (_ready_callback != nullptr)
+    {
+        _ready_callback();
+    }
+}
+
+size_t MediaRouterStreamTap::DropBufferedPackets()
+{
+    size_t count = 0;
+
+    // Each packet is subtracted by the one who dequeues it (here or Pop())
+    while (true)
+    {
+        auto object = _buffer.Dequeue(0);
+        if (object.has_value() == false)
+        {
+            break;
+        }
+
+        _buffered_bytes -= object.value()->GetDataLength();
+        count++;
+    }
+
+    return count;
+}
+
 void MediaRouterStreamTap::Start()
 {
     _is_started = true;
@@ -60,8 +98,8 @@ void MediaRouterStreamTap::Start()
 void MediaRouterStreamTap::Stop()
 {
     _is_started = false;
+    DropBufferedPackets();
 	_buffer.Stop();
-    _buffer.Clear();
 }
 
 std::shared_ptr<MediaPacket> MediaRouterStreamTap::Pop(int timeout_in_msec)
@@ -74,6 +112,7 @@ std::shared_ptr<MediaPacket> MediaRouterStreamTap::Pop(int timeout_in_msec)
     auto object = _buffer.Dequeue(timeout_in_msec);
     if (object.has_value())
     {
+        _buffered_bytes -= object.value()->GetDataLength();
         return object.value();
     }
 
@@ -88,6 +127,19 @@ std::shared_ptr<info::Stream> MediaRouterStreamTap::GetStreamInfo() const
 void MediaRouterStreamTap::SetStreamInfo(const std::shared_ptr<info::Stream> &stream_info)
 {
     _tapped_stream_info = stream_info;
+
+    _has_video_track = false;
+    if (stream_info != nullptr)
+    {
+        for (const auto &[track_id, track] : stream_info->GetTracks())
+        {
+            if (track->GetMediaType() == cmn::MediaType::Video)
+            {
+                _has_video_track = true;
+                break;
+            }
+        }
+    }
 }
 
 void MediaRouterStreamTap::Destroy()
@@ -113,12 +165,42 @@ bool MediaRouterStreamTap::Push(const std::shared_ptr<MediaPacket> &media_packet
 		return true;
 	}
 
+    bool is_video_keyframe = (media_packet->GetMediaType() == cmn::MediaType::Video) && media_packet->IsKeyFrame();
+    auto packet_bytes = static_cast<int64_t>(media_packet->GetDataLength());
+
+    if ((_buffered_bytes + packet_bytes) > MEDIA_ROUTER_STREAM_TAP_MAX_BUFFER_BYTES)
+    {
+        // The consumer can't keep up. Dropping the oldest packets one by one would break the decoding,
+        // so the buffering restarts from the next keyframe.
+        auto dropped_count = DropBufferedPackets();
+
+        logtw("The buffer of the stream tap %u (%s) exceeded %d bytes, %zu packets are dropped",
+              _id, (_tapped_stream_info != nullptr) ? _tapped_stream_info->GetName().CStr() : "", MEDIA_ROUTER_STREAM_TAP_MAX_BUFFER_BYTES, dropped_count);
+
+        _drop_until_keyframe = _has_video_track;
+    }
+
+    if (_drop_until_keyframe)
+    {
+        if (is_video_keyframe == false)
+        {
+            return true;
+        }
+
+        _drop_until_keyframe = false;
+    }
+
+    _buffered_bytes += packet_bytes;
     _buffer.Enqueue(media_packet->ClonePacket());
 
+    NotifyReady();
+
     return true;
 }
 
 void MediaRouterStreamTap::SetState(State state)
 {
     _state = state;
+
+    NotifyReady();
 }
@@ -15,10 +15,18 @@
 #include <base/mediarouter/media_buffer.h>
 #include "mediarouter_application.h"
 
+// The maximum size of the packets buffered in a tap. If the consumer can't keep up,
+// the buffered packets are dropped and the buffering restarts from the next video keyframe.
+#define MEDIA_ROUTER_STREAM_TAP_MAX_BUFFER_BYTES (32 * 1024 * 1024)
+
 class MediaRouterStreamTap
 {
 friend class MediaRouteApplication;
 public:
+    // Called in the thread of MediaRouter when a packet is pushed or the state is changed, so it must not block
+    using ReadyCallback = std::function<void()>;
+
+    // buffer_size: The number of packets to warn that the buffer is growing
     static std::shared_ptr<MediaRouterStreamTap> Create(size_t buffer_size = 300);
 
     MediaRouterStreamTap(size_t buffer_size);
@@ -42,6 +50,10 @@ public:
 	void SetNeedPastData(bool need_past_data);
 	bool DoesNeedPastData() const;
 
+    // The consumer pops the packets when it is called, instead of waiting in Pop(timeout).
+    // It is not called after this returns with nullptr.
+    void SetReadyCallback(ReadyCallback callback);
+
     // If the stream is Tapped, MediaPacket will be popped from the buffer.
     // If the stream is not Tapped and the buffer is empty, nullptr will be returned immediately without waiting.
     std::shared_ptr<MediaPacket> Pop(int timeout_in_msec = 0);
@@ -55,6 +67,9 @@ private:
     bool Push(const std::shared_ptr<MediaPacket> &media_packet);
     void SetStreamInfo(const std::shared_ptr<info::Stream> &stream_info);
     void SetState(State state);
+    void NotifyReady();
+    // Drops the buffered packets, returns the number of dropped packets
+    size_t DropBufferedPackets();
 
     uint32_t IssueUniqueId();
 
@@ -68,5 +83,14 @@ private:
 
 	bool _need_past_data = false;
 
+    bool _has_video_track = false;
+
+    std::atomic<int64_t> _buffered_bytes{0};
+    // Set when the buffer overflows, accessed only by Push()
+    bool _drop_until_keyframe = false;
+
+    std::mutex _ready_callback_mutex;
+    ReadyCallback _ready_callback;
+
     uint32_t _id = 0;
 };
\ No newline at end of file
@@ -1,7 +1,10 @@
 #include "access_controller.h"
 
+#include <monitoring/monitoring.h>
 #include <orchestrator/orchestrator.h>
 
+#include "admission_webhooks/admission_webhooks_cache.h"
+
 #define OV_LOG_TAG "AccessController"
 
 AccessController::AccessController(ProviderType provider_type, const cfg::Server &server_config)
@@ -100,18 +103,17 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const SignedPol
 	return {AccessController::VerificationResult::Error, nullptr};
 }
 
-std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::InvokeAdmissionWebhook(
+AccessController::VerificationResult AccessController::GetAdmissionWebhookTarget(
 	const info::Host &host_info,
 	const std::shared_ptr<const ac::RequestInfo> &request_info,
 	std::optional<int> timeout_in_msec,
-	AdmissionWebhooks::Status::Code status,
-	AccessController::AdmissionWebhookInvokeResult result_callback)
+	AdmissionWebhookTarget *target)
 {
 	auto &webhooks_config = host_info.GetAdmissionWebhooks();
 	if (!webhooks_config.IsParsed())
 	{
 		// The vhost doesn't use the AdmissionWebhooks feature.
-		return {AccessController::VerificationResult::Off, nullptr};
+		return AccessController::VerificationResult::Off;
 	}
 
 	if (_provider_type != ProviderType::Unknown)
@@ -119,7 +121,7 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 		if (webhooks_config.IsEnabledProvider(_provider_type) == false)
 		{
 			// This provider turned off the AdmissionWebhooks function
-			return {AccessController::VerificationResult::Off, nullptr};
+			return AccessController::VerificationResult::Off;
 		}
 	}
 	else if (_publisher_type != PublisherType::Unknown)
@@ -127,34 +129,52 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 		if (webhooks_config.IsEnabledPublisher(_publisher_type) == false)
 		{
 			// This publisher turned off the AdmissionWebhooks function
-			return {AccessController::VerificationResult::Off, nullptr};
+			return AccessController::VerificationResult::Off;
 		}
 	}
 	else
 	{
 		logte("Could not resolve provider/publisher type: %s", request_info->GetRequestedUrl()->Host().CStr());
-		return {AccessController::VerificationResult::Error, nullptr};
+		return AccessController::VerificationResult::Error;
 	}
 
-	auto control_server_url_address = webhooks_config.GetControlServerUrl();
-	auto control_server_url			= ov::Url::Parse(control_server_url_address);
-	auto secret_key					= webhooks_config.GetSecretKey();
-	auto timeout_msec				= timeout_in_msec.value_or(webhooks_config.GetTimeoutMsec());
+	target->control_server_url_address = webhooks_config.GetControlServerUrl();
+	target->control_server_url		   = ov::Url::Parse(target->control_server_url_address);
+	target->secret_key				   = webhooks_config.GetSecretKey();
+	target->timeout_msec			   = timeout_in_msec.value_or(webhooks_config.GetTimeoutMsec());
 
-	if (control_server_url == nullptr)
+	if (target->control_server_url == nullptr)
 	{
-		logte("Could not parse control server url: %s", control_server_url_address.CStr());
-		return {AccessController::VerificationResult::Error, nullptr};
+		logte("Could not parse control server url: %s", target->control_server_url_address.CStr());
+		return AccessController::VerificationResult::Error;
+	}
+
+	return AccessController::VerificationResult::Pass;
+}
+
+std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::InvokeAdmissionWebhook(
+	const info::Host &host_info,
+	const std::shared_ptr<const ac::RequestInfo> &request_info,
+	std::optional<int> timeout_in_msec,
+	AdmissionWebhooks::Status::Code status,
+	AccessController::AdmissionWebhookInvokeResult result_callback)
+{
+	AdmissionWebhookTarget target;
+	auto result = GetAdmissionWebhookTarget(host_info, request_info, timeout_in_msec, &target);
+
+	if (result != AccessController::VerificationResult::Pass)
+	{
+		return {result, nullptr};
 	}
 
-	std::shared_ptr<AdmissionWebhooks> admission_webhooks;
+	ov::String direction;
 	if (_provider_type != ProviderType::Unknown)
 	{
-		admission_webhooks = AdmissionWebhooks::Query(_provider_type, control_server_url, timeout_msec, secret_key, request_info, status);
+		direction = ov::String::FormatString("incoming/%s", StringFromProviderType(_provider_type).CStr());
 	}
 	else if (_publisher_type != PublisherType::Unknown)
 	{
-		admission_webhooks = AdmissionWebhooks::Query(_publisher_type, control_server_url, timeout_msec, secret_key, request_info, status);
+		direction = ov::String::FormatString("outgoing/%s", StringFromPublisherType(_publisher_type).CStr());
 	}
 	else
 	{
@@ -162,6 +182,61 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 		return {AccessController::VerificationResult::Error, nullptr};
 	}
 
+	auto query = [&]() -> std::shared_ptr<const AdmissionWebhooks> {
+		if (_provider_type != ProviderType::Unknown)
+		{
+			return AdmissionWebhooks::Query(_provider_type, target.control_server_url, target.timeout_msec, target.secret_key, request_info, status);
+		}
+
+		return AdmissionWebhooks::Query(_publisher_type, target.control_server_url, target.timeout_msec, target.secret_key, request_info, status);
+	};
+
+	std::shared_ptr<const AdmissionWebhooks> admission_webhooks;
+	bool is_queried = true;
+
+	// Only the decisions for opening are cached, closing must always be notified
+	auto cache = (status == AdmissionWebhooks::Status::Code::OPENING) ? AdmissionWebhooksCache::GetCache(host_info) : nullptr;
+
+	if (cache != nullptr)
+	{
+		auto [lookup_result, cached_admission_webhooks] = cache->GetOrQuery(cache->MakeKey(direction, request_info), query);
+		admission_webhooks = cached_admission_webhooks;
+
+		auto host_metrics = mon::Monitoring::GetInstance()->GetHostMetrics(host_info);
+
+		switch (lookup_result)
+		{
+			case AdmissionWebhooksCache::LookupResult::Hit:
+				logtd("AdmissionWebhooks decision for %s is found in the cache", request_info->GetRequestedUrl()->ToUrlString().CStr());
+				is_queried = false;
+				if (host_metrics != nullptr)
+				{
+					host_metrics->IncreaseAdmissionWebhooksCacheHits();
+				}
+				break;
+
+			case AdmissionWebhooksCache::LookupResult::Coalesced:
+				logtd("AdmissionWebhooks decision for %s is shared by the same query in flight", request_info->GetRequestedUrl()->ToUrlString().CStr());
+				is_queried = false;
+				if (host_metrics != nullptr)
+				{
+					host_metrics->IncreaseAdmissionWebhooksCacheCoalesced();
+				}
+				break;
+
+			case AdmissionWebhooksCache::LookupResult::Miss:
+				if (host_metrics != nullptr)
+				{
+					host_metrics->IncreaseAdmissionWebhooksCacheMisses();
+				}
+				break;
+		}
+	}
+	else
+	{
+		admission_webhooks = query();
+	}
+
 	if (admission_webhooks == nullptr)
 	{
 		// Probably this doesn't happen
@@ -169,11 +244,12 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 		return {AccessController::VerificationResult::Error, nullptr};
 	}
 
-	if (result_callback != nullptr)
+	// result_callback is only called when the control server is actually queried
+	if (is_queried && (result_callback != nullptr))
 	{
 		auto client_address = request_info->GetClientAddress();
 		result_callback(
-			control_server_url_address,
+			target.control_server_url_address,
 			client_address,
 			admission_webhooks);
 	}
@@ -186,6 +262,48 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 	return {AccessController::VerificationResult::Pass, admission_webhooks};
 }
 
+AccessController::VerificationResult AccessController::InvokeAdmissionWebhookAsync(
+	const info::Host &host_info,
+	const std::shared_ptr<const ac::RequestInfo> &request_info,
+	std::optional<int> timeout_in_msec,
+	AdmissionWebhooks::Status::Code status,
+	AccessController::AdmissionWebhookInvokeResult result_callback)
+{
+	AdmissionWebhookTarget target;
+	auto result = GetAdmissionWebhookTarget(host_info, request_info, timeout_in_msec, &target);
+
+	if (result != AccessController::VerificationResult::Pass)
+	{
+		return result;
+	}
+
+	auto handler = [request_info, control_server_url_address = target.control_server_url_address, result_callback](const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks) {
+		if (result_callback != nullptr)
+		{
+			result_callback(
+				control_server_url_address,
+				request_info->GetClientAddress(),
+				admission_webhooks);
+		}
+	};
+
+	if (_provider_type != ProviderType::Unknown)
+	{
+		AdmissionWebhooks::QueryAsync(_provider_type, target.control_server_url, target.timeout_msec, target.secret_key, request_info, status, handler);
+	}
+	else if (_publisher_type != PublisherType::Unknown)
+	{
+		AdmissionWebhooks::QueryAsync(_publisher_type, target.control_server_url, target.timeout_msec, target.secret_key, request_info, status, handler);
+	}
+	else
+	{
+		logte("Provider type or publisher type must be set");
+		return AccessController::VerificationResult::Error;
+	}
+
+	return AccessController::VerificationResult::Pass;
+}
+
 std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::VerifyByWebhooks(const info::Host &host_info, const std::shared_ptr<const ac::RequestInfo> &request_info)
 {
 	return InvokeAdmissionWebhook(
@@ -221,12 +339,13 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 
 std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::SendCloseWebhooks(const info::Host &host_info, const std::shared_ptr<const ac::RequestInfo> &request_info)
 {
-	return InvokeAdmissionWebhook(
+	// Nobody waits for the response of the closing webhook, so the session can be closed without blocking
+	auto result = InvokeAdmissionWebhookAsync(
 		host_info,
 		request_info,
 		500,
 		AdmissionWebhooks::Status::Code::CLOSING,
-		[&request_info](const ov::String &control_server_url_address,
+		[request_info](const ov::String &control_server_url_address,
 						const std::shared_ptr<const ov::SocketAddress> &client_address,
 						const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks) {
 			logti("AdmissionWebhooks notified %s that client %s has closed the connection to %s. (Response : %s Elapsed : %u ms)",
@@ -236,6 +355,8 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 				  (admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::ALLOWED) ? "Allow" : "Reject",
 				  admission_webhooks->GetElapsedTime());
 		});
+
+	return {result, nullptr};
 }
 
 std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::SendCloseWebhooks(const std::shared_ptr<const ac::RequestInfo> &request_info)
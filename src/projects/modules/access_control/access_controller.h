@@ -48,6 +48,8 @@ public:
 	std::tuple<VerificationResult, std::shared_ptr<const AdmissionWebhooks>> VerifyByWebhooks(const std::shared_ptr<const ac::RequestInfo> &request_info);
 
 	// Send close webhooks to the control server based on the `host_info` provided from outside, such as vhost or host.
+	// The webhook is sent asynchronously, so the returned AdmissionWebhooks is always nullptr
+	// (Pass means the webhook is sent).
 	std::tuple<VerificationResult, std::shared_ptr<const AdmissionWebhooks>> SendCloseWebhooks(const info::Host &host_info, const std::shared_ptr<const ac::RequestInfo> &request_info);
 	// Send close webhooks to the control server based on the `request_info`'s host part, treating it as a domain.
 	std::tuple<VerificationResult, std::shared_ptr<const AdmissionWebhooks>> SendCloseWebhooks(const std::shared_ptr<const ac::RequestInfo> &request_info);
@@ -55,6 +57,21 @@ public:
 protected:
 	std::optional<info::Host> GetHostInfo(const std::shared_ptr<const ac::RequestInfo> &request_info);
 
+	struct AdmissionWebhookTarget
+	{
+		ov::String control_server_url_address;
+		std::shared_ptr<ov::Url> control_server_url;
+		ov::String secret_key;
+		int timeout_msec = 0;
+	};
+
+	// Returns Pass if the AdmissionWebhooks should be invoked with the `target`
+	VerificationResult GetAdmissionWebhookTarget(
+		const info::Host &host_info,
+		const std::shared_ptr<const ac::RequestInfo> &request_info,
+		std::optional<int> timeout_msec,
+		AdmissionWebhookTarget *target);
+
 	std::tuple<VerificationResult, std::shared_ptr<const AdmissionWebhooks>> InvokeAdmissionWebhook(
 		const info::Host &host_info,
 		const std::shared_ptr<const ac::RequestInfo> &request_info,
@@ -62,6 +79,15 @@ protected:
 		AdmissionWebhooks::Status::Code status,
 		AdmissionWebhookInvokeResult result_callback);
 
+	// Doesn't wait for the response of the control server, `result_callback` is called when the response is received.
+	// Returns Pass if the webhook is sent.
+	VerificationResult InvokeAdmissionWebhookAsync(
+		const info::Host &host_info,
+		const std::shared_ptr<const ac::RequestInfo> &request_info,
+		std::optional<int> timeout_msec,
+		AdmissionWebhooks::Status::Code status,
+		AdmissionWebhookInvokeResult result_callback);
+
 private:
 	const ProviderType _provider_type;
 	const PublisherType _publisher_type;
@@ -1,6 +1,6 @@
 #include "admission_webhooks.h"
 
-#include <modules/http/client/http_client.h>
+#include <modules/http/client/webhook_client.h>
 
 std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provider,
 															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
@@ -42,6 +42,44 @@ std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(PublisherType publis
 	return hooks;
 }
 
+void AdmissionWebhooks::QueryAsync(ProviderType provider,
+								   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+								   const ov::String secret_key,
+								   const std::shared_ptr<const ac::RequestInfo> &request_info,
+								   const Status::Code status,
+								   CompletionHandler handler)
+{
+	auto hooks = std::make_shared<AdmissionWebhooks>();
+
+	hooks->_provider_type = provider;
+	hooks->_control_server_url = control_server_url;
+	hooks->_timeout_msec = timeout_msec;
+	hooks->_secret_key = secret_key;
+	hooks->_request_info = request_info;
+	hooks->_status = status;
+
+	RunAsync(hooks, handler);
+}
+
+void AdmissionWebhooks::QueryAsync(PublisherType publisher,
+								   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+								   const ov::String secret_key,
+								   const std::shared_ptr<const ac::RequestInfo> &request_info,
+								   const Status::Code status,
+								   CompletionHandler handler)
+{
+	auto hooks = std::make_shared<AdmissionWebhooks>();
+
+	hooks->_publisher_type = publisher;
+	hooks->_control_server_url = control_server_url;
+	hooks->_timeout_msec = timeout_msec;
+	hooks->_secret_key = secret_key;
+	hooks->_request_info = request_info;
+	hooks->_status = status;
+
+	RunAsync(hooks, handler);
+}
+
 AdmissionWebhooks::ErrCode AdmissionWebhooks::GetErrCode() const
 {
 	return _err_code;
@@ -54,7 +92,7 @@ ov::String AdmissionWebhooks::GetErrReason() const
 
 std::shared_ptr<ov::Url> AdmissionWebhooks::GetNewURL() const
 {
-	return _new_url;
+	return (_new_url != nullptr) ? _new_url->Clone() : nullptr;
 }
 
 uint64_t AdmissionWebhooks::GetLifetime() const
@@ -62,6 +100,11 @@ uint64_t AdmissionWebhooks::GetLifetime() const
 	return _lifetime;
 }
 
+std::optional<uint64_t> AdmissionWebhooks::GetCacheTtl() const
+{
+	return _cache_ttl;
+}
+
 uint64_t AdmissionWebhooks::GetElapsedTime() const
 {
 	return _elapsed_ms;
@@ -180,12 +223,13 @@ void AdmissionWebhooks::ParseResponse(const std::shared_ptr<ov::Data> &data)
 
 	/*
 	Required : "allowed"
-	Optional : "new_url", "lifetime", "reason"
+	Optional : "new_url", "lifetime", "reason", "cache_ttl"
 
 	{
 		"allowed": true,
 		"new_url": "scheme://host[:port]/app/stream/file?query=value&query2=value2",
 		"lifetime": seconds   // 0 : infinite
+		"cache_ttl": milliseconds   // 0 : not cached
 	}
 
 	{
@@ -216,6 +260,7 @@ void AdmissionWebhooks::ParseResponse(const std::shared_ptr<ov::Data> &data)
 	Json::Value &jv_new_url = object.GetJsonValue()["new_url"];
 	Json::Value &jv_lifetime = object.GetJsonValue()["lifetime"];
 	Json::Value &jv_reason = object.GetJsonValue()["reason"];
+	Json::Value &jv_cache_ttl = object.GetJsonValue()["cache_ttl"];
 
 	if (jv_new_url.isNull() == false)
 	{
@@ -241,16 +286,24 @@ void AdmissionWebhooks::ParseResponse(const std::shared_ptr<ov::Data> &data)
 		}
 	}
 
+	if (jv_cache_ttl.isNull() == false)
+	{
+		if (jv_cache_ttl.isUInt64())
+		{
+			_cache_ttl = jv_cache_ttl.asUInt64();
+		}
+	}
+
 	SetError(_allowed ? ErrCode::ALLOWED : ErrCode::DENIED, _err_reason);
 }
 
-void AdmissionWebhooks::Run()
+bool AdmissionWebhooks::MakeRequest(http::clnt::WebhookRequest *request)
 {
 	auto body = MakeMessageBody();
 	if (body.IsEmpty())
 	{
 		// Error
-		return;
+		return false;
 	}
 
 	// Set X-OME-Signature
@@ -259,47 +312,81 @@ void AdmissionWebhooks::Run()
 	{
 		// Error
 		SetError(ErrCode::INTERNAL_ERROR, ov::String::FormatString("Signature creation failed.(Method : HMAC(SHA1), Key : %s, Body length : %d", _secret_key.CStr(), body.GetLength()));
-		return;
+		return false;
 	}
 
 	auto signature_sha1_base64 = ov::Base64::Encode(md_sha1, true);
 
-	auto client = std::make_shared<http::clnt::HttpClient>();
-	client->SetMethod(http::Method::Post);
-	client->SetBlockingMode(ov::BlockingMode::Blocking);
-	client->SetConnectionTimeout(_timeout_msec);
-	client->SetRecvTimeout(_timeout_msec);
-	client->SetRequestHeader("X-OME-Signature", signature_sha1_base64);
-	client->SetRequestHeader("Content-Type", "application/json");
-	client->SetRequestHeader("Accept", "application/json");
-	client->SetRequestBody(body);
+	request->method = http::Method::Post;
+	request->url = _control_server_url->ToUrlString(true);
+	request->timeout_msec = _timeout_msec;
+	request->headers["X-OME-Signature"] = signature_sha1_base64;
+	request->headers["Content-Type"] = "application/json";
+	request->headers["Accept"] = "application/json";
+	request->body = body.ToData(false);
 
-	ov::StopWatch watch;
-	watch.Start();
+	return true;
+}
 
-	client->Request(_control_server_url->ToUrlString(true), [=](http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) {
-		_elapsed_ms = watch.Elapsed();
+void AdmissionWebhooks::HandleResponse(const std::shared_ptr<const http::clnt::WebhookResponse> &response)
+{
+	_elapsed_ms = response->elapsed_msec;
 
-		// A response was received from the server.
-		if (error == nullptr)
+	// A response was received from the server.
+	if (response->error == nullptr)
+	{
+		if (response->status_code == http::StatusCode::OK)
 		{
-			if (status_code == http::StatusCode::OK)
-			{
-				// Parsing response
-				ParseResponse(data);
-				return;
-			}
-			else
-			{
-				SetError(ErrCode::INVALID_STATUS_CODE, ov::String::FormatString("Control server responded with %d status code.", static_cast<uint16_t>(status_code)));
-				return;
-			}
+			// Parsing response
+			ParseResponse(response->body);
+			return;
 		}
 		else
 		{
-			// A connection error or an error that does not conform to the HTTP spec has occurred.
-			SetError(ErrCode::INTERNAL_ERROR, ov::String::FormatString("The HTTP client's request failed. (error code(%d) error message(%s)", error->GetCode(), error->GetMessage().CStr()));
+			SetError(ErrCode::INVALID_STATUS_CODE, ov::String::FormatString("Control server responded with %d status code.", static_cast<uint16_t>(response->status_code)));
 			return;
 		}
+	}
+	else
+	{
+		// A connection error or an error that does not conform to the HTTP spec has occurred.
+		SetError(ErrCode::INTERNAL_ERROR, ov::String::FormatString("The HTTP client's request failed. (error code(%d) error message(%s)", response->error->GetCode(), response->error->GetMessage().CStr()));
+		return;
+	}
+}
+
+void AdmissionWebhooks::Run()
+{
+	http::clnt::WebhookRequest request;
+
+	if (MakeRequest(&request) == false)
+	{
+		return;
+	}
+
+	HandleResponse(http::clnt::WebhookClient::GetInstance()->Send(request));
+}
+
+void AdmissionWebhooks::RunAsync(const std::shared_ptr<AdmissionWebhooks> &hooks, CompletionHandler handler)
+{
+	http::clnt::WebhookRequest request;
+
+	if (hooks->MakeRequest(&request) == false)
+	{
+		if (handler != nullptr)
+		{
+			handler(hooks);
+		}
+
+		return;
+	}
+
+	http::clnt::WebhookClient::GetInstance()->SendAsync(request, [hooks, handler](const std::shared_ptr<const http::clnt::WebhookResponse> &response) {
+		hooks->HandleResponse(response);
+
+		if (handler != nullptr)
+		{
+			handler(hooks);
+		}
 	});
 }
@@ -5,6 +5,12 @@
 #include <base/ovsocket/socket_address.h>
 #include "../request_info.h"
 
+namespace http::clnt
+{
+	struct WebhookRequest;
+	struct WebhookResponse;
+}  // namespace http::clnt
+
 class AdmissionWebhooks
 {
 public:
@@ -41,6 +47,8 @@ public:
 		};
 	};
 
+	using CompletionHandler = std::function<void(const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks)>;
+
 	static std::shared_ptr<AdmissionWebhooks> Query(ProviderType provider,
 													const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
 													const ov::String secret_key,
@@ -53,14 +61,35 @@ public:
 													const std::shared_ptr<const ac::RequestInfo> &request_info,
 													const Status::Code status);
 
+	// The handler is called on the thread of the webhook client, or on the calling thread if the request could not be made
+	static void QueryAsync(ProviderType provider,
+						   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+						   const ov::String secret_key,
+						   const std::shared_ptr<const ac::RequestInfo> &request_info,
+						   const Status::Code status,
+						   CompletionHandler handler);
+
+	static void QueryAsync(PublisherType publisher,
+						   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+						   const ov::String secret_key,
+						   const std::shared_ptr<const ac::RequestInfo> &request_info,
+						   const Status::Code status,
+						   CompletionHandler handler);
+
 	ErrCode GetErrCode() const;
 	ov::String GetErrReason() const;
+	// Returns a copy, because the decision can be shared by sessions through AdmissionWebhooksCache
 	std::shared_ptr<ov::Url> GetNewURL() const;
 	uint64_t GetLifetime() const;
+	// How long the control server allows the decision to be cached (milliseconds)
+	std::optional<uint64_t> GetCacheTtl() const;
 	uint64_t GetElapsedTime() const;
 	
 private:
 	void Run();
+	static void RunAsync(const std::shared_ptr<AdmissionWebhooks> &hooks, CompletionHandler handler);
+	bool MakeRequest(http::clnt::WebhookRequest *request);
+	void HandleResponse(const std::shared_ptr<const http::clnt::WebhookResponse> &response);
 	ov::String MakeMessageBody();
 	void SetError(ErrCode code, ov::String reason);
 
@@ -82,4 +111,5 @@ private:
 	ov::String _err_reason;
 	std::shared_ptr<ov::Url> _new_url = nullptr;
 	uint64_t _lifetime = 0;
+	std::optional<uint64_t> _cache_ttl;
 };
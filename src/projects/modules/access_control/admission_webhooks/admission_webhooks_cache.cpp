@@ -0,0 +1,246 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "admission_webhooks_cache.h"
+
+#include <arpa/inet.h>
+
+#define OV_LOG_TAG "AdmissionWebhooks"
+
+std::shared_ptr<AdmissionWebhooksCache> AdmissionWebhooksCache::GetCache(const info::Host &host_info)
+{
+	static std::mutex cache_map_mutex;
+	static std::map<info::host_id_t, std::shared_ptr<AdmissionWebhooksCache>> cache_map;
+
+	auto &cache_config = host_info.GetAdmissionWebhooks().GetCache();
+
+	if (cache_config.IsParsed() == false)
+	{
+		return nullptr;
+	}
+
+	std::lock_guard lock_guard(cache_map_mutex);
+
+	auto &cache = cache_map[host_info.GetId()];
+
+	if (cache == nullptr)
+	{
+		logti("AdmissionWebhooks cache is enabled for %s (max entries: %d, TTL: %d ms, negative TTL: %d ms)",
+			  host_info.GetName().CStr(),
+			  cache_config.GetMaxEntries(), cache_config.GetTtlMsec(), cache_config.GetNegativeTtlMsec());
+
+		cache = std::make_shared<AdmissionWebhooksCache>(cache_config);
+	}
+
+	return cache;
+}
+
+AdmissionWebhooksCache::AdmissionWebhooksCache(const cfg::vhost::sig::AdmissionWebhooksCache &config)
+	: _config(config)
+{
+}
+
+ov::String AdmissionWebhooksCache::NormalizeUrl(const std::shared_ptr<const ov::Url> &url)
+{
+	if (url == nullptr)
+	{
+		return "";
+	}
+
+	ov::String normalized = ov::String::FormatString(
+		"%s://%s:%u%s",
+		url->Scheme().LowerCaseString().CStr(),
+		url->Host().LowerCaseString().CStr(),
+		url->Port(),
+		url->Path().CStr());
+
+	// QueryMap() is sorted by the key, so the order of the query string doesn't matter
+	char separator = '?';
+
+	for (const auto &[key, value] : url->QueryMap())
+	{
+		normalized.AppendFormat("%c%s=%s", separator, key.CStr(), value.CStr());
+		separator = '&';
+	}
+
+	return normalized;
+}
+
+ov::String AdmissionWebhooksCache::GetClientNetwork(const std::shared_ptr<const ac::RequestInfo> &request_info) const
+{
+	ov::String ip_address;
+
+	auto real_ip = request_info->FindRealIP();
+
+	if (real_ip.has_value())
+	{
+		ip_address = real_ip.value();
+	}
+	else
+	{
+		auto client_address = request_info->GetClientAddress();
+
+		if (client_address == nullptr)
+		{
+			return "";
+		}
+
+		ip_address = client_address->GetIpAddress();
+	}
+
+	uint8_t address[sizeof(in6_addr)];
+	int family = (ip_address.IndexOf(':') >= 0) ? AF_INET6 : AF_INET;
+
+	if (::inet_pton(family, ip_address.CStr(), address) != 1)
+	{
+		// Use the address as is
+		return ip_address;
+	}
+
+	int address_length = (family == AF_INET6) ? sizeof(in6_addr) : sizeof(in_addr);
+	int prefix_length = (family == AF_INET6) ? _config.GetIPv6PrefixLength() : _config.GetIPv4PrefixLength();
+	prefix_length = std::clamp(prefix_length, 0, address_length * 8);
+
+	// Clear the host bits
+	for (int index = 0; index < address_length; index++)
+	{
+		int bits = std::clamp(prefix_length - (index * 8), 0, 8);
+		address[index] &= static_cast<uint8_t>(0xFF00 >> bits);
+	}
+
+	char network[INET6_ADDRSTRLEN];
+
+	if (::inet_ntop(family, address, network, sizeof(network)) == nullptr)
+	{
+		return ip_address;
+	}
+
+	return ov::String::FormatString("%s/%d", network, prefix_length);
+}
+
+ov::String AdmissionWebhooksCache::MakeKey(const ov::String &direction, const std::shared_ptr<const ac::RequestInfo> &request_info) const
+{
+	return ov::String::FormatString(
+		"%s\n%s\n%s\n%s",
+		direction.CStr(),
+		NormalizeUrl(request_info->GetRequestedUrl()).CStr(),
+		NormalizeUrl(request_info->GetBackendUrl()).CStr(),
+		GetClientNetwork(request_info).CStr());
+}
+
+std::tuple<AdmissionWebhooksCache::LookupResult, std::shared_ptr<const AdmissionWebhooks>> AdmissionWebhooksCache::GetOrQuery(const ov::String &key, const QueryFunction &query)
+{
+	std::promise<std::shared_ptr<const AdmissionWebhooks>> promise;
+	uint64_t entry_id;
+
+	{
+		std::unique_lock lock(_mutex);
+
+		auto item = _entry_map.find(key);
+
+		if (item != _entry_map.end())
+		{
+			auto &entry = item->second;
+
+			if (entry.is_pending)
+			{
+				// Wait for the query in flight without the lock
+				auto result = entry.result;
+				lock.unlock();
+
+				return {LookupResult::Coalesced, result.get()};
+			}
+
+			if (entry.expire_time > std::chrono::steady_clock::now())
+			{
+				_lru_list.splice(_lru_list.begin(), _lru_list, entry.lru_iterator);
+
+				return {LookupResult::Hit, entry.result.get()};
+			}
+
+			EraseEntry(item);
+		}
+
+		entry_id = ++_last_entry_id;
+
+		_lru_list.push_front(key);
+		_entry_map.emplace(key, Entry{entry_id, true, promise.get_future().share(), {}, _lru_list.begin()});
+
+		EvictIfNeeded();
+	}
+
+	auto result = query();
+	promise.set_value(result);
+
+	auto ttl = GetTtl(result);
+
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		auto item = _entry_map.find(key);
+
+		// The entry may have been evicted (and created again by another query) while querying
+		if ((item != _entry_map.end()) && (item->second.id == entry_id))
+		{
+			if (ttl.count() > 0)
+			{
+				item->second.is_pending = false;
+				item->second.expire_time = std::chrono::steady_clock::now() + ttl;
+			}
+			else
+			{
+				EraseEntry(item);
+			}
+		}
+	}
+
+	return {LookupResult::Miss, result};
+}
+
+std::chrono::milliseconds AdmissionWebhooksCache::GetTtl(const std::shared_ptr<const AdmissionWebhooks> &result) const
+{
+	if (result == nullptr)
+	{
+		return std::chrono::milliseconds(0);
+	}
+
+	auto cache_ttl = result->GetCacheTtl();
+
+	switch (result->GetErrCode())
+	{
+		case AdmissionWebhooks::ErrCode::ALLOWED:
+			return std::chrono::milliseconds(cache_ttl.value_or(std::max(_config.GetTtlMsec(), 0)));
+
+		case AdmissionWebhooks::ErrCode::DENIED:
+			return std::chrono::milliseconds(cache_ttl.value_or(std::max(_config.GetNegativeTtlMsec(), 0)));
+
+		default:
+			// Ask the control server again for the next client
+			return std::chrono::milliseconds(0);
+	}
+}
+
+void AdmissionWebhooksCache::EraseEntry(std::unordered_map<ov::String, Entry>::iterator item)
+{
+	_lru_list.erase(item->second.lru_iterator);
+	_entry_map.erase(item);
+}
+
+void AdmissionWebhooksCache::EvictIfNeeded()
+{
+	auto max_entries = static_cast<size_t>(std::max(_config.GetMaxEntries(), 1));
+
+	while (_entry_map.size() > max_entries)
+	{
+		// The waiters of a pending entry hold the shared_future, so it can be evicted too
+		auto item = _entry_map.find(_lru_list.back());
+
+		OV_ASSERT2(item != _entry_map.end());
+
+		EraseEntry(item);
+	}
+}
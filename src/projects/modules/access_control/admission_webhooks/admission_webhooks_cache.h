@@ -0,0 +1,78 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/host.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <future>
+#include <list>
+
+#include "admission_webhooks.h"
+
+// Caches the decisions of the control server, so that the clients presenting the same URL
+// from the same network don't query the control server again until the TTL expires.
+//
+// - Allowed decisions are cached for "cache_ttl" of the response (or <TTL>)
+// - Denied decisions are cached for "cache_ttl" of the response (or <NegativeTTL>)
+// - Errors (timeout, invalid response, ...) are not cached
+// - Concurrent identical queries are merged into one query (singleflight)
+class AdmissionWebhooksCache
+{
+public:
+	enum class LookupResult
+	{
+		// The decision was in the cache
+		Hit,
+		// The control server was queried
+		Miss,
+		// Waited for the identical query in flight
+		Coalesced
+	};
+
+	using QueryFunction = std::function<std::shared_ptr<const AdmissionWebhooks>()>;
+
+	// Returns nullptr if the host doesn't use the cache
+	static std::shared_ptr<AdmissionWebhooksCache> GetCache(const info::Host &host_info);
+
+	AdmissionWebhooksCache(const cfg::vhost::sig::AdmissionWebhooksCache &config);
+
+	// `direction` distinguishes the providers/publishers
+	ov::String MakeKey(const ov::String &direction, const std::shared_ptr<const ac::RequestInfo> &request_info) const;
+
+	// Returns the cached decision, or calls `query` and caches the result
+	std::tuple<LookupResult, std::shared_ptr<const AdmissionWebhooks>> GetOrQuery(const ov::String &key, const QueryFunction &query);
+
+private:
+	struct Entry
+	{
+		uint64_t id;
+		bool is_pending = true;
+		std::shared_future<std::shared_ptr<const AdmissionWebhooks>> result;
+		std::chrono::steady_clock::time_point expire_time;
+		// Position in _lru_list
+		std::list<ov::String>::iterator lru_iterator;
+	};
+
+	std::chrono::milliseconds GetTtl(const std::shared_ptr<const AdmissionWebhooks> &result) const;
+
+	static ov::String NormalizeUrl(const std::shared_ptr<const ov::Url> &url);
+	ov::String GetClientNetwork(const std::shared_ptr<const ac::RequestInfo> &request_info) const;
+
+	// Must be called with _mutex locked
+	void EraseEntry(std::unordered_map<ov::String, Entry>::iterator item);
+	void EvictIfNeeded();
+
+	const cfg::vhost::sig::AdmissionWebhooksCache _config;
+
+	mutable std::mutex _mutex;
+	std::unordered_map<ov::String, Entry> _entry_map;
+	// The most recently used key is in the front
+	std::list<ov::String> _lru_list;
+	uint64_t _last_entry_id = 0;
+};
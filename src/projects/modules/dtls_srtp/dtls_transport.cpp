@@ -1,15 +1,80 @@
 #include "dtls_transport.h"
 
+#include <monitoring/gauge_registry.h>
+#include <monitoring/histogram_registry.h>
+
 #include <algorithm>
 #include <utility>
 
 #define OV_LOG_TAG "DTLS"
 
+// The number of threads that process the DTLS handshakes
+#define DTLS_HANDSHAKE_WORKER_COUNT 4
+// The maximum number of DTLS records waiting for each worker.
+// The records over the limit are dropped, and the peer retransmits them.
+#define DTLS_HANDSHAKE_MAX_QUEUE_SIZE_PER_WORKER 1024
+// Logs the statistics every N handshakes
+#define DTLS_HANDSHAKE_STATS_LOG_INTERVAL 1000
+
+namespace
+{
+	// Runs the DTLS handshakes (and the other DTLS records) outside of the threads that deliver the ICE packets,
+	// so that the ECDHE/ECDSA operations of the joining sessions don't delay the media of the connected sessions.
+	// The records of a DtlsTransport are processed in the order they are received.
+	//
+	// The queue depth gauge is registered while the pool exists.
+	struct HandshakeWorkerPool
+	{
+		HandshakeWorkerPool()
+		{
+			mon::GaugeRegistry::GetInstance()->Register(
+				"ome_dtls_handshake_queue_depth",
+				"Number of the DTLS records waiting for the handshake workers", "",
+				[this]() -> int64_t {
+					return worker_pool.GetQueueDepth();
+				});
+		}
+
+		~HandshakeWorkerPool()
+		{
+			// The getter refers to worker_pool, which is destroyed after this
+			mon::GaugeRegistry::GetInstance()->Unregister("ome_dtls_handshake_queue_depth");
+		}
+
+		ov::ShardedWorkerPool worker_pool{"DTLS", DTLS_HANDSHAKE_WORKER_COUNT, false, DTLS_HANDSHAKE_MAX_QUEUE_SIZE_PER_WORKER};
+	};
+
+	ov::ShardedWorkerPool &GetHandshakeWorkerPool()
+	{
+		static HandshakeWorkerPool handshake_worker_pool;
+
+		return handshake_worker_pool.worker_pool;
+	}
+
+	void ObserveHandshakeDuration(uint64_t duration_usec)
+	{
+		static auto handshake_duration = mon::HistogramRegistry::GetInstance()->Get(
+			"ome_dtls_handshake_duration_microseconds",
+			"Time taken from the first DTLS record to the completion of the handshake");
+
+		handshake_duration->Observe(duration_usec);
+
+		if ((handshake_duration->GetCount() % DTLS_HANDSHAKE_STATS_LOG_INTERVAL) == 0)
+		{
+			auto &worker_pool = GetHandshakeWorkerPool();
+
+			logti("DTLS handshakes - %s, queue depth: %zu, dropped records: %" PRIu64,
+				  handshake_duration->ToString("us").CStr(), worker_pool.GetQueueDepth(), worker_pool.GetDroppedCount());
+		}
+	}
+}  // namespace
+
 DtlsTransport::DtlsTransport()
 	: ov::Node(NodeType::Dtls)
 {
 	_state = SSL_NONE;
 	_peer_certificate_verified = false;
+	_worker_key = GetHandshakeWorkerPool().IssueKey();
 }
 
 DtlsTransport::~DtlsTransport()
@@ -20,6 +85,8 @@ bool DtlsTransport::Stop()
 {
 	std::lock_guard<std::mutex> lock(_tls_lock);
 
+	// The records already posted to the worker pool are ignored
+	_state = SSL_CLOSED;
 	_tls.Uninitialize();
 
 	return ov::Node::Stop();
@@ -35,6 +102,8 @@ void DtlsTransport::SetLocalCertificate(const std::shared_ptr<::Certificate> &ce
 			tls_context->SetVerify(SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT);
 
 			// SSL_CTX_set_tlsext_use_srtp() returns 1 on error, 0 on success
+			// The profiles are in the order of preference: OpenSSL selects the first one in this list that the client offers,
+			// so AEAD_AES_128_GCM (AES-NI + PCLMULQDQ in OpenSSL) is used whenever the client supports it
 			if (::SSL_CTX_set_tlsext_use_srtp(context, "SRTP_AEAD_AES_128_GCM:SRTP_AES128_CM_SHA1_80:SRTP_AES128_CM_SHA1_32"))
 			{
 				logte("SSL_CTX_set_tlsext_use_srtp failed");
@@ -127,6 +196,12 @@ bool DtlsTransport::ContinueSSL()
 	{
 		_state = SSL_CONNECTED;
 
+		if (_handshake_start_time.has_value())
+		{
+			auto duration = std::chrono::steady_clock::now() - _handshake_start_time.value();
+			ObserveHandshakeDuration(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+		}
+
 		_peer_certificate = _tls.GetPeerCertificate();
 
 		if (_peer_certificate == nullptr)
@@ -249,32 +324,19 @@ bool DtlsTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 		case SSL_CONNECTED: {
 			if (IsDtlsPacket(data))
 			{
-				std::lock_guard<std::mutex> lock(_tls_lock);
 				logtd("Receive DTLS packet");
-				// Packet을 Queue에 쌓는다.
-				SaveDtlsPacket(data);
 
-				if (_state == SSL_CONNECTING)
-				{
-					ContinueSSL();
-				}
-				else
-				{
-					char buffer[MAX_DTLS_PACKET_LEN];
+				// The handshake is CPU intensive, so it is processed on the worker pool
+				// to avoid delaying the packets of the other sessions on this thread
+				auto dtls_transport = GetSharedPtrAs<DtlsTransport>();
 
-					// SSL -> Read() -> TakeDtlsPacket() -> Decrypt -> buffer
-					[[maybe_unused]] int ssl_error = _tls.Read(buffer, sizeof(buffer), nullptr);
-
-					int pending = _tls.Pending();
-					if (pending >= 0)
-					{
-						logtd("Short DTLS read. Flushing %d bytes", pending);
-						_tls.FlushInput();
-					}
-
-					// TODO: Currently, SCTP is not supported, so there is no need to encrypt,
-					// and it will be developed if it supports data channels in the future.
-					logtd("Unknown dtls packet received (%d)", ssl_error);
+				if (GetHandshakeWorkerPool().Post(_worker_key, [dtls_transport, data]() {
+						dtls_transport->ProcessDtlsPacket(data);
+					}) == false)
+				{
+					// The peer will retransmit the record
+					logtd("DTLS handshake queue is full, the packet is dropped");
+					return false;
 				}
 
 				return true;
@@ -297,6 +359,50 @@ bool DtlsTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 	return false;
 }
 
+void DtlsTransport::ProcessDtlsPacket(const std::shared_ptr<const ov::Data> &data)
+{
+	std::lock_guard<std::mutex> lock(_tls_lock);
+
+	switch (_state)
+	{
+		case SSL_CONNECTING:
+			if (_handshake_start_time.has_value() == false)
+			{
+				_handshake_start_time = std::chrono::steady_clock::now();
+			}
+
+			// Packet을 Queue에 쌓는다.
+			SaveDtlsPacket(data);
+			ContinueSSL();
+			break;
+
+		case SSL_CONNECTED: {
+			SaveDtlsPacket(data);
+
+			char buffer[MAX_DTLS_PACKET_LEN];
+
+			// SSL -> Read() -> TakeDtlsPacket() -> Decrypt -> buffer
+			[[maybe_unused]] int ssl_error = _tls.Read(buffer, sizeof(buffer), nullptr);
+
+			int pending = _tls.Pending();
+			if (pending >= 0)
+			{
+				logtd("Short DTLS read. Flushing %d bytes", pending);
+				_tls.FlushInput();
+			}
+
+			// TODO: Currently, SCTP is not supported, so there is no need to encrypt,
+			// and it will be developed if it supports data channels in the future.
+			logtd("Unknown dtls packet received (%d)", ssl_error);
+			break;
+		}
+
+		default:
+			// The transport has been stopped (or failed) after the record was posted
+			break;
+	}
+}
+
 ssize_t DtlsTransport::Read(ov::Tls *tls, void *buffer, size_t length)
 {
 	std::shared_ptr<const ov::Data> data = TakeDtlsPacket();
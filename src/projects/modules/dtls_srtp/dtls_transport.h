@@ -55,6 +55,8 @@ protected:
 	bool VerifyPeerCertificate();
 
 private:
+	// Runs on the handshake worker pool
+	void ProcessDtlsPacket(const std::shared_ptr<const ov::Data> &data);
 	bool ContinueSSL();
 	bool IsDtlsPacket(const std::shared_ptr<const ov::Data> data);
 	bool IsRtpPacket(const std::shared_ptr<const ov::Data> data);
@@ -73,7 +75,8 @@ private:
 		SSL_CLOSED
 	};
 
-	SSLState _state;
+	// Read without _tls_lock by the SRTP fast path
+	std::atomic<SSLState> _state;
 	bool _peer_certificate_verified;
 	std::shared_ptr<info::Session> _session_info;
 	std::shared_ptr<IcePort> _ice_port;
@@ -92,5 +95,10 @@ private:
 
 	std::mutex _tls_lock;
 
+	// Key for the handshake worker pool
+	uint64_t _worker_key;
+	// Set when the first DTLS record of the handshake is received
+	std::optional<std::chrono::steady_clock::time_point> _handshake_start_time;
+
 	ov::Tls _tls;
 };
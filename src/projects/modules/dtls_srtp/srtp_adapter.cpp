@@ -92,6 +92,35 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 		return false;
 	}
 
+	std::lock_guard<std::mutex> lock(_session_lock);
+	return ProtectRtpInternal(data);
+}
+
+bool SrtpAdapter::ProtectRtp(const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	if(!_session)
+	{
+		return false;
+	}
+
+	bool result = true;
+
+	std::lock_guard<std::mutex> lock(_session_lock);
+	for(const auto &data : data_list)
+	{
+		if(ProtectRtpInternal(data) == false)
+		{
+			// Prevent the plain packet from being sent
+			data->SetLength(0);
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+bool SrtpAdapter::ProtectRtpInternal(const std::shared_ptr<ov::Data> &data)
+{
 	uint32_t need_len = data->GetLength() + _rtp_auth_tag_len;
 
 	if(need_len > data->GetCapacity())
@@ -102,18 +131,18 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 
 	auto buffer = data->GetWritableData();
 	int out_len = static_cast<int>(data->GetLength());
+	// SetLength() fills the extended area with zeros, so it must be called before the auth tag is written
 	data->SetLength(need_len);
 
-	// FOR DEBUG
-	auto byte_buffer = data->GetDataAs<uint8_t>();
-	uint8_t payload_type = byte_buffer[1] & 0x7F;
-	uint8_t red_payload_type = byte_buffer[12];
-	uint16_t seq = ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]);
-
-	std::lock_guard<std::mutex> lock(_session_lock);
 	int err = srtp_protect(_session, buffer, &out_len);
 	if(err != srtp_err_status_ok)
 	{
+		// FOR DEBUG
+		auto byte_buffer = data->GetDataAs<uint8_t>();
+		uint8_t payload_type = (data->GetLength() > 1) ? (byte_buffer[1] & 0x7F) : 0;
+		uint8_t red_payload_type = (data->GetLength() > 12) ? byte_buffer[12] : 0;
+		uint16_t seq = (data->GetLength() > 3) ? ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]) : 0;
+
 		logte("Failed to protect SRTP packet, err=%d, len=%d, seq=%u, payload_type=%d, red_payload_type=%d", err, out_len, seq, payload_type, red_payload_type);
 		return false;
 	}
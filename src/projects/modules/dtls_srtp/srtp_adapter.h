@@ -22,11 +22,17 @@ public:
 	bool	SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shared_ptr<ov::Data> key);
 
 	bool	ProtectRtp(std::shared_ptr<ov::Data> data);
+	// Protects the packets (e.g. the packets of a frame) in place while holding the session lock once.
+	// Returns false if any of the packets could not be protected, the failed packets are emptied.
+	bool	ProtectRtp(const std::vector<std::shared_ptr<ov::Data>> &data_list);
     bool	ProtectRtcp(std::shared_ptr<ov::Data> data);
 	bool	UnprotectRtp(const std::shared_ptr<ov::Data> &data);
     bool	UnprotectRtcp(const std::shared_ptr<ov::Data> &data);
 
 private:
+	// Must be called with _session_lock locked
+	bool	ProtectRtpInternal(const std::shared_ptr<ov::Data> &data);
+
 	std::mutex		_session_lock;
 	srtp_ctx_t_* 	_session;
 	
@@ -72,6 +72,39 @@ bool SrtpTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::sh
 	return SendDataToNextNode(data);
 }
 
+bool SrtpTransport::OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	if(from_node != NodeType::Rtp)
+	{
+		return Node::OnDataListReceivedFromPrevNode(from_node, data_list);
+	}
+
+	if(GetNodeState() != ov::Node::NodeState::Started)
+	{
+		logtd("Node has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	if(!_send_session)
+	{
+		return false;
+	}
+
+	bool result = _send_session->ProtectRtp(data_list);
+
+	// To DTLS transport
+	for(const auto &data : data_list)
+	{
+		// The packets that could not be protected are emptied
+		if(data->GetLength() > 0)
+		{
+			result = SendDataToNextNode(data) && result;
+		}
+	}
+
+	return result;
+}
+
 bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data)
 {
 	if(GetNodeState() != ov::Node::NodeState::Started)
@@ -9,6 +9,9 @@
 
 #define OV_LOG_TAG "FFmpegWriter"
 
+// The size of the buffer of the IO context for the output callbacks
+#define WRITER_IO_BUFFER_SIZE (64 * 1024)
+
 namespace ffmpeg
 {
 	std::shared_ptr<Writer> Writer::Create()
@@ -109,6 +112,31 @@ namespace ffmpeg
 		return _url;
 	}
 
+	void Writer::SetOutputCallback(WriteCallback write_callback, SeekCallback seek_callback)
+	{
+		_write_callback = std::move(write_callback);
+		_seek_callback = std::move(seek_callback);
+	}
+
+	int Writer::OnWrite(void *opaque, uint8_t *buf, int buf_size)
+	{
+		auto writer = static_cast<Writer *>(opaque);
+
+		return writer->_write_callback(buf, buf_size);
+	}
+
+	int64_t Writer::OnSeek(void *opaque, int64_t offset, int whence)
+	{
+		auto writer = static_cast<Writer *>(opaque);
+
+		if (writer->_seek_callback == nullptr)
+		{
+			return AVERROR(ESPIPE);
+		}
+
+		return writer->_seek_callback(offset, whence & ~AVSEEK_FORCE);
+	}
+
 	void Writer::SetTimestampMode(TimestampMode mode)
 	{
 		_timestamp_mode = mode;
@@ -275,7 +303,34 @@ namespace ffmpeg
 			}
 		}
 
-		if (!(av_format->oformat->flags & AVFMT_NOFILE))
+		if (_write_callback != nullptr)
+		{
+			auto buffer = static_cast<uint8_t *>(::av_malloc(WRITER_IO_BUFFER_SIZE));
+			if (buffer == nullptr)
+			{
+				SetState(WriterStateError);
+
+				logte("Could not allocate the IO buffer. url(%s)", av_format->url);
+
+				return false;
+			}
+
+			av_format->pb = ::avio_alloc_context(buffer, WRITER_IO_BUFFER_SIZE, 1, this, nullptr, OnWrite, (_seek_callback != nullptr) ? OnSeek : nullptr);
+			if (av_format->pb == nullptr)
+			{
+				::av_free(buffer);
+
+				SetState(WriterStateError);
+
+				logte("Could not allocate the IO context. url(%s)", av_format->url);
+
+				return false;
+			}
+
+			av_format->flags |= AVFMT_FLAG_CUSTOM_IO;
+			_custom_io = true;
+		}
+		else if (!(av_format->oformat->flags & AVFMT_NOFILE))
 		{
 			_last_packet_sent_time = std::chrono::high_resolution_clock::now();
 			int error = avio_open2(&av_format->pb, av_format->url, AVIO_FLAG_WRITE, &_interrupt_cb, nullptr);
@@ -550,7 +605,7 @@ namespace ffmpeg
 	{
 		std::lock_guard<std::shared_mutex> mlock(_av_format_lock);
 		// forward _need_to_flush and _need_to_close to lambda
-		_av_format.reset(av_format, [&need_to_flush = _need_to_flush, &need_to_close = _need_to_close](AVFormatContext *av_format_ptr) {
+		_av_format.reset(av_format, [&need_to_flush = _need_to_flush, &need_to_close = _need_to_close, &custom_io = _custom_io](AVFormatContext *av_format_ptr) {
 			if (av_format_ptr == nullptr)
 			{
 				return;
@@ -561,7 +616,14 @@ namespace ffmpeg
 				av_write_trailer(av_format_ptr);
 			}
 
-			if (need_to_close && av_format_ptr->pb != nullptr)
+			if (custom_io && av_format_ptr->pb != nullptr)
+			{
+				// The output is closed by the owner of the callbacks
+				avio_flush(av_format_ptr->pb);
+				av_freep(&av_format_ptr->pb->buffer);
+				avio_context_free(&av_format_ptr->pb);
+			}
+			else if (need_to_close && av_format_ptr->pb != nullptr)
 			{
 				avio_closep(&av_format_ptr->pb);
 			}
@@ -579,6 +641,7 @@ namespace ffmpeg
 		_av_format = nullptr;
 		_need_to_flush = false;
 		_need_to_close = false;
+		_custom_io = false;
 	}
 
 	std::pair<std::shared_ptr<AVStream>, std::shared_ptr<MediaTrack>> Writer::GetTrack(int32_t track_id, cmn::BitstreamFormat format) const
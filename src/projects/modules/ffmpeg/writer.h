@@ -30,6 +30,13 @@ namespace ffmpeg
 			WriterStateError = 5
 		};
 
+		// Receives the output of the muxer instead of the url opened by avio_open2() (e.g. to buffer a local file)
+		//
+		// Returns the number of bytes written, or a negative AVERROR code
+		using WriteCallback = std::function<int(const uint8_t *data, int size)>;
+		// whence: SEEK_SET, SEEK_CUR, SEEK_END or AVSEEK_SIZE. Returns the new position (or the size), or a negative AVERROR code
+		using SeekCallback = std::function<int64_t(int64_t offset, int whence)>;
+
 		static const char* WriterStateToString(WriterState state)
 		{
 			switch (state)
@@ -59,6 +66,9 @@ namespace ffmpeg
 		bool SetUrl(const ov::String url, const ov::String format = nullptr);
 		ov::String GetUrl();
 
+		// Must be called before Start(). The url is only used to name the output
+		void SetOutputCallback(WriteCallback write_callback, SeekCallback seek_callback);
+
 		bool Start();
 		bool Stop();
 
@@ -81,6 +91,9 @@ namespace ffmpeg
 		bool ToAVPacket(AVPacket &av_packet, const std::shared_ptr<AVStream> av_stream, const std::shared_ptr<MediaPacket> &media_packet, const std::shared_ptr<MediaTrack> &media_track, int64_t start_time);
 		std::shared_ptr<AVStream> CreateAVStream(const std::shared_ptr<MediaTrack> &media_track);
 
+		static int OnWrite(void *opaque, uint8_t *buf, int buf_size);
+		static int64_t OnSeek(void *opaque, int64_t offset, int whence);
+
 		std::atomic<WriterState> _state;
 
 		ov::String _url;
@@ -92,6 +105,11 @@ namespace ffmpeg
 		bool _need_to_flush = false;
 		bool _need_to_close = false;
 
+		WriteCallback _write_callback = nullptr;
+		SeekCallback _seek_callback = nullptr;
+		// pb is allocated with avio_alloc_context() for the callbacks
+		bool _custom_io = false;
+
 		// MediaTrackId -> AVStream, MediaTrack
 		bool AddMediaTrack(const std::shared_ptr<MediaTrack> &media_track, const std::shared_ptr<AVStream> &av_stream);
 		bool AddEventTrack(const std::shared_ptr<MediaTrack> &media_track, const std::shared_ptr<AVStream> &av_stream, cmn::BitstreamFormat format);
@@ -67,6 +67,16 @@ namespace http
 			return _recv_timeout_msec;
 		}
 
+		void HttpClient::SetKeepAlive(bool keep_alive)
+		{
+			_keep_alive = keep_alive;
+		}
+
+		bool HttpClient::IsKeepAlive() const
+		{
+			return _keep_alive;
+		}
+
 		void HttpClient::SetMethod(http::Method method)
 		{
 			_method = method;
@@ -195,9 +205,18 @@ namespace http
 		{
 			if (_requested)
 			{
-				return ov::Error::CreateError("HTTP", "It has already been requested before: %s", _url.CStr());
+				if ((_keep_alive == false) || (_blocking_mode != ov::BlockingMode::Blocking))
+				{
+					return ov::Error::CreateError("HTTP", "It has already been requested before: %s", _url.CStr());
+				}
+
+				// The previous request is completed (Request() is synchronous in blocking mode)
+				_requested = false;
 			}
 
+			_is_connection_reused = false;
+			ResetResponseVariables();
+
 			if (url.IsEmpty())
 			{
 				return ov::Error::CreateError("HTTP", "URL must not be empty");
@@ -239,12 +258,52 @@ namespace http
 				parsed_url->SetPort(port);
 			}
 
+			auto origin = ov::String::FormatString("%s://%s:%d", scheme.CStr(), parsed_url->Host().CStr(), port);
+
+			if (_socket != nullptr)
+			{
+				if ((origin == _connected_origin) && IsConnected())
+				{
+					_is_connection_reused = true;
+				}
+				else
+				{
+					// The kept-alive connection is for another origin
+					CloseConnection();
+				}
+			}
+
+			if (_is_connection_reused == false)
+			{
+				auto error = PrepareConnection(parsed_url, is_https, port, address);
+
+				if (error != nullptr)
+				{
+					return error;
+				}
+
+				_connected_origin = origin;
+			}
+
+			_url = url;
+			_parsed_url = parsed_url;
+
+			_request_header["Host"] =
+				use_default_port
+					? ov::String::FormatString("%s", _parsed_url->Host().CStr())
+					: ov::String::FormatString("%s:%d", _parsed_url->Host().CStr(), _parsed_url->Port());
+
+			return nullptr;
+		}
+
+		std::shared_ptr<const ov::Error> HttpClient::PrepareConnection(const std::shared_ptr<ov::Url> &parsed_url, bool is_https, int port, ov::SocketAddress *address)
+		{
 			auto host_port_string = ov::String::FormatString("%s:%d", parsed_url->Host().CStr(), port);
 			auto socket_address = ov::SocketAddress::CreateAndGetFirst(host_port_string);
 
 			if (socket_address.IsValid() == false)
 			{
-				return ov::Error::CreateError("HTTP", "Invalid address: %s, URL: %s", host_port_string.CStr(), url.CStr());
+				return ov::Error::CreateError("HTTP", "Invalid address: %s, URL: %s", host_port_string.CStr(), parsed_url->ToUrlString().CStr());
 			}
 
 			_socket = _socket_pool->AllocSocket(socket_address.GetFamily());
@@ -284,14 +343,6 @@ namespace http
 				*address = socket_address;
 			}
 
-			_url = url;
-			_parsed_url = parsed_url;
-
-			_request_header["Host"] =
-				use_default_port
-					? ov::String::FormatString("%s", _parsed_url->Host().CStr())
-					: ov::String::FormatString("%s:%d", _parsed_url->Host().CStr(), _parsed_url->Port());
-
 			return nullptr;
 		}
 
@@ -329,6 +380,11 @@ namespace http
 			{
 				_request_header["Content-Length"] = ov::Converter::ToString(_request_body->GetLength());
 			}
+			else
+			{
+				// Content-Length of the previous request on the kept-alive connection
+				_request_header.erase("Content-Length");
+			}
 
 			logtd("Request headers: total %zu item(s):", _request_header.size());
 
@@ -372,12 +428,20 @@ namespace http
 				OV_ASSERT2(_url.IsEmpty() == false);
 				OV_ASSERT2(_parsed_url != nullptr);
 
-				logtd("Request an URL: %s (address: %s)...", url.CStr(), address.ToString(false).CStr());
-
 				// Convert milliseconds to timeval
 				_socket->SetRecvTimeout(
 					{.tv_sec = _recv_timeout_msec / 1000,
-					 .tv_usec = _recv_timeout_msec % 1000});
+					 .tv_usec = (_recv_timeout_msec % 1000) * 1000});
+
+				if (_is_connection_reused)
+				{
+					logtd("Request an URL: %s (reuse the connection to %s)...", url.CStr(), _connected_origin.CStr());
+
+					OnConnected(nullptr);
+					return;
+				}
+
+				logtd("Request an URL: %s (address: %s)...", url.CStr(), address.ToString(false).CStr());
 
 				error = _socket->Connect(address, _connection_timeout_msec);
 
@@ -399,6 +463,28 @@ namespace http
 			HandleError(error);
 		}
 
+		bool HttpClient::IsConnectionReused() const
+		{
+			return _is_connection_reused;
+		}
+
+		bool HttpClient::IsConnected() const
+		{
+			auto socket = _socket;
+			auto tls_data = _tls_data;
+
+			return (socket != nullptr) &&
+				   (socket->GetState() == ov::SocketState::Connected) &&
+				   ((tls_data == nullptr) || (tls_data->GetState() == ov::TlsClientData::State::Connected));
+		}
+
+		void HttpClient::Close()
+		{
+			std::lock_guard lock_guard(_request_mutex);
+
+			CleanupVariables();
+		}
+
 		ov::String HttpClient::GetResponseHeader(const ov::String &key)
 		{
 			return _parser.GetHeader(key).value_or("");
@@ -501,7 +587,14 @@ namespace http
 				response_handler(_parser.GetStatusCode(), _response_body, error);
 			}
 
-			CleanupVariables();
+			if ((error == nullptr) && (need_to_callback == false) && CanReuseConnection())
+			{
+				CompleteRequest();
+			}
+			else
+			{
+				CleanupVariables();
+			}
 		}
 
 		std::shared_ptr<const ov::Error> HttpClient::ProcessChunk(const std::shared_ptr<const ov::Data> &data, size_t *processed_bytes)
@@ -746,6 +839,57 @@ namespace http
 			}
 		}
 
+		bool HttpClient::CanReuseConnection() const
+		{
+			if ((_keep_alive == false) || (_blocking_mode != ov::BlockingMode::Blocking) || (IsConnected() == false))
+			{
+				return false;
+			}
+
+			// The end of the response must be known, otherwise the remaining data will be mixed into the next response
+			bool is_completed =
+				(_response_body != nullptr) &&
+				((_is_chunked_transfer && (_chunk_parse_status == ChunkParseStatus::Completed)) ||
+				 ((_is_chunked_transfer == false) && _parser.HasContentLength() && (_response_body->GetLength() == _parser.GetContentLength())));
+
+			if (is_completed == false)
+			{
+				return false;
+			}
+
+			auto connection = _parser.GetHeader("Connection").value_or("").LowerCaseString();
+
+			if (_parser.GetHttpVersionAsNumber() < 1.1)
+			{
+				// HTTP/1.0 closes the connection by default
+				return connection == "keep-alive";
+			}
+
+			return connection != "close";
+		}
+
+		void HttpClient::ResetResponseVariables()
+		{
+			_parser = prot::h1::HttpResponseParser();
+
+			_is_chunked_transfer = false;
+			_chunk_parse_status = ChunkParseStatus::None;
+			_chunk_length = 0L;
+			_chunk_header.Clear();
+
+			_response_body = nullptr;
+		}
+
+		void HttpClient::CompleteRequest()
+		{
+			_url.Clear();
+			_parsed_url = nullptr;
+			_response_handler = nullptr;
+
+			// The body belongs to the request
+			_request_body = nullptr;
+		}
+
 		void HttpClient::CleanupVariables()
 		{
 			// Clean up variables
@@ -753,6 +897,13 @@ namespace http
 			_parsed_url = nullptr;
 			_response_handler = nullptr;
 
+			CloseConnection();
+		}
+
+		void HttpClient::CloseConnection()
+		{
+			_connected_origin.Clear();
+
 			OV_SAFE_RESET(
 				_tls_data, nullptr, {
 					_tls_data->SetIoCallback(nullptr);
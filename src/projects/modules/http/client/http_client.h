@@ -48,6 +48,11 @@ namespace http
 
 			void SetTimeout(int timeout_msec);
 
+			// Keeps the connection after the response is received, and reuses it for the next request
+			// to the same origin (scheme, host, port). Only works in blocking mode.
+			void SetKeepAlive(bool keep_alive);
+			bool IsKeepAlive() const;
+
 			void SetMethod(http::Method method);
 			http::Method GetMethod() const;
 
@@ -66,6 +71,13 @@ namespace http
 
 			void Request(const ov::String &url, ResponseHandler response_handler);
 
+			// Whether the last request was sent over a kept-alive connection
+			bool IsConnectionReused() const;
+			// Whether there is a kept-alive connection to reuse
+			bool IsConnected() const;
+			// Closes the kept-alive connection
+			void Close();
+
 			// Response headers (Headers received from HTTP server)
 			ov::String GetResponseHeader(const ov::String &key);
 			const std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaders() const;
@@ -108,6 +120,8 @@ namespace http
 
 		protected:
 			std::shared_ptr<const ov::Error> PrepareForRequest(const ov::String &url, ov::SocketAddress *address);
+			// Allocates a socket (and TLS) for a new connection
+			std::shared_ptr<const ov::Error> PrepareConnection(const std::shared_ptr<ov::Url> &parsed_url, bool is_https, int port, ov::SocketAddress *address);
 			std::shared_ptr<const ov::OpensslError> TryTlsConnect();
 			void SendRequestIfNeeded();
 			// Use this API when blocking mode
@@ -118,7 +132,13 @@ namespace http
 			bool SendData(const std::shared_ptr<const ov::Data> &data);
 
 			void PostProcess();
+			// Returns true if the kept-alive connection can be used for the next request
+			bool CanReuseConnection() const;
+			void ResetResponseVariables();
+			// Finishes the request without closing the connection
+			void CompleteRequest();
 			void CleanupVariables();
+			void CloseConnection();
 
 			void HandleError(std::shared_ptr<const ov::Error> error);
 
@@ -131,6 +151,8 @@ namespace http
 			// Default: 60 seconds
 			int _recv_timeout_msec = 60 * 1000;
 			http::Method _method = http::Method::Get;
+			bool _keep_alive = false;
+			bool _is_connection_reused = false;
 
 			// Related to chunked transfer
 			bool _is_chunked_transfer = false;
@@ -148,6 +170,8 @@ namespace http
 
 			ov::String _url;
 			std::shared_ptr<ov::Url> _parsed_url;
+			// scheme://host:port of the kept-alive connection
+			ov::String _connected_origin;
 			ResponseHandler _response_handler = nullptr;
 
 			std::shared_ptr<ov::Socket> _socket;
@@ -0,0 +1,369 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./webhook_client.h"
+
+#include <pthread.h>
+
+#include <future>
+#include <map>
+
+#include "./http_client_private.h"
+
+// The number of threads that run the requests of SendAsync()
+#define WEBHOOK_CLIENT_WORKER_COUNT 8
+// The maximum number of idle connections kept for each origin
+#define WEBHOOK_CLIENT_MAX_IDLE_CONNECTIONS_PER_ORIGIN 32
+// Many servers close an idle connection after 5 seconds (e.g. Node.js), so stop reusing it before that
+#define WEBHOOK_CLIENT_IDLE_TIMEOUT_MSEC 4000
+
+namespace http
+{
+	namespace clnt
+	{
+		WebhookClient::WebhookClient()
+		{
+			for (int index = 0; index < WEBHOOK_CLIENT_WORKER_COUNT; index++)
+			{
+				auto &thread = _worker_list.emplace_back(&WebhookClient::WorkerThread, this);
+				::pthread_setname_np(thread.native_handle(), ov::String::FormatString("Webhook%d", index).CStr());
+			}
+		}
+
+		WebhookClient::~WebhookClient()
+		{
+			{
+				std::lock_guard lock_guard(_task_queue_mutex);
+				_stop = true;
+			}
+
+			_task_queue_condition.notify_all();
+
+			for (auto &thread : _worker_list)
+			{
+				if (thread.joinable())
+				{
+					thread.join();
+				}
+			}
+
+			std::lock_guard lock_guard(_idle_connection_map_mutex);
+
+			for (auto &[origin, idle_connection_list] : _idle_connection_map)
+			{
+				for (auto &idle_connection : idle_connection_list)
+				{
+					idle_connection.client->Close();
+				}
+			}
+
+			_idle_connection_map.clear();
+		}
+
+		void WebhookClient::SendAsync(const WebhookRequest &request, WebhookCompletionHandler handler)
+		{
+			Task task{request, request.coalesce ? MakeCoalesceKey(request) : "", std::move(handler)};
+
+			if (Begin(task) == false)
+			{
+				return;
+			}
+
+			{
+				std::lock_guard lock_guard(_task_queue_mutex);
+				_task_queue.push_back(std::move(task));
+			}
+
+			_task_queue_condition.notify_one();
+		}
+
+		std::shared_ptr<const WebhookResponse> WebhookClient::Send(const WebhookRequest &request)
+		{
+			std::promise<std::shared_ptr<const WebhookResponse>> promise;
+			auto future = promise.get_future();
+
+			Task task{
+				request,
+				request.coalesce ? MakeCoalesceKey(request) : "",
+				[&promise](const std::shared_ptr<const WebhookResponse> &response) {
+					promise.set_value(response);
+				}};
+
+			if (Begin(task))
+			{
+				Complete(task, Execute(request));
+			}
+
+			return future.get();
+		}
+
+		bool WebhookClient::Begin(Task &task)
+		{
+			if (task.coalesce_key.IsEmpty())
+			{
+				return true;
+			}
+
+			std::lock_guard lock_guard(_in_flight_map_mutex);
+
+			auto item = _in_flight_map.find(task.coalesce_key);
+
+			if (item != _in_flight_map.end())
+			{
+				logtd("An identical request is in flight, waiting for its response: %s", task.request.url.CStr());
+				item->second.push_back(std::move(task.handler));
+				return false;
+			}
+
+			_in_flight_map[task.coalesce_key].push_back(std::move(task.handler));
+
+			return true;
+		}
+
+		void WebhookClient::Complete(const Task &task, const std::shared_ptr<const WebhookResponse> &response)
+		{
+			if (task.coalesce_key.IsEmpty())
+			{
+				if (task.handler != nullptr)
+				{
+					task.handler(response);
+				}
+
+				return;
+			}
+
+			std::vector<WebhookCompletionHandler> handler_list;
+
+			{
+				std::lock_guard lock_guard(_in_flight_map_mutex);
+
+				auto item = _in_flight_map.find(task.coalesce_key);
+
+				if (item != _in_flight_map.end())
+				{
+					handler_list = std::move(item->second);
+					_in_flight_map.erase(item);
+				}
+			}
+
+			for (auto &handler : handler_list)
+			{
+				if (handler != nullptr)
+				{
+					handler(response);
+				}
+			}
+		}
+
+		std::shared_ptr<const WebhookResponse> WebhookClient::Execute(const WebhookRequest &request)
+		{
+			auto origin = GetOrigin(request.url);
+
+			ov::StopWatch watch;
+			watch.Start();
+
+			auto client = AcquireConnection(origin);
+			auto response = Execute(request, client);
+
+			if (response->is_connection_reused &&
+				(response->status_code == StatusCode::Unknown) &&
+				(response->error == nullptr))
+			{
+				// The server closed the kept-alive connection before the request arrived, so try again with a new connection
+				logtd("The kept-alive connection to %s was closed by the server, retrying with a new connection", origin.CStr());
+
+				client = AcquireConnection("");
+				response = Execute(request, client);
+			}
+
+			ReleaseConnection(origin, client);
+
+			response->elapsed_msec = watch.Elapsed();
+
+			return response;
+		}
+
+		std::shared_ptr<WebhookResponse> WebhookClient::Execute(const WebhookRequest &request, const std::shared_ptr<HttpClient> &client)
+		{
+			auto response = std::make_shared<WebhookResponse>();
+
+			client->SetMethod(request.method);
+			client->SetConnectionTimeout(request.timeout_msec);
+			client->SetRecvTimeout(request.timeout_msec);
+
+			// Remove the headers of the previous request
+			auto &headers = client->GetRequestHeaders();
+			headers.clear();
+			headers["User-Agent"] = "OvenMediaEngine";
+			headers["Accept"] = "*/*";
+
+			for (const auto &[key, value] : request.headers)
+			{
+				headers[key] = value;
+			}
+
+			if (request.body != nullptr)
+			{
+				client->SetRequestBody(request.body);
+			}
+
+			client->Request(request.url, [&](StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) {
+				response->status_code = status_code;
+				response->body = data;
+				response->error = error;
+			});
+
+			response->is_connection_reused = client->IsConnectionReused();
+
+			return response;
+		}
+
+		std::shared_ptr<HttpClient> WebhookClient::AcquireConnection(const ov::String &origin)
+		{
+			if (origin.IsEmpty() == false)
+			{
+				std::lock_guard lock_guard(_idle_connection_map_mutex);
+
+				auto item = _idle_connection_map.find(origin);
+
+				if (item != _idle_connection_map.end())
+				{
+					auto &idle_connection_list = item->second;
+					auto expired_time = std::chrono::steady_clock::now() - std::chrono::milliseconds(WEBHOOK_CLIENT_IDLE_TIMEOUT_MSEC);
+
+					// The oldest connections are in the front
+					while ((idle_connection_list.empty() == false) && (idle_connection_list.front().idle_since < expired_time))
+					{
+						idle_connection_list.front().client->Close();
+						idle_connection_list.pop_front();
+					}
+
+					// Use the most recently used connection, which is the most likely to be alive
+					while (idle_connection_list.empty() == false)
+					{
+						auto client = std::move(idle_connection_list.back().client);
+						idle_connection_list.pop_back();
+
+						if (client->IsConnected())
+						{
+							return client;
+						}
+
+						client->Close();
+					}
+				}
+			}
+
+			auto client = std::make_shared<HttpClient>();
+
+			client->SetBlockingMode(ov::BlockingMode::Blocking);
+			client->SetKeepAlive(true);
+
+			return client;
+		}
+
+		void WebhookClient::ReleaseConnection(const ov::String &origin, const std::shared_ptr<HttpClient> &client)
+		{
+			if (origin.IsEmpty() || (client->IsConnected() == false))
+			{
+				// The connection was closed by HttpClient (error, "Connection: close", ...)
+				return;
+			}
+
+			std::lock_guard lock_guard(_idle_connection_map_mutex);
+
+			auto &idle_connection_list = _idle_connection_map[origin];
+
+			if (idle_connection_list.size() >= WEBHOOK_CLIENT_MAX_IDLE_CONNECTIONS_PER_ORIGIN)
+			{
+				client->Close();
+				return;
+			}
+
+			idle_connection_list.push_back({client, std::chrono::steady_clock::now()});
+		}
+
+		ov::String WebhookClient::GetOrigin(const ov::String &url)
+		{
+			auto parsed_url = ov::Url::Parse(url);
+
+			if (parsed_url == nullptr)
+			{
+				// HttpClient will report the error
+				return "";
+			}
+
+			auto scheme = parsed_url->Scheme().LowerCaseString();
+			auto port = parsed_url->Port();
+
+			if (port == 0)
+			{
+				port = (scheme == "https") ? 443 : 80;
+			}
+
+			return ov::String::FormatString("%s://%s:%d", scheme.CStr(), parsed_url->Host().CStr(), port);
+		}
+
+		ov::String WebhookClient::MakeCoalesceKey(const WebhookRequest &request)
+		{
+			ov::String key;
+
+			key.AppendFormat("%s %s\n", http::StringFromMethod(request.method, false).CStr(), request.url.CStr());
+
+			// Sort the headers so that the key doesn't depend on the order of the hash map
+			std::map<ov::String, ov::String> sorted_headers;
+
+			for (const auto &[name, value] : request.headers)
+			{
+				sorted_headers[name.LowerCaseString()] = value;
+			}
+
+			for (const auto &[name, value] : sorted_headers)
+			{
+				key.AppendFormat("%s: %s\n", name.CStr(), value.CStr());
+			}
+
+			key.Append("\n");
+
+			if (request.body != nullptr)
+			{
+				// ov::String is binary-safe
+				key.Append(request.body->GetDataAs<char>(), request.body->GetLength());
+			}
+
+			return key;
+		}
+
+		void WebhookClient::WorkerThread()
+		{
+			ov::logger::ThreadHelper thread_helper;
+
+			while (true)
+			{
+				Task task;
+
+				{
+					std::unique_lock lock(_task_queue_mutex);
+
+					_task_queue_condition.wait(lock, [this]() -> bool {
+						return _stop || (_task_queue.empty() == false);
+					});
+
+					if (_stop)
+					{
+						break;
+					}
+
+					task = std::move(_task_queue.front());
+					_task_queue.pop_front();
+				}
+
+				Complete(task, Execute(task.request));
+			}
+		}
+	}  // namespace clnt
+}  // namespace http
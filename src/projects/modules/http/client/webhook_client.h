@@ -0,0 +1,110 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+#include "./http_client.h"
+
+namespace http
+{
+	namespace clnt
+	{
+		struct WebhookRequest
+		{
+			http::Method method = http::Method::Post;
+			ov::String url;
+			http::HttpHeaderMap headers;
+			std::shared_ptr<const ov::Data> body;
+
+			// Used for both connection timeout and receive timeout
+			int timeout_msec = 10 * 1000;
+
+			// If true, identical requests (method, URL, headers and body) that are in flight share a single response
+			bool coalesce = false;
+		};
+
+		struct WebhookResponse
+		{
+			StatusCode status_code = StatusCode::Unknown;
+			std::shared_ptr<ov::Data> body;
+			std::shared_ptr<const ov::Error> error;
+
+			int64_t elapsed_msec = 0;
+			// Whether the request was sent over a kept-alive connection
+			bool is_connection_reused = false;
+		};
+
+		using WebhookCompletionHandler = std::function<void(const std::shared_ptr<const WebhookResponse> &response)>;
+
+		// A client shared by the webhooks (AdmissionWebhooks, TranscodeWebhook, Alert, ...)
+		//
+		// - Connections are kept alive and pooled per origin (scheme://host:port), so a burst of webhooks
+		//   doesn't create a new TCP/TLS connection for each request
+		// - SendAsync() runs the request on the worker threads, and calls the handler when it is completed
+		// - Send() runs the request on the calling thread using the same connection pool
+		class WebhookClient : public ov::Singleton<WebhookClient>
+		{
+		public:
+			WebhookClient();
+			~WebhookClient() override;
+
+			// The handler is called on a worker thread, so it must not block for a long time
+			void SendAsync(const WebhookRequest &request, WebhookCompletionHandler handler);
+			std::shared_ptr<const WebhookResponse> Send(const WebhookRequest &request);
+
+		private:
+			struct Task
+			{
+				WebhookRequest request;
+				// Empty if the request is not coalesced
+				ov::String coalesce_key;
+				WebhookCompletionHandler handler;
+			};
+
+			struct IdleConnection
+			{
+				std::shared_ptr<HttpClient> client;
+				std::chrono::steady_clock::time_point idle_since;
+			};
+
+			// Returns false if an identical request is already in flight (the handler will be called when it is completed)
+			bool Begin(Task &task);
+			void Complete(const Task &task, const std::shared_ptr<const WebhookResponse> &response);
+
+			std::shared_ptr<const WebhookResponse> Execute(const WebhookRequest &request);
+			std::shared_ptr<WebhookResponse> Execute(const WebhookRequest &request, const std::shared_ptr<HttpClient> &client);
+
+			std::shared_ptr<HttpClient> AcquireConnection(const ov::String &origin);
+			void ReleaseConnection(const ov::String &origin, const std::shared_ptr<HttpClient> &client);
+
+			static ov::String GetOrigin(const ov::String &url);
+			static ov::String MakeCoalesceKey(const WebhookRequest &request);
+
+			void WorkerThread();
+
+			std::vector<std::thread> _worker_list;
+			bool _stop = false;
+			std::deque<Task> _task_queue;
+			std::mutex _task_queue_mutex;
+			std::condition_variable _task_queue_condition;
+
+			// key: coalesce key, value: handlers waiting for the response
+			std::unordered_map<ov::String, std::vector<WebhookCompletionHandler>> _in_flight_map;
+			std::mutex _in_flight_map_mutex;
+
+			// key: origin
+			std::unordered_map<ov::String, std::deque<IdleConnection>> _idle_connection_map;
+			std::mutex _idle_connection_map_mutex;
+		};
+	}  // namespace clnt
+}  // namespace http
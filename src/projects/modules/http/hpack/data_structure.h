@@ -30,21 +30,16 @@ namespace http
 				_value = value;
 			}
 
-			ov::String GetName() const
+			const ov::String &GetName() const
 			{
 				return _name;
 			}
 
-			ov::String GetValue() const
+			const ov::String &GetValue() const
 			{
 				return _value;
 			}
 
-			ov::String GetKey() const
-			{
-				return (_name + _value);
-			}
-
 			size_t GetSize() const
 			{
 				// https://www.rfc-editor.org/rfc/rfc7541.html#section-4.1
@@ -8,7 +8,6 @@
 //==============================================================================
 #include "decoder.h"
 
-#include <base/ovlibrary/bit_reader.h>
 #include "huffman_codec.h"
 #include "hpack_private.h"
 
@@ -19,110 +18,78 @@ namespace http
 		bool Decoder::Decode(const std::shared_ptr<const ov::Data> &data, std::vector<HeaderField> &header_fields)
 		{
 			std::lock_guard<std::mutex> lock(_decoder_lock);
-			auto reader = std::make_shared<BitReader>(data->GetDataAs<uint8_t>(), data->GetLength());
 
-			while (reader->BytesRemained() > 0)
+			auto buffer = data->GetDataAs<uint8_t>();
+			Reader reader{buffer, buffer + data->GetLength()};
+
+			while (reader.GetRemained() > 0)
 			{
-				// Check if the next is the Indexed Header Field
-				// Start with 0b1
-				auto b = reader->ReadBit();
-				if (b == 1)
-				{
-					if (DecodeIndexedHeaderField(reader, header_fields) == false)
-					{
-						return false;
-					}
+				auto octet = *reader.current;
+				bool result;
 
-					continue;
+				if (octet & 0x80)
+				{
+					// Indexed Header Field: 0b1xxxxxxx
+					result = DecodeIndexedHeaderField(reader, header_fields);
 				}
-
-				// Check if the next is the Literal Header Field with Incremental Indexing
-				// Start with 0b01
-				b = reader->ReadBit();
-				if (b == 1)
+				else if (octet & 0x40)
 				{
-					if (DecodeLiteralHeaderFieldWithIndexing(reader, header_fields) == false)
-					{
-						return false;
-					}
-
-					continue;
+					// Literal Header Field with Incremental Indexing: 0b01xxxxxx
+					result = DecodeLiteralHeaderFieldWithIndexing(reader, header_fields);
 				}
-
-				// Check if the next is the Dynamic Table Size Update
-				// Start with 0b001
-				b = reader->ReadBit();
-				if (b == 1)
+				else if (octet & 0x20)
 				{
-					// Dynamic Table Size Update
-					if (DecodeDynamicTableSizeUpdate(reader) == false)
-					{
-						return false;
-					}
-
-					continue;
+					// Dynamic Table Size Update: 0b001xxxxx
+					result = DecodeDynamicTableSizeUpdate(reader);
 				}
-
-				// Check if the next is the Literal Header Field without Indexing
-				// Start with 0b0000
-				b = reader->ReadBit();
-				if (b == 0)
+				else if (octet & 0x10)
 				{
-					if (DecodeLiteralHeaderFieldWithoutIndexing(reader, header_fields) == false)
-					{
-						return false;
-					}
-
-					continue;
+					// Literal Header Field never Indexed: 0b0001xxxx
+					result = DecodeLiteralHeaderFieldNeverIndexed(reader, header_fields);
 				}
-				// Check if the next is the Literal Header Field never Indexed
-				// Start with 0b0001
-				else if (b == 1)
+				else
 				{
-					if (DecodeLiteralHeaderFieldNeverIndexed(reader, header_fields) == false)
-					{
-						return false;
-					}
+					// Literal Header Field without Indexing: 0b0000xxxx
+					result = DecodeLiteralHeaderFieldWithoutIndexing(reader, header_fields);
+				}
 
-					continue;
+				if (result == false)
+				{
+					return false;
 				}
 			}
 
 			return true;
 		}
 
-		bool Decoder::DecodeIndexedHeaderField(const std::shared_ptr<BitReader> &reader, std::vector<HeaderField> &header_fields)
+		bool Decoder::DecodeIndexedHeaderField(Reader &reader, std::vector<HeaderField> &header_fields)
 		{
 			// Indexed Header Field Representation
-			uint64_t index = reader->ReadBits<uint8_t>(7);
-			if (index == 0)
+			uint64_t index;
+			if (ReadInteger(reader, 7, index) == false)
 			{
-				// Error
 				return false;
 			}
-			else if (index == 0x7F)
+
+			if (index == 0)
 			{
-				uint64_t extra;
-				if (ReadULEB128(reader, extra) == false)
-				{
-					return false;
-				}
-				index += extra;
+				// Error
+				return false;
 			}
 
 			// Find and return header field
 			HeaderField header_field;
 			if (_table_connector.GetHeaderField(index, header_field) == true)
 			{
-				header_fields.push_back(header_field);
 				logtd("DecodeIndexedHeaderField: %s", header_field.ToString().CStr());
+				header_fields.push_back(std::move(header_field));
 				return true;
 			}
 
 			return false;
 		}
 
-		bool Decoder::DecodeLiteralHeaderFieldWithIndexing(const std::shared_ptr<BitReader> &reader, std::vector<HeaderField> &header_fields)
+		bool Decoder::DecodeLiteralHeaderFieldWithIndexing(Reader &reader, std::vector<HeaderField> &header_fields)
 		{
 			HeaderField header_field;
 			if (ReadLiteralHeaderField(6, reader, header_field) == false)
@@ -130,17 +97,17 @@ namespace http
 				return false;
 			}
 
-			header_fields.push_back(header_field);
-
 			// Indexing decoded Header Field
 			_table_connector.Index(header_field);
 
 			logtd("DecodeLiteralHeaderFieldWithIndexing: %s", header_field.ToString().CStr());
 
+			header_fields.push_back(std::move(header_field));
+
 			return true;
 		}
 
-		bool Decoder::DecodeLiteralHeaderFieldWithoutIndexing(const std::shared_ptr<BitReader> &reader, std::vector<HeaderField> &header_fields)
+		bool Decoder::DecodeLiteralHeaderFieldWithoutIndexing(Reader &reader, std::vector<HeaderField> &header_fields)
 		{
 			HeaderField header_field;
 			if (ReadLiteralHeaderField(4, reader, header_field) == false)
@@ -148,14 +115,14 @@ namespace http
 				return false;
 			}
 
-			header_fields.push_back(header_field);
-
 			logtd("DecodeLiteralHeaderFieldWithoutIndexing: %s", header_field.ToString().CStr());
 
+			header_fields.push_back(std::move(header_field));
+
 			return true;
 		}
 
-		bool Decoder::DecodeLiteralHeaderFieldNeverIndexed(const std::shared_ptr<BitReader> &reader, std::vector<HeaderField> &header_fields)
+		bool Decoder::DecodeLiteralHeaderFieldNeverIndexed(Reader &reader, std::vector<HeaderField> &header_fields)
 		{
 			HeaderField header_field;
 			if (ReadLiteralHeaderField(4, reader, header_field) == false)
@@ -163,51 +130,35 @@ namespace http
 				return false;
 			}
 
-			header_fields.push_back(header_field);
-
 			logtd("DecodeLiteralHeaderFieldNeverIndexed: %s", header_field.ToString().CStr());
 
+			header_fields.push_back(std::move(header_field));
+
 			return true;
 		}
-		
-		bool Decoder::DecodeDynamicTableSizeUpdate(const std::shared_ptr<BitReader> &reader)
+
+		bool Decoder::DecodeDynamicTableSizeUpdate(Reader &reader)
 		{
-			uint64_t size = reader->ReadBits<uint8_t>(5);
-			if (size == 0)
+			// 0 is a valid size (evicts all entries)
+			uint64_t size;
+			if (ReadInteger(reader, 5, size) == false)
 			{
-				// Error
 				return false;
 			}
-			else if (size == 0x1F)
-			{
-				uint64_t extra = 0;
-				if (ReadULEB128(reader, extra) == false)
-				{
-					return false;
-				}
-				size += extra;
-			}
 
 			_table_connector.UpdateDynamicTableSize(size);
 
-			logtd("DecodeDynamicTableSizeUpdate: %d", size);
+			logtd("DecodeDynamicTableSizeUpdate: %llu", size);
 
 			return true;
 		}
-		
-		bool Decoder::ReadLiteralHeaderField(uint8_t index_bits, const std::shared_ptr<BitReader> &reader, HeaderField &header_field)
+
+		bool Decoder::ReadLiteralHeaderField(uint8_t index_bits, Reader &reader, HeaderField &header_field)
 		{
-			// Indexed Header Field Representation
-			uint64_t index = reader->ReadBits<uint8_t>(index_bits);
-			
-			if (index == (std::pow(2, index_bits) - 1))
+			uint64_t index;
+			if (ReadInteger(reader, index_bits, index) == false)
 			{
-				uint64_t extra = 0;
-				if (ReadULEB128(reader, extra) == false)
-				{
-					return false;
-				}
-				index += extra;
+				return false;
 			}
 
 			ov::String name, value;
@@ -222,10 +173,10 @@ namespace http
 			}
 			else
 			{
-				HeaderField header_field;
-				if (_table_connector.GetHeaderField(index, header_field) == true)
+				HeaderField indexed_header_field;
+				if (_table_connector.GetHeaderField(index, indexed_header_field) == true)
 				{
-					name = header_field.GetName();
+					name = indexed_header_field.GetName();
 				}
 				else
 				{
@@ -240,12 +191,40 @@ namespace http
 				return false;
 			}
 
-			header_field.SetNameValue(name, value);
+			header_field = HeaderField(std::move(name), std::move(value));
+
+			return true;
+		}
+
+		bool Decoder::ReadInteger(Reader &reader, uint8_t prefix_bits, uint64_t &value)
+		{
+			if (reader.GetRemained() == 0)
+			{
+				return false;
+			}
+
+			uint8_t max_prefix_value = static_cast<uint8_t>((1 << prefix_bits) - 1);
+
+			value = *reader.current & max_prefix_value;
+			reader.current++;
+
+			if (value < max_prefix_value)
+			{
+				return true;
+			}
+
+			uint64_t extra;
+			if (ReadULEB128(reader, extra) == false)
+			{
+				return false;
+			}
+
+			value += extra;
 
 			return true;
 		}
 
-		bool Decoder::ReadULEB128(const std::shared_ptr<BitReader> &reader, uint64_t &value)
+		bool Decoder::ReadULEB128(Reader &reader, uint64_t &value)
 		{
 			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.1
 			// decode I from the next N bits
@@ -260,26 +239,29 @@ namespace http
 			// 	return I
 
 			// For a more detailed explanation, see the Wiki. https://en.wikipedia.org/wiki/LEB128
-			
+
 			value = 0;
 			uint64_t shift = 0;
-			do 
+
+			// Larger values than 2^63 are not used in HPACK
+			while ((reader.GetRemained() > 0) && (shift < 63))
 			{
-				auto b = reader->ReadBytes<uint8_t>();
-				value |= (b & 0x7F) << shift;
+				auto b = *reader.current;
+				reader.current++;
+
+				value |= static_cast<uint64_t>(b & 0x7F) << shift;
 				shift += 7;
 
 				if ((b & 0x80) == 0)
 				{
 					return true;
 				}
-
-			} while(reader->BytesRemained() > 0);
+			}
 
 			return false;
 		}
 
-		bool Decoder::ReadString(const std::shared_ptr<BitReader> &reader, ov::String &value)
+		bool Decoder::ReadString(Reader &reader, ov::String &value)
 		{
 			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
 			//   0   1   2   3   4   5   6   7
@@ -287,45 +269,39 @@ namespace http
 			// | H |    String Length (7+)     |
 			// +---+---------------------------+
 			// |  String Data (Length octets)  |
-   			// +-------------------------------+
+			// +-------------------------------+
+
+			if (reader.GetRemained() == 0)
+			{
+				return false;
+			}
 
-			// read H
 			// Huffman Encoded String
-			auto h = reader->ReadBit();
+			bool is_huffman_encoded = (*reader.current & 0x80) != 0;
 
-			// Read Length
-			uint64_t length = reader->ReadBits<uint8_t>(7);
-			if (length == 0)
+			// Read Length (an empty string is valid)
+			uint64_t length;
+			if (ReadInteger(reader, 7, length) == false)
 			{
-				// Error
 				return false;
 			}
-			else if (length == 0x7F)
-			{
-				uint64_t extra = 0;
-				if (ReadULEB128(reader, extra) == false)
-				{
-					return false;
-				}
 
-				length += extra;
+			if (length > reader.GetRemained())
+			{
+				return false;
 			}
 
-			if (h == 1)
+			auto encoded = reader.current;
+			reader.current += length;
+
+			if (is_huffman_encoded)
 			{
-				auto encoded_data = std::make_shared<ov::Data>(reader->CurrentPosition(), length);
-				reader->SkipBytes(length);
 				// Decode Huffman Encoded String
-				if (HuffmanCodec::GetInstance()->Decode(encoded_data, value) == false)
-				{
-					return false;
-				}
-			}
-			else
-			{
-				value = reader->ReadString(length);
+				return HuffmanCodec::GetInstance()->Decode(encoded, length, value);
 			}
 
+			value = ov::String(reinterpret_cast<const char *>(encoded), length);
+
 			return true;
 		}
 
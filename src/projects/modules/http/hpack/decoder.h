@@ -23,18 +23,32 @@ namespace http
 			bool Decode(const std::shared_ptr<const ov::Data> &data, std::vector<HeaderField> &header_fields);
 
 		private:
-			bool DecodeIndexedHeaderField(const std::shared_ptr<BitReader> &reader, std::vector<HeaderField> &header_fields);
-			bool DecodeLiteralHeaderFieldWithIndexing(const std::shared_ptr<BitReader> &reader, std::vector<HeaderField> &header_fields);
-			bool DecodeLiteralHeaderFieldWithoutIndexing(const std::shared_ptr<BitReader> &reader, std::vector<HeaderField> &header_fields);
-			bool DecodeLiteralHeaderFieldNeverIndexed(const std::shared_ptr<BitReader> &reader, std::vector<HeaderField> &header_fields);
+			struct Reader
+			{
+				const uint8_t *current;
+				const uint8_t *end;
 
-			bool DecodeDynamicTableSizeUpdate(const std::shared_ptr<BitReader> &reader);
+				size_t GetRemained() const
+				{
+					return end - current;
+				}
+			};
 
-			bool ReadLiteralHeaderField(uint8_t index_bits, const std::shared_ptr<BitReader> &reader, HeaderField &header_field);
+			bool DecodeIndexedHeaderField(Reader &reader, std::vector<HeaderField> &header_fields);
+			bool DecodeLiteralHeaderFieldWithIndexing(Reader &reader, std::vector<HeaderField> &header_fields);
+			bool DecodeLiteralHeaderFieldWithoutIndexing(Reader &reader, std::vector<HeaderField> &header_fields);
+			bool DecodeLiteralHeaderFieldNeverIndexed(Reader &reader, std::vector<HeaderField> &header_fields);
 
+			bool DecodeDynamicTableSizeUpdate(Reader &reader);
+
+			bool ReadLiteralHeaderField(uint8_t index_bits, Reader &reader, HeaderField &header_field);
+
+			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.1
+			// Reads the integer with N-bit prefix (the prefix is in the lower bits of the current octet)
+			bool ReadInteger(Reader &reader, uint8_t prefix_bits, uint64_t &value);
 			// Unsigned Little Endian Base 128
-			bool ReadULEB128(const std::shared_ptr<BitReader> &reader, uint64_t &value);
-			bool ReadString(const std::shared_ptr<BitReader> &reader, ov::String &value);
+			bool ReadULEB128(Reader &reader, uint64_t &value);
+			bool ReadString(Reader &reader, ov::String &value);
 
 			TableConnector	_table_connector;
 			std::mutex _decoder_lock;
@@ -7,9 +7,15 @@
 //
 //==============================================================================
 #include "encoder.h"
+
+#include <unordered_set>
+
 #include "huffman_codec.h"
 #include "hpack_private.h"
 
+// The number of field names of which the literal representation is cached
+#define HPACK_ENCODER_MAX_LITERAL_CACHE_COUNT 32
+
 namespace http
 {
 	namespace hpack
@@ -26,13 +32,66 @@ namespace http
 			return true;
 		}
 
-		std::shared_ptr<ov::Data> Encoder::Encode(const HeaderField &header_fields, EncodingType type)
+		Encoder::EncodingType Encoder::GetEncodingType(const ov::String &name)
 		{
-			std::lock_guard<std::mutex> lock(_encoder_lock);
+			// The values of these fields are different in most responses
+			static const std::unordered_set<ov::String> volatile_field_names = {
+				":path",
+				"age",
+				"content-length",
+				"content-range",
+				"date",
+				"etag",
+				"expires",
+				"last-modified",
+				"set-cookie"};
+
+			if (volatile_field_names.find(name) != volatile_field_names.end())
+			{
+				return EncodingType::LiteralWithoutIndexing;
+			}
 
+			return EncodingType::LiteralWithIndexing;
+		}
+
+		std::shared_ptr<ov::Data> Encoder::Encode(const HeaderField &header_fields, EncodingType type)
+		{
 			std::shared_ptr<ov::Data> encoded_data = std::make_shared<ov::Data>(header_fields.GetSize());
 			ov::ByteStream stream(encoded_data.get());
 
+			if (Encode(stream, header_fields, type) == false)
+			{
+				return nullptr;
+			}
+
+			return encoded_data;
+		}
+
+		bool Encoder::Encode(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type)
+		{
+			std::lock_guard<std::mutex> lock(_encoder_lock);
+
+			return EncodeInternal(stream, header_fields, type);
+		}
+
+		bool Encoder::Encode(ov::ByteStream &stream, const std::vector<HeaderField> &header_fields)
+		{
+			// The fields of a header block must be encoded in a row, since the dynamic table is shared by the streams
+			std::lock_guard<std::mutex> lock(_encoder_lock);
+
+			for (const auto &header_field : header_fields)
+			{
+				if (EncodeInternal(stream, header_field, GetEncodingType(header_field.GetName())) == false)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool Encoder::EncodeInternal(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type)
+		{
 			bool result = false;
 
 			if (_need_signal_table_size_update)
@@ -40,12 +99,17 @@ namespace http
 				if (EncodeDynamicTableSizeUpdate(stream, _table_connector.GetDynamicTableSize()) == false)
 				{
 					logte("Failed to encode DynamicTableSizeUpdate (%u) field", _table_connector.GetDynamicTableSize());
-					return nullptr;
+					return false;
 				}
 
 				_need_signal_table_size_update = false;
 			}
 
+			if ((type == EncodingType::LiteralWithoutIndexing) && WriteCachedLiteralHeaderField(stream, header_fields))
+			{
+				return true;
+			}
+
 			// First check if the header field is in the table
 			auto [name_indexed, value_indexed, index] = _table_connector.LookupIndex(header_fields);
 
@@ -55,6 +119,8 @@ namespace http
 			}
 			else
 			{
+				auto start_offset = stream.GetOffset();
+
 				switch (type)
 				{
 					case EncodingType::LiteralWithIndexing:
@@ -62,22 +128,62 @@ namespace http
 						break;
 					case EncodingType::LiteralWithoutIndexing:
 						result = EncodeLiteralHeaderFieldWithoutIndexing(stream, header_fields, index);
+
+						// The index of the dynamic table changes whenever a field is indexed, so it can't be cached
+						// (index 0 means the name is written as a literal)
+						if (result && (index <= _table_connector.GetStaticTableEntryCount()))
+						{
+							CacheLiteralHeaderField(header_fields, stream.GetData()->GetDataAs<uint8_t>() + start_offset, stream.GetOffset() - start_offset);
+						}
 						break;
 					case EncodingType::LiteralNeverIndexed:
 						result = EncodeLiteralHeaderFieldNeverIndexed(stream, header_fields, index);
 						break;
 					default:
-						return nullptr;
+						return false;
 				}
 			}
 
 			if (result == false)
 			{
 				logte("Failed to encode header field");
-				return nullptr;
+				return false;
 			}
 
-			return encoded_data;
+			return true;
+		}
+
+		bool Encoder::WriteCachedLiteralHeaderField(ov::ByteStream &stream, const HeaderField &header_fields)
+		{
+			auto item = _literal_cache.find(header_fields.GetName());
+
+			if ((item == _literal_cache.end()) || (item->second.value != header_fields.GetValue()))
+			{
+				return false;
+			}
+
+			// The cached representation refers to the static table only, so it is still valid
+			// even if the dynamic table has been changed
+			const auto &encoded = item->second.encoded;
+			return stream.Write(encoded.CStr(), encoded.GetLength());
+		}
+
+		void Encoder::CacheLiteralHeaderField(const HeaderField &header_fields, const uint8_t *encoded, size_t length)
+		{
+			auto item = _literal_cache.find(header_fields.GetName());
+
+			if (item == _literal_cache.end())
+			{
+				if (_literal_cache.size() >= HPACK_ENCODER_MAX_LITERAL_CACHE_COUNT)
+				{
+					return;
+				}
+
+				item = _literal_cache.emplace(header_fields.GetName(), CachedLiteral()).first;
+			}
+
+			item->second.value = header_fields.GetValue();
+			item->second.encoded = ov::String(reinterpret_cast<const char *>(encoded), length);
 		}
 
 		bool Encoder::EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index)
@@ -187,7 +293,7 @@ namespace http
 		bool Encoder::WriteInteger(ov::ByteStream &stream, uint8_t mask, uint8_t value_bits, uint64_t value)
 		{
 			uint8_t first_octet = mask;
-			uint8_t max_prefix_value = std::pow(2, value_bits) - 1;
+			uint8_t max_prefix_value = static_cast<uint8_t>((1 << value_bits) - 1);
 			
 			if (value < max_prefix_value)
 			{
@@ -227,29 +333,32 @@ namespace http
 
 		bool Encoder::WriteString(ov::ByteStream &stream, const ov::String &value, bool huffman_encoding)
 		{
-			std::shared_ptr<ov::Data> data = nullptr;
+			auto huffman_codec = HuffmanCodec::GetInstance();
 
+			// Use Huffman encoding only if it makes the string shorter
 			if (huffman_encoding == true)
 			{
-				data = HuffmanCodec::GetInstance()->Encode(value);
-				if (data == nullptr)
+				auto encoded_length = huffman_codec->GetEncodedLength(value);
+
+				if (encoded_length < value.GetLength())
 				{
-					logte("Failed to encode string");
-					return false;
+					// Write the length - 0x80 mask means string is Huffman Encoded
+					WriteInteger(stream, 0x80, 7, encoded_length);
+
+					// Write encoded string
+					if (huffman_codec->Encode(value, stream) == false)
+					{
+						logte("Failed to encode string");
+						return false;
+					}
+
+					return true;
 				}
 			}
-			else
-			{
-				data = value.ToData(false);
-			}
 
-			// Write the length - 0x80 mask means string is Huffman Encoded
-			WriteInteger(stream, 0x80, 7, data->GetLength());
-			
-			// Write encoded string
-			stream.Write(data);
+			WriteInteger(stream, 0x00, 7, value.GetLength());
 
-			return true;
+			return stream.Write(value.CStr(), value.GetLength());
 		}
 
 	} // namespace hpack
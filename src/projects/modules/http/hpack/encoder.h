@@ -27,11 +27,22 @@ namespace http
 				LiteralNeverIndexed
 			};
 
+			// Returns the encoding type suitable for the header field.
+			// The fields that change in every response (date, content-length, ...) are not indexed,
+			// so that they don't evict the stable fields from the dynamic table.
+			static EncodingType GetEncodingType(const ov::String &name);
+
 			bool UpdateDynamicTableSize(size_t size);
 
 			std::shared_ptr<ov::Data> Encode(const HeaderField &header_fields, EncodingType type);
+			// Appends the encoded header field to the stream
+			bool Encode(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type);
+			// Appends the header block to the stream (the encoding type is determined by GetEncodingType())
+			bool Encode(ov::ByteStream &stream, const std::vector<HeaderField> &header_fields);
 
 		private:
+			bool EncodeInternal(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type);
+
 			bool EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index);
 			bool EncodeLiteralHeaderFieldWithIndexing(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t name_index);
 			bool EncodeLiteralHeaderFieldWithoutIndexing(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t name_index);
@@ -46,9 +57,24 @@ namespace http
 			// Unsigned Little Endian Base 128
 			bool WriteULEB128(ov::ByteStream &stream, const uint64_t &value);
 
+			// Returns false if the field is not in the cache
+			bool WriteCachedLiteralHeaderField(ov::ByteStream &stream, const HeaderField &header_fields);
+			void CacheLiteralHeaderField(const HeaderField &header_fields, const uint8_t *encoded, size_t length);
+
 			TableConnector	_table_connector;
 			bool _need_signal_table_size_update = false;
 
+			struct CachedLiteral
+			{
+				ov::String value;
+				ov::String encoded;
+			};
+			// The literal representations (without indexing) of the fields whose name is not in the dynamic table.
+			// They don't depend on the state of the dynamic table, so the same bytes can be written again
+			// if the value doesn't change (e.g. date in the same second, server, ...)
+			// name : the last encoded value
+			std::unordered_map<ov::String, CachedLiteral> _literal_cache;
+
 			std::mutex _encoder_lock;
 		};
 	} // namespace hpack
@@ -7,7 +7,6 @@
 //
 //==============================================================================
 
-#include <base/ovlibrary/bit_reader.h>
 #include "huffman_codec.h"
 
 namespace http
@@ -16,6 +15,8 @@ namespace http
 	{
 		HuffmanCodec::HuffmanCodec()
 		{
+			_tree.emplace_back();
+
 			// https://www.rfc-editor.org/rfc/rfc7541.html#appendix-B
 			Build(0x1ff8, 13, 0);
 			Build(0x7fffd8, 23, 1);
@@ -274,142 +275,266 @@ namespace http
 			Build(0x7fffff0, 27, 254);
 			Build(0x3ffffee, 26, 255);
 			Build(0x3fffffff, 30, 256); //EOS
+
+			BuildDecodeTable();
 		}
 
 		std::shared_ptr<ov::Data> HuffmanCodec::Encode(const ov::String &str)
 		{
-			uint8_t out_data[str.GetLength() * 2];
+			auto data = std::make_shared<ov::Data>(GetEncodedLength(str));
+			ov::ByteStream stream(data.get());
+
+			if (Encode(str, stream) == false)
+			{
+				return nullptr;
+			}
+
+			return data;
+		}
+
+		size_t HuffmanCodec::GetEncodedLength(const ov::String &str) const
+		{
+			auto buffer = reinterpret_cast<const uint8_t *>(str.CStr());
+			auto length = str.GetLength();
+			size_t bit_length = 0;
+
+			for (size_t index = 0; index < length; index++)
+			{
+				bit_length += _codes[buffer[index]].length;
+			}
+
+			return (bit_length + 7) / 8;
+		}
+
+		bool HuffmanCodec::Encode(const ov::String &str, ov::ByteStream &stream) const
+		{
+			auto buffer = reinterpret_cast<const uint8_t *>(str.CStr());
+			auto length = str.GetLength();
+
+			uint8_t out_data[256];
 			size_t out_data_size = 0;
 
+			// The longest code is 30 bits, so the bit buffer never overflows if it is flushed when it has 32 bits or more
 			uint64_t bit_buffer = 0;
 			size_t bit_buffer_length = 0;
-			size_t length = str.GetLength();
-			for (size_t i = 0; i < length; i++)
+
+			for (size_t index = 0; index < length; index++)
 			{
-				uint8_t c = str[i];
-				auto [code, code_bit_length] = _map[c];
-				
+				const auto &code = _codes[buffer[index]];
+
 				// Append the code to the bit buffer
-				bit_buffer <<= code_bit_length;
-				bit_buffer |= code;
-				bit_buffer_length += code_bit_length;
+				bit_buffer = (bit_buffer << code.length) | code.code;
+				bit_buffer_length += code.length;
 
-				// If the bit buffer is over 8 bits, flush it to the output buffer
-				while (bit_buffer_length >= 8)
+				// Flush 32 bits at a time
+				if (bit_buffer_length >= 32)
 				{
-					uint8_t byte = static_cast<uint8_t>(bit_buffer >> (bit_buffer_length - 8));
-					bit_buffer_length -= 8;
-					out_data[out_data_size] = byte;
-					out_data_size ++;
+					bit_buffer_length -= 32;
+					auto word = static_cast<uint32_t>(bit_buffer >> bit_buffer_length);
+
+					out_data[out_data_size++] = static_cast<uint8_t>(word >> 24);
+					out_data[out_data_size++] = static_cast<uint8_t>(word >> 16);
+					out_data[out_data_size++] = static_cast<uint8_t>(word >> 8);
+					out_data[out_data_size++] = static_cast<uint8_t>(word);
+
+					if (out_data_size > (sizeof(out_data) - 4))
+					{
+						if (stream.Write(out_data, out_data_size) == false)
+						{
+							return false;
+						}
+
+						out_data_size = 0;
+					}
 				}
 			}
-			
+
+			while (bit_buffer_length >= 8)
+			{
+				bit_buffer_length -= 8;
+				out_data[out_data_size++] = static_cast<uint8_t>(bit_buffer >> bit_buffer_length);
+			}
+
 			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
 			// As the Huffman-encoded data doesn't always end at an octet boundary,
 			// some padding is inserted after it, up to the next octet boundary.  To
 			// prevent this padding from being misinterpreted as part of the string
 			// literal, the most significant bits of the code corresponding to the
 			// EOS (end-of-string) symbol are used.
-
-			// Append EOS
 			if (bit_buffer_length > 0)
 			{
-				auto byte = bit_buffer << (8 - bit_buffer_length);
-				// Append EOS(0xFF) to the end of the bit buffer
-				// bit_buffer is always less than 8 bits
+				// The prefix of EOS is all 1s
+				auto byte = static_cast<uint8_t>(bit_buffer << (8 - bit_buffer_length));
 				byte |= 0xFF >> bit_buffer_length;
 
-				out_data[out_data_size] = byte;
-				out_data_size ++;
+				out_data[out_data_size++] = byte;
 			}
-			
-			return std::make_shared<ov::Data>(&out_data[0], out_data_size);
+
+			return (out_data_size == 0) || stream.Write(out_data, out_data_size);
 		}
 
 		bool HuffmanCodec::Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str)
 		{
-			auto reader = std::make_shared<BitReader>(data->GetDataAs<uint8_t>(), data->GetLength());
-			auto node = _tree;
+			return Decode(data->GetDataAs<uint8_t>(), data->GetLength(), str);
+		}
 
-			while (reader->BytesRemained() > 0)
+		bool HuffmanCodec::Decode(const uint8_t *data, size_t length, ov::String &str) const
+		{
+			// The shortest code is 5 bits
+			auto offset = str.GetLength();
+			str.SetLength(offset + ((length * 8) / 5));
+
+			auto out_data = str.GetBuffer() + offset;
+			size_t out_data_size = 0;
+
+			uint8_t state = 0;
+			bool accepted = true;
+
+			for (size_t index = 0; index < length; index++)
 			{
-				auto b = reader->ReadBit();
-				if (b == 1)
-				{
-					node = node->GetRight();
-					if (node == nullptr)
-					{
-						return false;
-					}
-				}
-				else
+				const uint8_t nibbles[2] = {static_cast<uint8_t>(data[index] >> 4), static_cast<uint8_t>(data[index] & 0x0F)};
+
+				for (auto nibble : nibbles)
 				{
-					node = node->GetLeft();
-					if (node == nullptr)
+					const auto &transition = _decode_table[state][nibble];
+
+					if (transition.flags & TransitionFlag::Failed)
 					{
+						str.SetLength(offset);
 						return false;
 					}
-				}
 
-				if (node->IsLeaf())
-				{
-					if (node->GetValue() == 256)
+					if (transition.flags & TransitionFlag::Emit)
 					{
-						// EOS
-						return false;
+						out_data[out_data_size++] = static_cast<char>(transition.symbol);
 					}
 
-					str.Append(static_cast<uint8_t>(node->GetValue()));
-					node = _tree;
-
-					// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
-					// As the Huffman-encoded data doesn't always end at an octet boundary,
-					// some padding is inserted after it, up to the next octet boundary.  To
-					// prevent this padding from being misinterpreted as part of the string
-					// literal, the most significant bits of the code corresponding to the
-					// EOS (end-of-string) symbol are used.
-
-					// So, the symbol (1111111) corresponding to EOS may be included in the 
-					// last 7 bits or less. In this case, no processing is done because it will 
-					// terminate without reaching the leaf naturally.
+					state = transition.next_state;
+					accepted = (transition.flags & TransitionFlag::Accepted);
 				}
 			}
 
-			return true;
+			str.SetLength(offset + out_data_size);
+
+			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
+			// A padding strictly longer than 7 bits MUST be treated as a decoding error.
+			// A padding not corresponding to the most significant bits of the code for the EOS symbol MUST be treated as a decoding error.
+			return accepted;
 		}
 
-		void HuffmanCodec::BuildTree(uint32_t code, uint8_t length, uint16_t symbol)
+		void HuffmanCodec::BuildDecodeTable()
 		{
-			//TODO(Getroot): If needed, apply faster algorithm
-			auto node = _tree;
+			// Number the internal nodes, and find the states at which the input can end
+			std::vector<int> state_of_node(_tree.size(), -1);
+			std::vector<int> node_of_state;
+			std::vector<bool> accepted_list;
+
+			// node index, depth, whether all bits from the root are 1
+			std::vector<std::tuple<int, int, bool>> stack{{0, 0, true}};
 
-			for (uint16_t i = 0; i < length; i++)
+			while (stack.empty() == false)
 			{
-				auto bit = (code >> (length - i - 1)) & 0x1;
+				auto [node, depth, all_ones] = stack.back();
+				stack.pop_back();
 
-				if (bit == 0)
+				if (_tree[node].symbol >= 0)
 				{
-					node = node->GetLeft(true);
+					continue;
 				}
-				else
+
+				state_of_node[node] = node_of_state.size();
+				node_of_state.push_back(node);
+				accepted_list.push_back((depth == 0) || (all_ones && (depth <= 7)));
+
+				for (int bit = 0; bit < 2; bit++)
 				{
-					node = node->GetRight(true);
+					auto child = _tree[node].children[bit];
+
+					if (child >= 0)
+					{
+						stack.emplace_back(child, depth + 1, all_ones && (bit == 1));
+					}
 				}
 			}
 
-			node->SetValue(symbol);
-		}
+			OV_ASSERT2(node_of_state.size() <= 256);
 
-		void HuffmanCodec::BuildMap(uint32_t code, uint8_t length, uint16_t symbol)
-		{
-			_map[symbol] = std::make_pair(code, length);
+			_decode_table.resize(node_of_state.size());
+
+			for (size_t state = 0; state < node_of_state.size(); state++)
+			{
+				for (uint8_t nibble = 0; nibble < 16; nibble++)
+				{
+					auto &transition = _decode_table[state][nibble];
+					int node = node_of_state[state];
+
+					for (int shift = 3; shift >= 0; shift--)
+					{
+						auto child = _tree[node].children[(nibble >> shift) & 0x01];
+
+						if (child < 0)
+						{
+							transition.flags |= TransitionFlag::Failed;
+							break;
+						}
+
+						if (_tree[child].symbol < 0)
+						{
+							node = child;
+							continue;
+						}
+
+						if (_tree[child].symbol == 256)
+						{
+							// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
+							// A Huffman-encoded string literal containing the EOS symbol MUST be treated as a decoding error.
+							transition.flags |= TransitionFlag::Failed;
+							break;
+						}
+
+						transition.flags |= TransitionFlag::Emit;
+						transition.symbol = static_cast<uint8_t>(_tree[child].symbol);
+
+						// Start again from the root
+						node = 0;
+					}
+
+					if ((transition.flags & TransitionFlag::Failed) == 0)
+					{
+						transition.next_state = static_cast<uint8_t>(state_of_node[node]);
+
+						if (accepted_list[transition.next_state])
+						{
+							transition.flags |= TransitionFlag::Accepted;
+						}
+					}
+				}
+			}
 		}
 
-		// Build Tree and Map
+		// Build the encoding table and the tree
 		void HuffmanCodec::Build(uint32_t code, uint8_t length, uint16_t symbol)
 		{
-			BuildMap(code, length, symbol);
-			BuildTree(code, length, symbol);
+			_codes[symbol] = {code, length};
+
+			int node = 0;
+
+			for (int shift = length - 1; shift >= 0; shift--)
+			{
+				auto bit = (code >> shift) & 0x01;
+				auto child = _tree[node].children[bit];
+
+				if (child < 0)
+				{
+					child = static_cast<int16_t>(_tree.size());
+					_tree[node].children[bit] = child;
+					_tree.emplace_back();
+				}
+
+				node = child;
+			}
+
+			_tree[node].symbol = static_cast<int16_t>(symbol);
 		}
 	} // namespace hpack
 } // namespace http
\ No newline at end of file
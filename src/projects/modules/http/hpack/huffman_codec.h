@@ -19,66 +19,64 @@ namespace http
 		{
 		public:
 			HuffmanCodec();
+
 			std::shared_ptr<ov::Data> Encode(const ov::String &str);
+			// Appends the encoded string to the stream
+			bool Encode(const ov::String &str, ov::ByteStream &stream) const;
+			// The number of octets of the encoded string
+			size_t GetEncodedLength(const ov::String &str) const;
+
 			bool Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str);
-			
+			bool Decode(const uint8_t *data, size_t length, ov::String &str) const;
+
 		private:
-			// Build Tree and Map
+			// Add the code to the encoding table and the tree
 			void Build(uint32_t code, uint8_t length, uint16_t symbol);
-			// Build Map for encoding from symbol to code
-			void BuildMap(uint32_t code, uint8_t length, uint16_t symbol);
-			// Build Tree for decoding from code to symbol
-			void BuildTree(uint32_t code, uint8_t length, uint16_t symbol);
+			// Build the decoding state machine from the tree
+			void BuildDecodeTable();
 
-			class Node
+			struct Code
 			{
-			public:
-				Node* GetLeft(bool create = false)
-				{
-					if (_left == nullptr && create == true)
-					{
-						_left = new Node();
-					}
-
-					return _left;
-				}
-
-				Node* GetRight(bool create = false)
-				{
-					if (_right == nullptr && create == true)
-					{
-						_right = new Node();
-					}
+				uint32_t code = 0;
+				uint8_t length = 0;
+			};
 
-					return _right;
-				}
+			struct TreeNode
+			{
+				// Indices of _tree (-1 if there is no child)
+				int16_t children[2] = {-1, -1};
+				// -1 if the node is not a leaf
+				int16_t symbol = -1;
+			};
 
-				void SetValue(uint16_t value)
-				{
-					_value = value;
-					_is_leaf = true;
-				}
-				
-				uint16_t GetValue()
-				{
-					return _value;
-				}
+			enum TransitionFlag : uint8_t
+			{
+				// A symbol is decoded while consuming the nibble
+				Emit = 0x01,
+				// The input can end at the next state (the remaining bits are a valid EOS padding)
+				Accepted = 0x02,
+				// Invalid code or EOS
+				Failed = 0x04
+			};
 
-				bool IsLeaf()
-				{
-					return _is_leaf;
-				}
-				
-			private:
-				Node* _left = nullptr;
-				Node* _right = nullptr;
-				uint16_t _value = 0;
-				bool _is_leaf = false;
+			// The result of consuming 4 bits at a state.
+			// The shortest code is 5 bits, so at most one symbol is decoded per nibble.
+			struct Transition
+			{
+				uint8_t next_state = 0;
+				uint8_t flags = 0;
+				uint8_t symbol = 0;
 			};
 
-			// 
-			Node* _tree = new Node();
-			std::unordered_map<uint8_t, std::pair<uint32_t, uint8_t>> _map;
+			// 256 symbols + EOS
+			static constexpr size_t SymbolCount = 257;
+
+			std::array<Code, SymbolCount> _codes;
+			// _tree[0] is the root
+			std::vector<TreeNode> _tree;
+			// A state is an internal node of the tree (a Huffman tree with 257 leaves has 256 internal nodes),
+			// and the root is the state 0
+			std::vector<std::array<Transition, 16>> _decode_table;
 		};
-	}
-}
\ No newline at end of file
+	}  // namespace hpack
+}  // namespace http
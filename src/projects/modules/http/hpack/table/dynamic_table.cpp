@@ -9,27 +9,180 @@
 
 #include "dynamic_table.h"
 
+// Each entry takes at least 32 bytes, so 4096 / 32 entries fit in the default table size
+#define HPACK_DYNAMIC_TABLE_INITIAL_CAPACITY 128
+
 namespace http
 {
 	namespace hpack
 	{
-		bool DynamicTable::Insert(const HeaderField &header_field)
+		DynamicTable::DynamicTable()
+			: _entry_list(HPACK_DYNAMIC_TABLE_INITIAL_CAPACITY)
+		{
+		}
+
+		const DynamicTable::Entry &DynamicTable::GetEntry(size_t index) const
+		{
+			// index 1 is the newest entry
+			return _entry_list[(_head + _count - index) & (_entry_list.size() - 1)];
+		}
+
+		uint32_t DynamicTable::GetIndex(uint64_t sequence) const
+		{
+			// The newest entry has the sequence (_next_sequence - 1), and its index is 1
+			return static_cast<uint32_t>(_next_sequence - sequence);
+		}
+
+		bool DynamicTable::GetHeaderField(size_t index, HeaderField &header_field) const
+		{
+			if ((index == 0) || (index > _count))
+			{
+				return false;
+			}
+
+			auto &entry = GetEntry(index);
+			header_field.SetNameValue(entry.name->first, entry.value);
+
+			return true;
+		}
+
+		bool DynamicTable::Index(const HeaderField &header_field)
+		{
+			auto size = header_field.GetSize();
+
+			// https://datatracker.ietf.org/doc/html/rfc7541#section-4.4
+			// Before a new entry is added to the dynamic table, entries are evicted
+			// from the end of the dynamic table until the size of the dynamic table
+			// is less than or equal to (maximum size - new entry size) or until the
+			// table is empty.
+			while (((_table_usage + size) > _table_size) && Pop())
+			{
+			}
+
+			// It is not an error to attempt to add an entry that is larger than the maximum size;
+			// an attempt to add an entry larger than the maximum size causes the table
+			// to be emptied of all existing entries and results in an empty table.
+			if (size > _table_size)
+			{
+				return true;
+			}
+
+			if (_count == _entry_list.size())
+			{
+				Grow();
+			}
+
+			auto sequence = _next_sequence++;
+
+			auto &name = *(_name_map.try_emplace(header_field.GetName()).first);
+			name.second.reference_count++;
+			name.second.latest_sequence = sequence;
+			name.second.value_map[header_field.GetValue()] = sequence;
+
+			auto &entry = _entry_list[(_head + _count) & (_entry_list.size() - 1)];
+			entry.name = &name;
+			entry.value = header_field.GetValue();
+			entry.sequence = sequence;
+
+			_count++;
+			_table_usage += size;
+
+			return true;
+		}
+
+		std::tuple<bool, bool, uint32_t> DynamicTable::LookupIndex(const HeaderField &header_field) const
+		{
+			auto name_item = _name_map.find(header_field.GetName());
+
+			if (name_item == _name_map.end())
+			{
+				return {false, false, 0};
+			}
+
+			auto &name = name_item->second;
+			auto value_item = name.value_map.find(header_field.GetValue());
+
+			if (value_item != name.value_map.end())
+			{
+				return {true, true, GetIndex(value_item->second)};
+			}
+
+			// The entries are evicted in the order of insertion, so the newest entry with the name is still in the table
+			return {true, false, GetIndex(name.latest_sequence)};
+		}
+
+		bool DynamicTable::UpdateTableSize(size_t size)
 		{
-			_header_fields_table.push_front(header_field);
+			while ((_table_usage > size) && Pop())
+			{
+			}
+
+			_table_size = size;
+
 			return true;
 		}
 
-		uint32_t DynamicTable::CalcIndexNumber(uint32_t sequence, uint32_t table_size, uint32_t removed_item_count)
+		size_t DynamicTable::GetTableSize() const
 		{
-			////////////////
-			// How to find index by header_field for DynamicTable
-			// Since a new item is input to the front of the table (first-in, first-out order),
-			// the index of the item increases by one each time a new item is input.
-			// Therefore, the index can be calculated as follows using the input order and table size.
-			// 
-			// index = table.size() - (inserted order number - removed item count)
+			return _table_size;
+		}
+
+		size_t DynamicTable::GetTableUsage() const
+		{
+			return _table_usage;
+		}
+
+		size_t DynamicTable::GetNumberOfTableEntries() const
+		{
+			return _count;
+		}
 
-			return (table_size - (sequence - removed_item_count)) + 1;;
+		void DynamicTable::Grow()
+		{
+			std::vector<Entry> entry_list(_entry_list.size() * 2);
+
+			for (size_t index = 0; index < _count; index++)
+			{
+				entry_list[index] = std::move(_entry_list[(_head + index) & (_entry_list.size() - 1)]);
+			}
+
+			_entry_list = std::move(entry_list);
+			_head = 0;
+		}
+
+		bool DynamicTable::Pop()
+		{
+			if (_count == 0)
+			{
+				return false;
+			}
+
+			auto &entry = _entry_list[_head];
+			auto &name = entry.name->second;
+
+			_table_usage -= entry.GetSize();
+
+			// Remove the value from the map only if a newer entry doesn't have the same value
+			auto value_item = name.value_map.find(entry.value);
+			if ((value_item != name.value_map.end()) && (value_item->second == entry.sequence))
+			{
+				name.value_map.erase(value_item);
+			}
+
+			name.reference_count--;
+			if (name.reference_count == 0)
+			{
+				// Don't erase by the key, it is owned by the element being erased
+				_name_map.erase(_name_map.find(entry.name->first));
+			}
+
+			entry.name = nullptr;
+			entry.value.Clear();
+
+			_head = (_head + 1) & (_entry_list.size() - 1);
+			_count--;
+
+			return true;
 		}
-	}
-}
\ No newline at end of file
+	} // namespace hpack
+} // namespace http
@@ -9,17 +9,82 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
-#include "table.h"
+
+#include "../data_structure.h"
 
 namespace http
 {
 	namespace hpack
 	{
-		class DynamicTable : public Table
+		// https://datatracker.ietf.org/doc/html/rfc7541#section-2.3.2
+		//
+		// The entries are stored in a ring buffer (the oldest entry is evicted first), and the names are interned,
+		// so the entries with the same name share one string and one lookup map.
+		class DynamicTable
 		{
+		public:
+			DynamicTable();
+
+			// The index number starts from 1 (the newest entry)
+			bool GetHeaderField(size_t index, HeaderField &header_field) const;
+			bool Index(const HeaderField &header_field);
+
+			// Return: <Name indexed, Value indexed, Index Number>
+			std::tuple<bool, bool, uint32_t> LookupIndex(const HeaderField &header_field) const;
+
+			bool UpdateTableSize(size_t size);
+
+			size_t GetTableSize() const;
+			size_t GetTableUsage() const;
+			size_t GetNumberOfTableEntries() const;
+
 		private:
-			bool Insert(const HeaderField &header_field) override;
-			uint32_t CalcIndexNumber(uint32_t sequence, uint32_t table_size, uint32_t removed_item_count) override;
+			struct Name
+			{
+				// The number of entries with this name
+				size_t reference_count = 0;
+				// The sequence of the newest entry with this name
+				uint64_t latest_sequence = 0;
+				// value : the sequence of the newest entry with the value
+				std::unordered_map<ov::String, uint64_t> value_map;
+			};
+			using NameMap = std::unordered_map<ov::String, Name>;
+
+			struct Entry
+			{
+				// Points to the element of _name_map (the pointer remains valid even if the map is rehashed)
+				NameMap::value_type *name = nullptr;
+				ov::String value;
+				uint64_t sequence = 0;
+
+				size_t GetSize() const
+				{
+					// https://datatracker.ietf.org/doc/html/rfc7541#section-4.1
+					return name->first.GetLength() + value.GetLength() + 32;
+				}
+			};
+
+			const Entry &GetEntry(size_t index) const;
+			uint32_t GetIndex(uint64_t sequence) const;
+
+			void Grow();
+			// Evicts the oldest entry
+			bool Pop();
+
+			// The capacity is always a power of 2
+			std::vector<Entry> _entry_list;
+			// Position of the oldest entry
+			size_t _head = 0;
+			size_t _count = 0;
+
+			NameMap _name_map;
+
+			// The sequence of the next entry
+			uint64_t _next_sequence = 1;
+
+			// Initial Table Size : 4096
+			size_t _table_size = 4096;
+			size_t _table_usage = 0;
 		};
 	} // namespace hpack
-} // namespace http
\ No newline at end of file
+} // namespace http
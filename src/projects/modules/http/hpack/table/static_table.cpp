@@ -82,17 +82,60 @@ namespace http
 			Index(HeaderField("www-authenticate", ""));
 		}
 
-		bool StaticTable::Insert(const HeaderField &header_field)
+		void StaticTable::Index(const HeaderField &header_field)
 		{
-			// StaticTable does not change index number of header_field
 			_header_fields_table.push_back(header_field);
+
+			auto index = static_cast<uint32_t>(_header_fields_table.size());
+			auto &name = _name_map[header_field.GetName()];
+
+			if (name.index == 0)
+			{
+				name.index = index;
+			}
+
+			if (header_field.GetValue().IsEmpty() == false)
+			{
+				name.value_list.emplace_back(header_field.GetValue(), index);
+			}
+		}
+
+		bool StaticTable::GetHeaderField(size_t index, HeaderField &header_field) const
+		{
+			if ((index == 0) || (index > _header_fields_table.size()))
+			{
+				return false;
+			}
+
+			header_field = _header_fields_table[index - 1];
 			return true;
 		}
 
-		uint32_t StaticTable::CalcIndexNumber(uint32_t sequence, uint32_t table_size, uint32_t removed_item_count)
+		std::tuple<bool, bool, uint32_t> StaticTable::LookupIndex(const HeaderField &header_field) const
+		{
+			auto item = _name_map.find(header_field.GetName());
+
+			if (item == _name_map.end())
+			{
+				return {false, false, 0};
+			}
+
+			const auto &name = item->second;
+
+			for (const auto &[value, index] : name.value_list)
+			{
+				if (value == header_field.GetValue())
+				{
+					return {true, true, index};
+				}
+			}
+
+			return {true, false, name.index};
+		}
+
+		size_t StaticTable::GetNumberOfTableEntries() const
 		{
-			// StaticTable does not remove any item so sequence number is same as index number
-			return sequence;
+			return _header_fields_table.size();
 		}
 	}
-}
\ No newline at end of file
+}
@@ -8,19 +8,41 @@
 //==============================================================================
 #pragma once
 
-#include "table.h"
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "../data_structure.h"
 
 namespace http
 {
 	namespace hpack
 	{
-		class StaticTable : public Table, public ov::Singleton<StaticTable>
+		class StaticTable : public ov::Singleton<StaticTable>
 		{
 		public:
 			StaticTable();
+
+			// The index number starts from 1
+			bool GetHeaderField(size_t index, HeaderField &header_field) const;
+
+			// Return: <Name indexed, Value indexed, Index Number>
+			std::tuple<bool, bool, uint32_t> LookupIndex(const HeaderField &header_field) const;
+
+			size_t GetNumberOfTableEntries() const;
+
 		private:
-			bool Insert(const HeaderField &header_field) override;
-			uint32_t CalcIndexNumber(uint32_t sequence, uint32_t table_size, uint32_t removed_item_count) override;
+			void Index(const HeaderField &header_field);
+
+			struct Name
+			{
+				// The first index of the name
+				uint32_t index = 0;
+				// The values of the name in the table (at most 7 values for :status), value => index
+				std::vector<std::pair<ov::String, uint32_t>> value_list;
+			};
+
+			std::vector<HeaderField> _header_fields_table;
+			// name => indices
+			std::unordered_map<ov::String, Name> _name_map;
 		};
 	} // namespace hpack
-} // namespace http
\ No newline at end of file
+} // namespace http
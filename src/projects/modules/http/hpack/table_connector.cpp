@@ -16,7 +16,7 @@ namespace http
 		bool TableConnector::GetHeaderField(size_t index, HeaderField &header_field)
 		{
 			// StaticTable : 1 ~ 61
-			if (index < _static_table->GetNumberOfTableEntries())
+			if (index <= _static_table->GetNumberOfTableEntries())
 			{
 				return _static_table->GetHeaderField(index, header_field);
 			}
@@ -68,6 +68,11 @@ namespace http
 			return _dynamic_table->UpdateTableSize(size);
 		}
 
+		size_t TableConnector::GetStaticTableEntryCount() const
+		{
+			return _static_table->GetNumberOfTableEntries();
+		}
+
 		size_t TableConnector::GetDynamicTableSize()
 		{
 			std::lock_guard<std::mutex> lock(_dynamic_table_lock);
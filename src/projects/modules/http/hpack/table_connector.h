@@ -25,6 +25,8 @@ namespace http
 			std::tuple<bool, bool, uint32_t> LookupIndex(const HeaderField &header_field);
 			bool UpdateDynamicTableSize(size_t size);
 			size_t GetDynamicTableSize();
+			// Indices from 1 to this value refer to the static table
+			size_t GetStaticTableEntryCount() const;
 			
 		private:
 			// StaticTable is singleton instance
@@ -33,15 +33,10 @@ namespace http
 					return Send("0\r\n\r\n", 5);
 				}
 
-				bool result =
-					// Send the chunk header
-					Send(ov::String::FormatString("%x\r\n", data->GetLength()).ToData(false)) &&
-					// Send the chunk payload
-					Send(data) &&
-					// Send a last data of chunk
-					Send("\r\n", 2);
-
-				return result;
+				static const auto chunk_trailer = std::make_shared<const ov::Data>("\r\n", 2);
+
+				// Send the chunk header, the chunk payload and the last data of chunk at once
+				return SendVector({ov::String::FormatString("%x\r\n", data->GetLength()).ToData(false), data, chunk_trailer});
 			}
 
 			void Http1Response::SetChunkedTransfer()
@@ -48,23 +48,32 @@ namespace http
 			int32_t Http2Response::SendHeader()
 			{
 				std::shared_ptr<ov::Data> header_block = std::make_shared<ov::Data>(65535);
+				ov::ByteStream header_block_stream(header_block.get());
 				size_t sent_size = 0;
 
+				std::vector<hpack::HeaderField> header_fields;
+
 				// :status header field is must on top
-				auto header_field = _hpack_encoder->Encode({":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode()))}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-				header_block->Append(header_field);
+				header_fields.emplace_back(":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode())));
 
 				for (const auto &[name, values] : GetResponseHeaderList())
 				{
+					// https://httpwg.org/http2-spec/draft-ietf-httpbis-http2bis.html#section-8.2
+					// Field names MUST be converted to lowercase when constructing an HTTP/2 message.
+					auto lower_case_name = name.LowerCaseString();
+
 					for (const auto &value : values)
 					{
-						// https://httpwg.org/http2-spec/draft-ietf-httpbis-http2bis.html#section-8.2
-						// Field names MUST be converted to lowercase when constructing an HTTP/2 message.
-						auto header_field = _hpack_encoder->Encode({name.LowerCaseString(), value}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-						header_block->Append(header_field);
+						header_fields.emplace_back(lower_case_name, value);
 					}
 				}
 
+				if (_hpack_encoder->Encode(header_block_stream, header_fields) == false)
+				{
+					logte("[Http2Response] Failed to encode header block");
+					return -1;
+				}
+
 				logtd("[Http2Response] Send header block : size(%u)", header_block->GetLength());
 
 				std::shared_ptr<ov::Data> head_block_fragment;
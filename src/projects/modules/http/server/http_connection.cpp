@@ -129,6 +129,28 @@ namespace http
 				}
 				case ConnectionType::Http10:
 				case ConnectionType::Http11:
+				{
+					std::lock_guard<std::mutex> pipeline_lock(_pipeline_mutex);
+
+					if ((_pending_exchange == nullptr) || (_pending_exchange != exchange))
+					{
+						break;
+					}
+
+					_pending_exchange.reset();
+
+					if ((_pipelined_data != nullptr) && (_is_pipelined_data_scheduled == false))
+					{
+						// This is called by the thread that sent the response, which may be holding its own locks,
+						// so the pipelined requests are processed on the timer thread
+						_is_pipelined_data_scheduled = true;
+
+						HttpServer::PostTask([connection = GetSharedPtr()]() {
+							connection->ProcessPipelinedData();
+						});
+					}
+					break;
+				}
 				case ConnectionType::WebSocket:
 				default:
 					// Nothing to do
@@ -282,6 +304,12 @@ namespace http
 
 			_user_data_map.clear();
 
+			{
+				std::lock_guard<std::mutex> pipeline_lock(_pipeline_mutex);
+				_pending_exchange.reset();
+				_pipelined_data.reset();
+			}
+
 			_closed = true;
 		}
 
@@ -293,6 +321,30 @@ namespace http
 				return;
 			}
 
+			if (IsHttp1())
+			{
+				std::unique_lock<std::mutex> pipeline_lock(_pipeline_mutex);
+
+				if ((_pending_exchange != nullptr) || _is_pipelined_data_scheduled)
+				{
+					// Wait until the previous request is responded
+					auto appended = AppendPipelinedData(data);
+					pipeline_lock.unlock();
+
+					if (appended == false)
+					{
+						Close(PhysicalPortDisconnectReason::Error);
+					}
+
+					return;
+				}
+			}
+
+			ProcessData(data);
+		}
+
+		void HttpConnection::ProcessData(const std::shared_ptr<const ov::Data> &data)
+		{
 			auto process_data = data->Clone();
 			while (process_data->GetLength() > 0)
 			{
@@ -323,6 +375,72 @@ namespace http
 				}
 
 				process_data = process_data->Subdata(processed_length);
+
+				if (IsHttp1() && (process_data->GetLength() > 0))
+				{
+					std::unique_lock<std::mutex> pipeline_lock(_pipeline_mutex);
+
+					if (_pending_exchange != nullptr)
+					{
+						// The following requests are pipelined behind the request that is responded asynchronously
+						auto appended = AppendPipelinedData(process_data);
+						pipeline_lock.unlock();
+
+						if (appended == false)
+						{
+							Close(PhysicalPortDisconnectReason::Error);
+						}
+
+						return;
+					}
+				}
+			}
+		}
+
+		bool HttpConnection::IsHttp1() const
+		{
+			return (_connection_type == ConnectionType::Http10) || (_connection_type == ConnectionType::Http11);
+		}
+
+		bool HttpConnection::AppendPipelinedData(const std::shared_ptr<const ov::Data> &data)
+		{
+			if (_pipelined_data == nullptr)
+			{
+				_pipelined_data = std::make_shared<ov::Data>();
+			}
+
+			if ((_pipelined_data->GetLength() + data->GetLength()) > HTTP_MAX_PIPELINED_DATA_SIZE)
+			{
+				logtw("Too many pipelined requests are waiting for the response: %zu bytes, %s", _pipelined_data->GetLength() + data->GetLength(), ToString().CStr());
+				_pipelined_data.reset();
+				return false;
+			}
+
+			return _pipelined_data->Append(data);
+		}
+
+		void HttpConnection::ProcessPipelinedData()
+		{
+			std::lock_guard<std::recursive_mutex> lock(_close_mutex);
+			std::shared_ptr<ov::Data> pipelined_data;
+
+			{
+				std::lock_guard<std::mutex> pipeline_lock(_pipeline_mutex);
+
+				_is_pipelined_data_scheduled = false;
+
+				if (_pending_exchange != nullptr)
+				{
+					// Another request is responded asynchronously, it will be scheduled again when the request is completed
+					return;
+				}
+
+				pipelined_data = std::move(_pipelined_data);
+			}
+
+			if ((_closed == false) && (pipelined_data != nullptr) && IsHttp1())
+			{
+				ProcessData(pipelined_data);
 			}
 		}
 
@@ -330,7 +448,8 @@ namespace http
 		{
 			// HTTP 1.1 only has one stream
 			// Although HTTP/1.1 pipelining allows a client to send multiple requests at once, the server must respond in order.
-			// So the server receives and processes requests one by one.
+			// So the server receives and processes requests one by one, and the requests following an asynchronous response
+			// wait in _pipelined_data until the response is sent.
 
 			if (_http_transaction == nullptr)
 			{
@@ -370,8 +489,19 @@ namespace http
 					break;
 
 				case HttpExchange::Status::Moved:
+				{
+					std::lock_guard<std::mutex> pipeline_lock(_pipeline_mutex);
+
+					// Check the status again with the lock, because the exchange may have been completed by another thread
+					// (OnExchangeCompleted() is called with the lock after the status is changed)
+					if (_http_transaction->GetStatus() == HttpExchange::Status::Moved)
+					{
+						_pending_exchange = _http_transaction;
+					}
+
 					_http_transaction.reset();
 					break;
+				}
 					
 				case HttpExchange::Status::Error:
 					Close(PhysicalPortDisconnectReason::Error);
@@ -22,6 +22,8 @@
 //TODO(Getroot) : Move to Server.xml
 #define HTTP_CONNECTION_TIMEOUT_MS		60 * 1000
 #define WEBSOCKET_CONNECTION_TIMEOUT_MS	WEBSOCKET_PING_INTERVAL_MS * 3
+// The maximum size of the pipelined requests waiting for the previous response
+#define HTTP_MAX_PIPELINED_DATA_SIZE	(1024 * 1024)
 
 namespace http
 {
@@ -77,8 +79,14 @@ namespace http
 			std::map<ov::String, std::any> GetUserDataMap() const;
 
 		private:
+			void ProcessData(const std::shared_ptr<const ov::Data> &data);
+
 			// For HTTP 1.0 and HTTP 1.1
 			ssize_t OnHttp1RequestReceived(const std::shared_ptr<const ov::Data> &data);
+			bool IsHttp1() const;
+			// Keeps the data until the pending exchange is responded (must be called with _pipeline_mutex locked)
+			bool AppendPipelinedData(const std::shared_ptr<const ov::Data> &data);
+			void ProcessPipelinedData();
 			ssize_t OnHttp2RequestReceived(const std::shared_ptr<const ov::Data> &data);
 			ssize_t OnWebSocketDataReceived(const std::shared_ptr<const ov::Data> &data);
 
@@ -107,6 +115,14 @@ namespace http
 			///////////////////////
 			std::shared_ptr<h1::HttpTransaction> _http_transaction = nullptr;
 
+			// HTTP/1.1 pipelining: The responses must be sent in the order of the requests.
+			// While a request is responded asynchronously (Status::Moved), the following requests are kept in
+			// _pipelined_data, and processed after the pending exchange is completed.
+			std::mutex _pipeline_mutex;
+			std::shared_ptr<HttpExchange> _pending_exchange = nullptr;
+			std::shared_ptr<ov::Data> _pipelined_data = nullptr;
+			bool _is_pipelined_data_scheduled = false;
+
 			///////////////////////
 			// For HTTP/2.0
 			///////////////////////
@@ -8,6 +8,8 @@
 //==============================================================================
 #include "http_default_interceptor.h"
 
+#include <monitoring/histogram_registry.h>
+
 #include "./http_server_private.h"
 #include "http_exchange.h"
 
@@ -38,19 +40,32 @@ namespace http
 
 			if (error == nullptr)
 			{
+				// The routes of the same method and pattern (e.g. of the servers of the other ports) share a histogram
+				auto labels = ov::String::FormatString("method=\"%s\",pattern=\"%s\"",
+													   mon::HistogramRegistry::EscapeLabelValue(StringFromMethod(method)).CStr(),
+													   mon::HistogramRegistry::EscapeLabelValue(whole_pattern).CStr());
+
+				auto latency = mon::HistogramRegistry::GetInstance()->Get(
+					"ome_http_route_duration_microseconds",
+					"Processing time of the handlers of the HTTP routes",
+					labels);
+
 				// if mehotd == GET, set HEAD automatically
 				if (HTTP_CHECK_METHOD(method, Method::Get))
 				{
 					method |= Method::Head;
 				}
 
+				_route_table.Add(_request_handler_list.size(), whole_pattern);
+
 				_request_handler_list.push_back((RequestInfo) {
 #if DEBUG
 					.pattern_string = whole_pattern,
 #endif	// DEBUG
 					.pattern = std::move(regex),
 					.method = method,
-					.handler = handler
+					.handler = handler,
+					.latency = latency
 				});
 			}
 			else
@@ -112,8 +127,14 @@ namespace http
 
 			auto uri_target = uri->Path();
 
-			for (auto &request_info : _request_handler_list)
+			// Only the routes whose literal prefix/suffix match the path need to be checked with the regex
+			std::vector<size_t> route_index_list;
+			_route_table.Find(uri_target, &route_index_list);
+
+			for (auto route_index : route_index_list)
 			{
+				auto &request_info = _request_handler_list[route_index];
+
 #if DEBUG
 				logtd("Check if url [%s] is matches [%s]", uri_target.CStr(), request_info.pattern_string.CStr());
 #endif	// DEBUG
@@ -136,8 +157,11 @@ namespace http
 						handler_count++;
 
 						request->SetMatchResult(matches);
-						
+
+						auto start = std::chrono::steady_clock::now();
 						auto request_result = request_info.handler(exchange);
+						request_info.latency->Observe(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
 						if (request_result == NextHandler::DoNotCall)
 						{
 							break;
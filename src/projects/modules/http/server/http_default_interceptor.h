@@ -12,6 +12,7 @@
 
 #include "../http_datastructure.h"
 #include "http_request_interceptor.h"
+#include "http_route_table.h"
 
 namespace http
 {
@@ -95,10 +96,15 @@ namespace http
 				ov::Regex pattern;
 				Method method;
 				RequestHandler handler;
+				// The processing time of the handler in microseconds (registered in mon::HistogramRegistry)
+				std::shared_ptr<ov::Histogram> latency;
 			};
 
 			ov::String _pattern_prefix;
+			// The handlers are called in the order in which they were registered
 			std::vector<RequestInfo> _request_handler_list;
+			// Finds the candidates in _request_handler_list without evaluating all the regexes
+			RouteTable _route_table;
 			CloseHandler _close_handler = nullptr;
 		};
 	}  // namespace svr
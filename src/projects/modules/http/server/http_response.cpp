@@ -17,6 +17,9 @@
 
 #include "./http_server_private.h"
 
+// The maximum size of the buffers merged into a TLS record (16 KB: the maximum size of a TLS record)
+#define HTTP_RESPONSE_MAX_MERGE_SIZE (16 * 1024)
+
 namespace http
 {
 	namespace svr
@@ -304,6 +307,31 @@ namespace http
 		int32_t HttpResponse::Response()
 		{
 			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			// Gather the header and the payload, and send them together
+			_is_gathering = true;
+			auto sent_size = ResponseInternal();
+			_is_gathering = false;
+
+			auto data_list = std::move(_gathered_data_list);
+			_gathered_data_list.clear();
+
+			if (sent_size < 0)
+			{
+				return -1;
+			}
+
+			if ((data_list.empty() == false) && (SendVector(data_list) == false))
+			{
+				logte("Could not send the response: %s", _client_socket->ToString().CStr());
+				return -1;
+			}
+
+			return sent_size;
+		}
+
+		int32_t HttpResponse::ResponseInternal()
+		{
 			_response_time = std::chrono::system_clock::now();
 
 			uint32_t sent_size = 0;
@@ -394,6 +422,13 @@ namespace http
 				return false;
 			}
 
+			if (_is_gathering)
+			{
+				// Clone() doesn't copy the buffer, and keeps the data from being modified by the caller (copy-on-write)
+				_gathered_data_list.push_back(data->Clone());
+				return true;
+			}
+
 			std::shared_ptr<const ov::Data> send_data;
 
 			if (_tls_data == nullptr)
@@ -424,6 +459,99 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::SendVector(const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+		{
+			if (_is_gathering)
+			{
+				for (const auto &data : data_list)
+				{
+					_gathered_data_list.push_back(data->Clone());
+				}
+
+				return true;
+			}
+
+			if (_tls_data == nullptr)
+			{
+				std::vector<std::shared_ptr<const ov::Data>> send_data_list;
+				send_data_list.reserve(data_list.size());
+
+				for (const auto &data : data_list)
+				{
+					send_data_list.push_back(data->Clone());
+				}
+
+				return _client_socket->SendVector(send_data_list);
+			}
+
+			std::lock_guard<std::mutex> lock(_tls_data->GetSequentialSendMutex());
+
+			// SSL_write() makes at least one record per call, so the small buffers (header, chunk header, ...) are
+			// merged before encryption. Large buffers are encrypted as they are to avoid copying them.
+			std::vector<std::shared_ptr<const ov::Data>> cipher_data_list;
+			std::shared_ptr<ov::Data> merged_data;
+
+			auto encrypt = [&](const std::shared_ptr<const ov::Data> &plain_data) -> bool {
+				std::shared_ptr<const ov::Data> cipher_data;
+
+				if (_tls_data->Encrypt(plain_data, &cipher_data) == false)
+				{
+					logte("Failed to encrypt data: %s", _client_socket->ToString().CStr());
+					return false;
+				}
+
+				if ((cipher_data != nullptr) && (cipher_data->IsEmpty() == false))
+				{
+					cipher_data_list.push_back(cipher_data);
+				}
+
+				return true;
+			};
+
+			for (const auto &data : data_list)
+			{
+				if ((merged_data != nullptr) && ((merged_data->GetLength() + data->GetLength()) > HTTP_RESPONSE_MAX_MERGE_SIZE))
+				{
+					if (encrypt(merged_data) == false)
+					{
+						return false;
+					}
+
+					merged_data.reset();
+				}
+
+				if (data->GetLength() >= HTTP_RESPONSE_MAX_MERGE_SIZE)
+				{
+					if (encrypt(data) == false)
+					{
+						return false;
+					}
+
+					continue;
+				}
+
+				if (merged_data == nullptr)
+				{
+					merged_data = std::make_shared<ov::Data>(HTTP_RESPONSE_MAX_MERGE_SIZE);
+				}
+
+				merged_data->Append(data);
+			}
+
+			if ((merged_data != nullptr) && (encrypt(merged_data) == false))
+			{
+				return false;
+			}
+
+			if (cipher_data_list.empty())
+			{
+				// There is no data to send
+				return true;
+			}
+
+			return _client_socket->SendVector(cipher_data_list);
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
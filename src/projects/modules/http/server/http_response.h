@@ -91,11 +91,16 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
-			
+			// Sends the buffers at once: a single sendmsg() for plain connections,
+			// and as few TLS records as possible for TLS connections
+			bool SendVector(const std::vector<std::shared_ptr<const ov::Data>> &data_list);
+
 		private:
 			virtual int32_t SendHeader();
 			virtual int32_t SendPayload();
 
+			int32_t ResponseInternal();
+
 			ov::String GetEtag();
 
 			std::shared_ptr<ov::ClientSocket> _client_socket;
@@ -105,6 +110,10 @@ namespace http
 			ov::String _reason = StringFromStatusCode(StatusCode::OK);
 
 			bool _is_header_sent = false;
+
+			// While Response() is running, Send() collects the data (header, payload, ...) here instead of sending it
+			bool _is_gathering = false;
+			std::vector<std::shared_ptr<const ov::Data>> _gathered_data_list;
 			
 			// FIXME(dimiden): It is supposed to be synchronized whenever a packet is sent, but performance needs to be improved
 			std::recursive_mutex _response_mutex;
@@ -0,0 +1,380 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http_route_table.h"
+
+#include "./http_server_private.h"
+
+namespace http
+{
+	namespace svr
+	{
+		namespace
+		{
+			struct Token
+			{
+				bool is_literal = false;
+				char character = '\0';
+			};
+
+			// Moves the index after the character class ("[...]")
+			bool SkipClass(const char *pattern, size_t length, size_t *index)
+			{
+				auto current = *index + 1;
+
+				if ((current < length) && (pattern[current] == '^'))
+				{
+					current++;
+				}
+
+				// "]" right after "[" or "[^" is a literal
+				if ((current < length) && (pattern[current] == ']'))
+				{
+					current++;
+				}
+
+				while (current < length)
+				{
+					switch (pattern[current])
+					{
+						case '\\':
+							current += 2;
+							break;
+
+						case ']':
+							*index = current + 1;
+							return true;
+
+						default:
+							current++;
+							break;
+					}
+				}
+
+				return false;
+			}
+
+			// Moves the index after the group ("(...)")
+			bool SkipGroup(const char *pattern, size_t length, size_t *index)
+			{
+				auto current = *index + 1;
+				int depth = 1;
+
+				while (current < length)
+				{
+					switch (pattern[current])
+					{
+						case '\\':
+							current += 2;
+							break;
+
+						case '[':
+							if (SkipClass(pattern, length, &current) == false)
+							{
+								return false;
+							}
+							break;
+
+						case '(':
+							depth++;
+							current++;
+							break;
+
+						case ')':
+							depth--;
+							current++;
+
+							if (depth == 0)
+							{
+								*index = current;
+								return true;
+							}
+							break;
+
+						default:
+							current++;
+							break;
+					}
+				}
+
+				return false;
+			}
+
+			// Moves the index after the quantifier ("*", "+", "?", "{n,m}" and their lazy/possessive forms)
+			bool SkipQuantifier(const char *pattern, size_t length, size_t *index)
+			{
+				auto current = *index;
+
+				if (pattern[current] == '{')
+				{
+					while ((current < length) && (pattern[current] != '}'))
+					{
+						current++;
+					}
+
+					if (current == length)
+					{
+						return false;
+					}
+				}
+
+				current++;
+
+				if ((current < length) && ((pattern[current] == '?') || (pattern[current] == '+')))
+				{
+					current++;
+				}
+
+				*index = current;
+				return true;
+			}
+		}  // namespace
+
+		RouteTable::Literal RouteTable::GetLiteral(const ov::String &pattern)
+		{
+			const char *str = pattern.CStr();
+			auto length = pattern.GetLength();
+			size_t index = 0;
+
+			bool has_start_anchor = (length > 0) && (str[0] == '^');
+			bool has_end_anchor = false;
+
+			if (has_start_anchor)
+			{
+				index++;
+			}
+
+			std::vector<Token> token_list;
+
+			while (index < length)
+			{
+				Token token;
+
+				switch (str[index])
+				{
+					case '\\':
+					{
+						if ((index + 1) >= length)
+						{
+							return {};
+						}
+
+						auto escaped = str[index + 1];
+
+						if (::isalnum(escaped))
+						{
+							// Only the simple character types/assertions are allowed,
+							// the others (\x, \u, \p, \Q, back references, ...) are too complicated to analyze
+							if (::strchr("dDwWsSbB", escaped) == nullptr)
+							{
+								return {};
+							}
+						}
+						else
+						{
+							token.is_literal = true;
+							token.character = escaped;
+						}
+
+						index += 2;
+						break;
+					}
+
+					case '[':
+						if (SkipClass(str, length, &index) == false)
+						{
+							return {};
+						}
+						break;
+
+					case '(':
+						// Inline options such as "(?i)" change the meaning of the following literals
+						if (((index + 2) < length) && (str[index + 1] == '?') && (::strchr("imsxnJU-^", str[index + 2]) != nullptr))
+						{
+							return {};
+						}
+
+						if (SkipGroup(str, length, &index) == false)
+						{
+							return {};
+						}
+						break;
+
+					case '.':
+						index++;
+						break;
+
+					case '$':
+						if ((index + 1) == length)
+						{
+							has_end_anchor = true;
+							index++;
+							continue;
+						}
+
+						return {};
+
+					case '|':
+						// Alternation at the top level
+						return {};
+
+					case '^':
+					case ')':
+					case ']':
+					case '*':
+					case '+':
+					case '?':
+					case '{':
+					case '}':
+						return {};
+
+					default:
+						token.is_literal = true;
+						token.character = str[index];
+						index++;
+						break;
+				}
+
+				if ((index < length) && (::strchr("*+?{", str[index]) != nullptr))
+				{
+					// The token may not appear exactly once
+					token.is_literal = false;
+
+					if (SkipQuantifier(str, length, &index) == false)
+					{
+						return {};
+					}
+				}
+
+				token_list.push_back(token);
+			}
+
+			Literal literal;
+
+			size_t prefix_count = 0;
+			size_t suffix_count = 0;
+
+			if (has_start_anchor)
+			{
+				while ((prefix_count < token_list.size()) && token_list[prefix_count].is_literal)
+				{
+					literal.prefix.Append(token_list[prefix_count].character);
+					prefix_count++;
+				}
+			}
+
+			if (has_end_anchor)
+			{
+				while ((suffix_count < token_list.size()) && token_list[token_list.size() - suffix_count - 1].is_literal)
+				{
+					suffix_count++;
+				}
+
+				for (auto token_index = token_list.size() - suffix_count; token_index < token_list.size(); token_index++)
+				{
+					literal.suffix.Append(token_list[token_index].character);
+				}
+			}
+
+			literal.is_exact = has_start_anchor && has_end_anchor && (prefix_count == token_list.size());
+
+			return literal;
+		}
+
+		void RouteTable::Add(size_t route_index, const ov::String &pattern)
+		{
+			auto literal = GetLiteral(pattern);
+
+			auto node = &_root;
+
+			for (size_t index = 0; index < literal.prefix.GetLength(); index++)
+			{
+				auto &child = node->children[literal.prefix[index]];
+
+				if (child == nullptr)
+				{
+					child = std::make_unique<Node>();
+				}
+
+				node = child.get();
+			}
+
+			node->route_index_list.push_back(route_index);
+
+			if (_literal_list.size() <= route_index)
+			{
+				_literal_list.resize(route_index + 1);
+			}
+
+			_literal_list[route_index] = std::move(literal);
+		}
+
+		void RouteTable::Clear()
+		{
+			_root.children.clear();
+			_root.route_index_list.clear();
+			_literal_list.clear();
+		}
+
+		bool RouteTable::IsCandidate(const Literal &literal, const ov::String &path)
+		{
+			auto path_length = path.GetLength();
+			auto prefix_length = literal.prefix.GetLength();
+
+			if (literal.is_exact)
+			{
+				return (path_length == prefix_length);
+			}
+
+			auto suffix_length = literal.suffix.GetLength();
+
+			// The prefix and the suffix come from different tokens, so they don't overlap
+			if (path_length < (prefix_length + suffix_length))
+			{
+				return false;
+			}
+
+			return (::memcmp(path.CStr() + (path_length - suffix_length), literal.suffix.CStr(), suffix_length) == 0);
+		}
+
+		void RouteTable::Find(const ov::String &path, std::vector<size_t> *route_index_list) const
+		{
+			auto first = route_index_list->size();
+			auto node = &_root;
+			size_t index = 0;
+
+			while (true)
+			{
+				for (auto route_index : node->route_index_list)
+				{
+					if (IsCandidate(_literal_list[route_index], path))
+					{
+						route_index_list->push_back(route_index);
+					}
+				}
+
+				if (index >= path.GetLength())
+				{
+					break;
+				}
+
+				auto child = node->children.find(path[index]);
+
+				if (child == node->children.end())
+				{
+					break;
+				}
+
+				node = child->second.get();
+				index++;
+			}
+
+			// The routes were collected in the order of the prefix length
+			std::sort(route_index_list->begin() + first, route_index_list->end());
+		}
+	}  // namespace svr
+}  // namespace http
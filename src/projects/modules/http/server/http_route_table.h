@@ -0,0 +1,60 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace http
+{
+	namespace svr
+	{
+		// Narrows down the routes (regex patterns) that can match a path, so that the regexes
+		// don't have to be evaluated one by one for every request.
+		//
+		// The literal prefix of each pattern (e.g. "/v1/vhosts/" of "^/v1/vhosts/([^/]*)$") is stored in a trie,
+		// and Find() walks the trie along the path, which is O(path length). The literal suffix is checked
+		// after that, and only the remaining candidates need to be verified with the regex.
+		class RouteTable
+		{
+		public:
+			struct Literal
+			{
+				// The string that every matching path starts with
+				ov::String prefix;
+				// The string that every matching path ends with
+				ov::String suffix;
+				// true if the pattern matches only the prefix itself (no regex syntax is used)
+				bool is_exact = false;
+			};
+
+			// Extracts the literals from a regex pattern.
+			// If the pattern is too complicated to analyze, empty literals are returned, so the route is always a candidate.
+			static Literal GetLiteral(const ov::String &pattern);
+
+			void Add(size_t route_index, const ov::String &pattern);
+			void Clear();
+
+			// Appends the indices of the routes that may match the path, in the order in which they were added
+			void Find(const ov::String &path, std::vector<size_t> *route_index_list) const;
+
+		private:
+			struct Node
+			{
+				std::map<char, std::unique_ptr<Node>> children;
+				// The routes whose prefix ends at this node
+				std::vector<size_t> route_index_list;
+			};
+
+			static bool IsCandidate(const Literal &literal, const ov::String &path);
+
+			Node _root;
+			// index: route index
+			std::vector<Literal> _literal_list;
+		};
+	}  // namespace svr
+}  // namespace http
@@ -29,6 +29,8 @@ namespace http
 		{
 			// PhysicalPort should be stopped before release Server
 			OV_ASSERT(_physical_port == nullptr, "%s: Physical port: %s", _server_name.CStr(), _physical_port->ToString().CStr());
+
+			delete _interceptor_list.load();
 		}
 
 		bool HttpServer::Start(const ov::SocketAddress &address, int worker_count, bool enable_http2)
@@ -97,7 +99,10 @@ namespace http
 				client.second->Close(PhysicalPortDisconnectReason::Disconnect);
 			}
 
-			_interceptor_list.clear();
+			{
+				std::lock_guard<std::mutex> guard(_interceptor_list_mutex);
+				ov::Epoch::Retire(_interceptor_list.exchange(new InterceptorList()));
+			}
 
 			_repeater.Stop();
 
@@ -225,32 +230,47 @@ namespace http
 			}
 		}
 
+		void HttpServer::PostTask(std::function<void()> task)
+		{
+			_repeater.Push(
+				[task = std::move(task)](void *parameter) -> ov::DelayQueueAction {
+					task();
+					return ov::DelayQueueAction::Stop;
+				},
+				0);
+		}
+
 		bool HttpServer::AddInterceptor(const std::shared_ptr<RequestInterceptor> &interceptor)
 		{
-			std::lock_guard<std::shared_mutex> guard(_interceptor_list_mutex);
+			std::lock_guard<std::mutex> guard(_interceptor_list_mutex);
+
+			auto interceptor_list = std::make_unique<InterceptorList>(*_interceptor_list.load());
 
 			// Find interceptor in the list
-			auto item = std::find_if(_interceptor_list.begin(), _interceptor_list.end(), [&](std::shared_ptr<RequestInterceptor> const &value) -> bool {
+			auto item = std::find_if(interceptor_list->begin(), interceptor_list->end(), [&](std::shared_ptr<RequestInterceptor> const &value) -> bool {
 				return value == interceptor;
 			});
 
-			if (item != _interceptor_list.end())
+			if (item != interceptor_list->end())
 			{
 				// interceptor exists in the list
 				logtw("%p is already registered", interceptor.get());
 				return false;
 			}
 
-			_interceptor_list.push_back(interceptor);
+			interceptor_list->push_back(interceptor);
+			ov::Epoch::Retire(_interceptor_list.exchange(interceptor_list.release()));
+
 			return true;
 		}
 
 		std::shared_ptr<RequestInterceptor> HttpServer::FindInterceptor(const std::shared_ptr<HttpExchange> &exchange)
 		{
 			// Find interceptor for the request
-			std::shared_lock<std::shared_mutex> guard(_interceptor_list_mutex);
+			ov::Epoch::Guard guard;
+			auto interceptor_list = _interceptor_list.load();
 
-			for (auto &interceptor : _interceptor_list)
+			for (auto &interceptor : *interceptor_list)
 			{
 				if (interceptor->IsInterceptorForRequest(exchange))
 				{
@@ -265,21 +285,25 @@ namespace http
 
 		bool HttpServer::RemoveInterceptor(const std::shared_ptr<RequestInterceptor> &interceptor)
 		{
-			std::lock_guard<std::shared_mutex> guard(_interceptor_list_mutex);
+			std::lock_guard<std::mutex> guard(_interceptor_list_mutex);
+
+			auto interceptor_list = std::make_unique<InterceptorList>(*_interceptor_list.load());
 
 			// Find interceptor in the list
-			auto item = std::find_if(_interceptor_list.begin(), _interceptor_list.end(), [&](std::shared_ptr<RequestInterceptor> const &value) -> bool {
+			auto item = std::find_if(interceptor_list->begin(), interceptor_list->end(), [&](std::shared_ptr<RequestInterceptor> const &value) -> bool {
 				return value == interceptor;
 			});
 
-			if (item == _interceptor_list.end())
+			if (item == interceptor_list->end())
 			{
 				// interceptor does not exists in the list
 				logtw("%p is not found.", interceptor.get());
 				return false;
 			}
 
-			_interceptor_list.erase(item);
+			interceptor_list->erase(item);
+			ov::Epoch::Retire(_interceptor_list.exchange(interceptor_list.release()));
+
 			return true;
 		}
 
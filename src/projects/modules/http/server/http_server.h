@@ -51,6 +51,9 @@ namespace http
 			bool IsRunning() const;
 			bool IsHttp2Enabled() const;
 
+			// Runs the task on the timer thread of the HTTP servers
+			static void PostTask(std::function<void()> task);
+
 			bool AddInterceptor(const std::shared_ptr<RequestInterceptor> &interceptor);
 			std::shared_ptr<RequestInterceptor> FindInterceptor(const std::shared_ptr<HttpExchange> &exchange);
 			bool RemoveInterceptor(const std::shared_ptr<RequestInterceptor> &interceptor);
@@ -86,8 +89,12 @@ namespace http
 			std::shared_mutex _client_list_mutex;
 			ClientList _connection_list;
 
-			std::shared_mutex _interceptor_list_mutex;
-			std::vector<std::shared_ptr<RequestInterceptor>> _interceptor_list;
+			// FindInterceptor() is called for every request, so the list is replaced as a whole (copy-on-write)
+			// when an interceptor is added/removed, and the readers load it without a lock
+			using InterceptorList = std::vector<std::shared_ptr<RequestInterceptor>>;
+			std::mutex _interceptor_list_mutex;
+			// Loaded in an ov::Epoch::Guard (dispatching a request), and replaced under _interceptor_list_mutex
+			std::atomic<const InterceptorList *> _interceptor_list{new InterceptorList()};
 			std::vector<std::shared_ptr<ocst::VirtualHost>> _virtual_host_list;
 
 		private:
@@ -14,6 +14,7 @@
 #include <base/ovlibrary/ovlibrary.h>
 #include <config/config.h>
 #include <modules/rtc_signalling/rtc_ice_candidate.h>
+#include <monitoring/histogram_registry.h>
 
 #include <algorithm>
 
@@ -199,6 +200,18 @@ std::shared_ptr<PhysicalPort> IcePort::CreatePhysicalPort(const ov::SocketAddres
 	{
 		if (physical_port->AddObserver(this))
 		{
+			auto port = address.Port();
+
+			std::lock_guard<std::shared_mutex> lock(_session_lookup_duration_map_lock);
+
+			if (_session_lookup_duration_map.find(port) == _session_lookup_duration_map.end())
+			{
+				_session_lookup_duration_map[port] = mon::HistogramRegistry::GetInstance()->Get(
+					"ome_ice_session_lookup_duration_nanoseconds",
+					ov::String::FormatString("Time taken to find the ICE session of an incoming packet (1 in %d lookups)", ICE_SESSION_LOOKUP_SAMPLE_INTERVAL),
+					ov::String::FormatString("port=\"%u\"", port));
+			}
+
 			return physical_port;
 		}
 
@@ -239,13 +252,11 @@ bool IcePort::Close()
 
 ov::String IcePort::GenerateUfrag()
 {
-	std::shared_lock<std::shared_mutex> lock(_ice_sessions_with_ufrag_lock);
-
 	while (true)
 	{
 		ov::String ufrag = ov::Random::GenerateString(6);
 
-		if (_ice_sessions_with_ufrag.find(ufrag) == _ice_sessions_with_ufrag.end())
+		if (_ice_sessions_with_ufrag.Contains(ufrag) == false)
 		{
 			logtd("Generated ufrag: %s", ufrag.CStr());
 
@@ -256,77 +267,54 @@ ov::String IcePort::GenerateUfrag()
 
 bool IcePort::AddIceSession(session_id_t session_id, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-	auto item = _ice_seesions_with_id.find(session_id);
-	if (item == _ice_seesions_with_id.end())
-	{
-		_ice_seesions_with_id.emplace(session_id, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_id.Insert(session_id, ice_session);
 }
 
 bool IcePort::AddIceSession(const ov::String &local_ufrag, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-	auto item = _ice_sessions_with_ufrag.find(local_ufrag);
-	if (item == _ice_sessions_with_ufrag.end())
-	{
-		_ice_sessions_with_ufrag.emplace(local_ufrag, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_ufrag.Insert(local_ufrag, ice_session);
 }
 
 bool IcePort::AddIceSession(const ov::SocketAddressPair &address_pair, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(address_pair);
-	if (item == _ice_sessions_with_address_pair.end())
-	{
-		_ice_sessions_with_address_pair.emplace(address_pair, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_address_pair.Insert(address_pair, ice_session);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(session_id_t session_id)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_seesions_with_id.find(session_id);
-	if (item != _ice_seesions_with_id.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_id.Find(session_id);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::String &local_ufrag)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-	auto item = _ice_sessions_with_ufrag.find(local_ufrag);
-	if (item != _ice_sessions_with_ufrag.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_ufrag.Find(local_ufrag);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::SocketAddressPair &socket_address_pair)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(socket_address_pair);
-	if (item != _ice_sessions_with_address_pair.end())
+	// Called for every incoming packet after the session is connected, so only some of the lookups are timed
+	thread_local uint32_t lookup_count = 0;
+
+	if ((++lookup_count % ICE_SESSION_LOOKUP_SAMPLE_INTERVAL) != 0)
 	{
-		return item->second;
+		return _ice_sessions_with_address_pair.Find(socket_address_pair);
 	}
 
-	return nullptr;
+	auto start = std::chrono::steady_clock::now();
+
+	auto ice_session = _ice_sessions_with_address_pair.Find(socket_address_pair);
+
+	auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+	std::shared_lock<std::shared_mutex> lock(_session_lookup_duration_map_lock);
+
+	auto item = _session_lookup_duration_map.find(socket_address_pair.GetLocalAddress().Port());
+	if (item != _session_lookup_duration_map.end())
+	{
+		item->second->Observe(duration_ns);
+	}
+
+	return ice_session;
 }
 
 session_id_t IcePort::IssueUniqueSessionId()
@@ -365,9 +353,55 @@ void IcePort::AddSession(const std::shared_ptr<IcePortObserver> &observer, sessi
 		return;
 	}
 
+	ScheduleSessionExpiryTimer(new_session, new_session->GetRemainingTimeMs());
+
 	logti("Added session: %d (ufrag: %s:%s)", session_id, local_ufrag.CStr(), peer_ufrag.CStr());
 }
 
+void IcePort::ScheduleSessionExpiryTimer(const std::shared_ptr<IceSession> &ice_session, int64_t after_msec)
+{
+	std::weak_ptr<IcePort> port_ref = GetSharedPtr();
+	std::weak_ptr<IceSession> session_ref = ice_session;
+
+	auto timer_id = ov::TimerWheel::GetSharedInstance()->Schedule(
+		after_msec,
+		[port_ref, session_ref]() {
+			auto port = port_ref.lock();
+			auto session = session_ref.lock();
+
+			if ((port != nullptr) && (session != nullptr))
+			{
+				port->OnSessionExpiryTimer(session);
+			}
+		});
+
+	ice_session->SetExpiryTimerId(timer_id);
+}
+
+void IcePort::OnSessionExpiryTimer(const std::shared_ptr<IceSession> &ice_session)
+{
+	if (FindIceSession(ice_session->GetSessionID()) != ice_session)
+	{
+		// Already removed
+		return;
+	}
+
+	if (ice_session->IsExpired() == false)
+	{
+		// The session was refreshed by incoming packets after the timer was scheduled
+		ScheduleSessionExpiryTimer(ice_session, std::max<int64_t>(ice_session->GetRemainingTimeMs(), 1));
+		return;
+	}
+
+	AddTerminatedSession(ice_session);
+}
+
+void IcePort::AddTerminatedSession(const std::shared_ptr<IceSession> &ice_session)
+{
+	std::lock_guard<std::mutex> lock_guard(_terminated_session_list_mutex);
+	_terminated_session_list.push_back(ice_session);
+}
+
 bool IcePort::DisconnectSession(session_id_t session_id)
 {
 	auto ice_session = FindIceSession(session_id);
@@ -379,6 +413,7 @@ bool IcePort::DisconnectSession(session_id_t session_id)
 
 	// It will be deleted in the next timer (for thread safety)
 	ice_session->SetState(IceConnectionState::Disconnecting);
+	AddTerminatedSession(ice_session);
 
 	return true;
 }
@@ -396,29 +431,28 @@ bool IcePort::RemoveSession(session_id_t session_id)
 	size_t ice_sessions_with_ufrag_size = 0;
 	size_t ice_sessions_with_address_pair_size = 0;
 
+	ov::TimerWheel::GetSharedInstance()->Cancel(ice_session->GetExpiryTimerId());
+
 	// Remove from _ice_sessions_with_id
+	if (_ice_sessions_with_id.Remove(session_id) == false)
 	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-		_ice_seesions_with_id.erase(session_id);
-		ice_sessions_with_id_size = _ice_seesions_with_id.size();
+		// Removed by another thread
+		return false;
 	}
+	ice_sessions_with_id_size = _ice_sessions_with_id.GetSize();
 
 	// Remove from _ice_sessions_with_ufrag
-	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-		_ice_sessions_with_ufrag.erase(ice_session->GetLocalUfrag());
-		ice_sessions_with_ufrag_size = _ice_sessions_with_ufrag.size();
-	}
+	_ice_sessions_with_ufrag.Remove(ice_session->GetLocalUfrag());
+	ice_sessions_with_ufrag_size = _ice_sessions_with_ufrag.GetSize();
 
 	// Remove from _ice_sessions_with_address_pair if it exists
 	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
 		auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
 		if (connected_candidate_pair != nullptr)
 		{
-			_ice_sessions_with_address_pair.erase(connected_candidate_pair->GetAddressPair());
+			_ice_sessions_with_address_pair.Remove(connected_candidate_pair->GetAddressPair());
 		}
-		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.size();
+		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.GetSize();
 	}
 
 	{
@@ -448,7 +482,21 @@ bool IcePort::StoreIceSessionWithTransactionId(const std::shared_ptr<IceSession>
 		return false;
 	}
 
-	_binding_requests_with_transaction_id.emplace(transaction_id, BindingRequestInfo(transaction_id, ice_session));
+	BindingRequestInfo request_info(transaction_id, ice_session);
+
+	std::weak_ptr<IcePort> port_ref = GetSharedPtr();
+	request_info._timer_id = ov::TimerWheel::GetSharedInstance()->Schedule(
+		BINDING_REQUEST_TIMEOUT_MS,
+		[port_ref, transaction_id]() {
+			auto port = port_ref.lock();
+
+			if (port != nullptr)
+			{
+				port->RemoveTransaction(transaction_id);
+			}
+		});
+
+	_binding_requests_with_transaction_id.emplace(transaction_id, request_info);
 
 	return true;
 }
@@ -474,6 +522,7 @@ bool IcePort::RemoveTransaction(const ov::String &transaction_id)
 		return false;
 	}
 
+	ov::TimerWheel::GetSharedInstance()->Cancel(item->second._timer_id);
 	_binding_requests_with_transaction_id.erase(item);
 
 	return true;
@@ -481,42 +530,21 @@ bool IcePort::RemoveTransaction(const ov::String &transaction_id)
 
 void IcePort::CheckTimedOut()
 {
-	// Remove expired transction items
-	{
-		std::lock_guard<std::shared_mutex> brt_lock(_binding_requests_with_transaction_id_lock);
-
-		for (auto it = _binding_requests_with_transaction_id.begin(); it != _binding_requests_with_transaction_id.end();)
-		{
-			if (it->second.IsExpired())
-			{
-				it = _binding_requests_with_transaction_id.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
-	}
-
-	// Collect terminated sessions for thread safety
+	// Expired sessions and transactions are collected by the timer wheel, so there is no need to scan all of them
 	std::vector<std::shared_ptr<IceSession>> terminated_session_list;
 	{
-		std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-
-		for (const auto &item : _ice_seesions_with_id)
-		{
-			auto session = item.second;
-			if (session->IsExpired() || session->GetState() == IceConnectionState::Disconnecting)
-			{
-				terminated_session_list.push_back(session);
-			}
-		}
+		std::lock_guard<std::mutex> lock_guard(_terminated_session_list_mutex);
+		terminated_session_list.swap(_terminated_session_list);
 	}
 
 	// Remove terminated sessions and notify
 	for (auto &terminated_session : terminated_session_list)
 	{
-		RemoveSession(terminated_session->GetSessionID());
+		if (RemoveSession(terminated_session->GetSessionID()) == false)
+		{
+			// Already removed
+			continue;
+		}
 
 		auto connected_candidate_pair = terminated_session->GetConnectedCandidatePair();
 
@@ -1028,10 +1056,8 @@ bool IcePort::SendStunBindingRequest(const std::shared_ptr<ov::Socket> &remote,
 
 	// Store binding request transction
 	{
-		std::lock_guard<std::shared_mutex> brt_lock(_binding_requests_with_transaction_id_lock);
-
 		ov::String transaction_id_key((char *)(&transaction_id[0]), OV_STUN_TRANSACTION_ID_LENGTH);
-		_binding_requests_with_transaction_id.emplace(transaction_id_key, BindingRequestInfo(transaction_id_key, ice_session));
+		StoreIceSessionWithTransactionId(ice_session, transaction_id_key);
 
 		logtd("Send Binding Request to(%s) id(%s)", address_pair.ToString().CStr(), transaction_id_key.CStr());
 	}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ice_session.h"
+#include "ice_session_table.h"
 #include "ice_port_observer.h"
 #include "ice_tcp_demultiplexer.h"
 #include "modules/ice/stun/stun_message.h"
@@ -34,9 +35,16 @@
 
 #define OV_ICE_PORT_PUBLIC_IP "${PublicIP}"
 
+// A binding request is removed if the response is not received within this time
+#define BINDING_REQUEST_TIMEOUT_MS 3000
+
+// One in this many lookups of the session of an incoming packet is timed, so the histogram
+// doesn't add contention to every packet
+#define ICE_SESSION_LOOKUP_SAMPLE_INTERVAL 64
+
 class RtcIceCandidate;
 
-class IcePort : protected PhysicalPortObserver
+class IcePort : protected PhysicalPortObserver, public ov::EnableSharedFromThis<IcePort>
 {
 public:
 	IcePort();
@@ -128,7 +136,7 @@ private:
 
 		bool IsExpired() const
 		{
-			if (ov::Clock::GetElapsedMiliSecondsFromNow(_requested_time) > 3000)
+			if (ov::Clock::GetElapsedMiliSecondsFromNow(_requested_time) > BINDING_REQUEST_TIMEOUT_MS)
 			{
 				return true;
 			}
@@ -138,9 +146,20 @@ private:
 
 		ov::String _transaction_id;
 		std::shared_ptr<IceSession> _ice_session;
+		// Removes the request when the response is not received
+		ov::TimerWheel::TimerId _timer_id = ov::TimerWheel::InvalidTimerId;
 		std::chrono::time_point<std::chrono::system_clock>	_requested_time;
 	};
 
+	// Compares only the address storage like std::less<ov::SocketAddressPair>
+	struct SocketAddressPairEqual
+	{
+		bool operator()(const ov::SocketAddressPair &pair1, const ov::SocketAddressPair &pair2) const
+		{
+			return ((pair1 < pair2) == false) && ((pair2 < pair1) == false);
+		}
+	};
+
 	std::atomic<session_id_t> _session_id_counter;
 
 	// Add IceSession
@@ -157,6 +176,11 @@ private:
 	std::shared_ptr<IceSession> FindIceSessionWithTransactionId(const ov::String &transaction_id);
 	bool RemoveTransaction(const ov::String &transaction_id);
 
+	// Registers the session to the shared timer wheel instead of scanning all sessions periodically
+	void ScheduleSessionExpiryTimer(const std::shared_ptr<IceSession> &ice_session, int64_t after_msec);
+	void OnSessionExpiryTimer(const std::shared_ptr<IceSession> &ice_session);
+	void AddTerminatedSession(const std::shared_ptr<IceSession> &ice_session);
+
 	void CheckTimedOut();
 
 	void OnPacketReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair,
@@ -208,17 +232,23 @@ private:
 	// Mapping table containing related information until STUN binding.
 	// Once binding is complete, there is no need because it can be found by destination ip & port.
 	// key: offer ufrag
-	std::shared_mutex _ice_sessions_with_ufrag_lock;
-	std::map<const ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
+	IceSessionTable<ov::String> _ice_sessions_with_ufrag;
 	
 	// Find IceSession with connected CandidatePair, used when receiving TURN channel data and application data
 	// key: SocketAddressPair
-	std::shared_mutex _ice_sessions_with_address_pair_lock;
-	std::map<ov::SocketAddressPair, std::shared_ptr<IceSession>> _ice_sessions_with_address_pair;
+	IceSessionTable<ov::SocketAddressPair, std::hash<ov::SocketAddressPair>, SocketAddressPairEqual> _ice_sessions_with_address_pair;
 	
 	// Find IceSession with peer's session id, used for sending application data 
-	std::shared_mutex _ice_sessions_with_id_lock;
-	std::map<session_id_t, std::shared_ptr<IceSession>> _ice_seesions_with_id;
+	IceSessionTable<session_id_t> _ice_sessions_with_id;
+
+	// Sessions expired or disconnected, they are removed by CheckTimedOut()
+	std::mutex _terminated_session_list_mutex;
+	std::vector<std::shared_ptr<IceSession>> _terminated_session_list;
+
+	// The histograms of the session lookup latency, registered for each local port when the physical port is created
+	// key: local port
+	std::shared_mutex _session_lookup_duration_map_lock;
+	std::map<uint16_t, std::shared_ptr<ov::Histogram>> _session_lookup_duration_map;
 
 	// Insert item when send stun binding request
 	// Remove item when receive stun binding response or timed out
@@ -31,6 +31,11 @@ public:
 	
 	void Refresh();
     bool IsExpired() const;
+	// Time until the session expires if it is not refreshed (0 if it is already expired)
+	int64_t GetRemainingTimeMs() const;
+
+	void SetExpiryTimerId(ov::TimerWheel::TimerId timer_id);
+	ov::TimerWheel::TimerId GetExpiryTimerId() const;
 
 	// State management
 	void SetState(IceConnectionState state);
@@ -114,6 +119,7 @@ private:
 	std::chrono::time_point<std::chrono::system_clock> _expire_time;
 	const int _expire_after_ms;
 	const uint64_t _lifetime_epoch_ms;
+	std::atomic<ov::TimerWheel::TimerId> _expiry_timer_id = ov::TimerWheel::InvalidTimerId;
 
     // interfaces
     std::any _user_data;
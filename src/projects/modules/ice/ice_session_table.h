@@ -0,0 +1,256 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class IceSession;
+
+// A sharded open-addressing hash table used to find IceSession for every incoming packet.
+//
+// Each shard holds an immutable table (linear probing), and a writer replaces the table of the shard
+// with a new one (copy-on-write). So readers never wait for a writer or for other readers:
+// they only load the table pointer of the shard in an ov::Epoch::Guard and probe it.
+// The replaced tables are deleted by ov::Epoch when no reader can see them.
+// Writes only happen when a session is added/connected/removed, and only copy a single shard.
+template <typename Tkey, typename Thash = std::hash<Tkey>, typename Tequal = std::equal_to<Tkey>>
+class IceSessionTable
+{
+public:
+	using Value = std::shared_ptr<IceSession>;
+
+	// shard_count must be a power of 2
+	explicit IceSessionTable(size_t shard_count = 64)
+		: _shard_count(shard_count),
+		  _shards(std::make_unique<Shard[]>(shard_count))
+	{
+		OV_ASSERT2((shard_count > 0) && ((shard_count & (shard_count - 1)) == 0));
+	}
+
+	~IceSessionTable()
+	{
+		// No reader is left
+		for (size_t index = 0; index < _shard_count; index++)
+		{
+			delete _shards[index].table.load();
+		}
+	}
+
+	// Returns false if the key already exists
+	bool Insert(const Tkey &key, const Value &value)
+	{
+		auto hash = GetHash(key);
+		auto &shard = GetShard(hash);
+
+		std::lock_guard<std::mutex> lock_guard(shard.writer_mutex);
+		auto table = shard.table.load();
+
+		if ((table != nullptr) && (table->Find(hash, key, _equal) != nullptr))
+		{
+			return false;
+		}
+
+		std::vector<Entry> entry_list;
+		if (table != nullptr)
+		{
+			entry_list.reserve(table->entry_list.size() + 1);
+			entry_list.insert(entry_list.end(), table->entry_list.begin(), table->entry_list.end());
+		}
+		entry_list.push_back({hash, key, value});
+
+		ov::Epoch::Retire(shard.table.exchange(Table::Build(std::move(entry_list))));
+		_size++;
+
+		return true;
+	}
+
+	// Returns false if the key does not exist
+	bool Remove(const Tkey &key)
+	{
+		auto hash = GetHash(key);
+		auto &shard = GetShard(hash);
+
+		std::lock_guard<std::mutex> lock_guard(shard.writer_mutex);
+		auto table = shard.table.load();
+
+		if ((table == nullptr) || (table->Find(hash, key, _equal) == nullptr))
+		{
+			return false;
+		}
+
+		std::vector<Entry> entry_list;
+		entry_list.reserve(table->entry_list.size() - 1);
+
+		for (const auto &entry : table->entry_list)
+		{
+			if ((entry.hash != hash) || (_equal(entry.key, key) == false))
+			{
+				entry_list.push_back(entry);
+			}
+		}
+
+		ov::Epoch::Retire(shard.table.exchange(entry_list.empty() ? nullptr : Table::Build(std::move(entry_list))));
+		_size--;
+
+		return true;
+	}
+
+	Value Find(const Tkey &key) const
+	{
+		auto hash = GetHash(key);
+
+		ov::Epoch::Guard guard;
+		auto table = GetShard(hash).table.load();
+
+		if (table == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto entry = table->Find(hash, key, _equal);
+
+		// Copied in the guard, so the session outlives the table
+		return (entry != nullptr) ? entry->value : nullptr;
+	}
+
+	bool Contains(const Tkey &key) const
+	{
+		return Find(key) != nullptr;
+	}
+
+	size_t GetSize() const
+	{
+		return _size;
+	}
+
+	// Iterates a snapshot of each shard
+	void ForEach(const std::function<void(const Tkey &key, const Value &value)> &func) const
+	{
+		ov::Epoch::Guard guard;
+
+		for (size_t index = 0; index < _shard_count; index++)
+		{
+			auto table = _shards[index].table.load();
+
+			if (table != nullptr)
+			{
+				for (const auto &entry : table->entry_list)
+				{
+					func(entry.key, entry.value);
+				}
+			}
+		}
+	}
+
+private:
+	struct Entry
+	{
+		size_t hash;
+		Tkey key;
+		Value value;
+	};
+
+	struct Table
+	{
+		std::vector<Entry> entry_list;
+
+		// Index of entry_list (-1: empty slot)
+		std::vector<int32_t> slot_list;
+		size_t mask = 0;
+
+		static const Table *Build(std::vector<Entry> entry_list)
+		{
+			auto table = new Table();
+
+			// Keep the load factor under 0.5 so that probing ends quickly
+			size_t slot_count = 8;
+			while (slot_count < (entry_list.size() * 2))
+			{
+				slot_count <<= 1;
+			}
+
+			table->slot_list.assign(slot_count, -1);
+			table->mask = slot_count - 1;
+
+			for (size_t index = 0; index < entry_list.size(); index++)
+			{
+				auto slot = entry_list[index].hash & table->mask;
+
+				while (table->slot_list[slot] != -1)
+				{
+					slot = (slot + 1) & table->mask;
+				}
+
+				table->slot_list[slot] = static_cast<int32_t>(index);
+			}
+
+			table->entry_list = std::move(entry_list);
+
+			return table;
+		}
+
+		const Entry *Find(size_t hash, const Tkey &key, const Tequal &equal) const
+		{
+			for (auto slot = hash & mask;; slot = (slot + 1) & mask)
+			{
+				auto index = slot_list[slot];
+
+				if (index == -1)
+				{
+					return nullptr;
+				}
+
+				const auto &entry = entry_list[index];
+
+				if ((entry.hash == hash) && equal(entry.key, key))
+				{
+					return &entry;
+				}
+			}
+		}
+	};
+
+	struct Shard
+	{
+		// Only writers lock it
+		std::mutex writer_mutex;
+		// Loaded in an ov::Epoch::Guard, and replaced with exchange() (seq_cst)
+		std::atomic<const Table *> table{nullptr};
+	};
+
+	size_t GetHash(const Tkey &key) const
+	{
+		// Some hash functions (e.g. ov::SocketAddress::Hash()) have poor distribution in the lower bits,
+		// so mix them (splitmix64 finalizer)
+		uint64_t hash = _hash(key);
+
+		hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+		hash = hash ^ (hash >> 31);
+
+		return static_cast<size_t>(hash);
+	}
+
+	// The upper bits select the shard, and the lower bits select the slot in the shard
+	Shard &GetShard(size_t hash) const
+	{
+		return _shards[(hash >> 48) & (_shard_count - 1)];
+	}
+
+	const size_t _shard_count;
+	std::unique_ptr<Shard[]> _shards;
+	std::atomic<size_t> _size = 0;
+
+	Thash _hash;
+	Tequal _equal;
+};
@@ -58,6 +58,24 @@ namespace serdes
 		return value;
 	}
 
+	Json::Value JsonFromHostMetrics(const std::shared_ptr<const mon::HostMetrics> &metrics)
+	{
+		Json::Value value = JsonFromMetrics(metrics);
+
+		if (value.isNull())
+		{
+			return value;
+		}
+
+		Json::Value &admission_webhooks_cache = value["admissionWebhooksCache"];
+
+		SetInt64(admission_webhooks_cache, "hits", metrics->GetAdmissionWebhooksCacheHits());
+		SetInt64(admission_webhooks_cache, "misses", metrics->GetAdmissionWebhooksCacheMisses());
+		SetInt64(admission_webhooks_cache, "coalesced", metrics->GetAdmissionWebhooksCacheCoalesced());
+
+		return value;
+	}
+
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics)
 	{
 		Json::Value value = JsonFromMetrics(metrics);
@@ -69,6 +87,8 @@ namespace serdes
 
 		SetTimeInterval(value, "requestTimeToOrigin", metrics->GetOriginConnectionTimeMSec());
 		SetTimeInterval(value, "responseTimeFromOrigin", metrics->GetOriginSubscribeTimeMSec());
+		SetInt64(value, "gopCacheSize", metrics->GetGopCacheSize());
+		SetInt64(value, "rtxHistorySize", metrics->GetRtxHistorySize());
 
 		return value;
 	}
@@ -13,6 +13,7 @@
 namespace serdes
 {
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
+	Json::Value JsonFromHostMetrics(const std::shared_ptr<const mon::HostMetrics> &metrics);
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics);
 }  // namespace serdes
\ No newline at end of file
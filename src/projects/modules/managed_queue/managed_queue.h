@@ -19,8 +19,9 @@
 #include "base/info/managed_queue.h"
 #include "base/ovlibrary/ovlibrary.h"
 
-#define MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC 1000
 #define MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC 5000
+// Only 1 in N messages are timestamped for the waiting time statistics (unless the buffering delay is set)
+#define MANAGED_QUEUE_TIMESTAMP_SAMPLING_INTERVAL 16
 
 // Deactivated as it is no longer used
 #define SKIP_MESSAGE_ENABLED false
@@ -42,13 +43,18 @@ namespace ov
 
 			ManagedQueueNode* next;
 
+			// min() if the message is not sampled
 			std::chrono::high_resolution_clock::time_point _start;
 			bool _urgent = false;
 
 			ManagedQueueNode(const T& value, bool urgent, ManagedQueueNode* next_node = nullptr)
 				: data(value), next(next_node), _start(std::chrono::high_resolution_clock::time_point::min()), _urgent(urgent)
 			{
-				_start = std::chrono::high_resolution_clock::now();
+			}
+
+			bool IsSampled() const
+			{
+				return _start != std::chrono::high_resolution_clock::time_point::min();
 			}
 		};
 
@@ -57,15 +63,14 @@ namespace ov
 			: ManagedQueue(nullptr) {}
 
 		ManagedQueue(std::shared_ptr<info::ManagedQueue::URN> urn, size_t threshold = 0, int log_interval_in_msec = MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC)
-			: info::ManagedQueue(threshold),
-			  _stats_metric_interval(MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC),
-			  _log_interval(log_interval_in_msec),
+			: info::ManagedQueue(threshold, log_interval_in_msec),
 			  _front_node(nullptr),
 			  _rear_node(nullptr),
 			  _stop(false),
 			  _skip_message_enabled(false)
 		{
 			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+			_waiting_time_histogram = GetWaitingTimeHistogram(urn);
 
 			// Register to the server metrics
 			// If the Unique id is duplicated or memory allocation failed, retry
@@ -92,6 +97,11 @@ namespace ov
 		{
 			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
 
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_waiting_time_histogram = GetWaitingTimeHistogram(urn);
+			}
+
 			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this, true);
 		}
 
@@ -238,18 +248,23 @@ namespace ov
 			_size--;
 
 			// Update statistics of output message count
-			_output_message_count++;
+			_statistics->output_message_count.fetch_add(1, std::memory_order_relaxed);
 
 			// Update statistics of waiting time (microseconds)
-			if (node->_start != std::chrono::system_clock::time_point::max())
+			if (node->IsSampled())
 			{
 				auto current = std::chrono::high_resolution_clock::now();
-				_waiting_time_in_us = _waiting_time_in_us * 0.9 + std::chrono::duration_cast<std::chrono::microseconds>(current - node->_start).count() * 0.1;
+				auto waiting_time_in_us = std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(current - node->_start).count(), 0);
+
+				_statistics->waiting_time_sum_in_us.fetch_add(waiting_time_in_us, std::memory_order_relaxed);
+				_statistics->waiting_time_sample_count.fetch_add(1, std::memory_order_relaxed);
+
+				_waiting_time_histogram->Observe(waiting_time_in_us);
 			}
 
 			delete node;
 
-			UpdateMetrics();
+			UpdateSize();
 
 			if(_exceed_threshold_and_wait_enabled == true)
 			{
@@ -332,6 +347,7 @@ namespace ov
 		void SetBufferingDelay(int delay_ms)
 		{
 			_buffering_delay = delay_ms;
+			_statistics->buffering_delay_in_ms.store(delay_ms, std::memory_order_relaxed);
 		}
 
 	private:
@@ -343,7 +359,8 @@ namespace ov
 				return 0;
 			}
 
-			if (_front_node->_urgent == true)
+			// The messages are not timestamped if the buffering delay was set after they were enqueued
+			if ((_front_node->_urgent == true) || (_front_node->IsSampled() == false))
 			{
 				return ov::Infinite;
 			}
@@ -374,6 +391,13 @@ namespace ov
 
 			// Update statistics of input message count
 			_input_message_count++;
+			_statistics->input_message_count.fetch_add(1, std::memory_order_relaxed);
+
+			// The buffering delay needs the timestamp of every message
+			if ((_buffering_delay > 0) || ((_input_message_count % MANAGED_QUEUE_TIMESTAMP_SAMPLING_INTERVAL) == 0))
+			{
+				node->_start = std::chrono::high_resolution_clock::now();
+			}
 
 #if SKIP_MESSAGE_ENABLED
 			if (_skip_message_enabled == true)
@@ -398,8 +422,8 @@ namespace ov
 						_skip_messages_last_changed_time = curr_time;
 
 						auto shared_lock = std::shared_lock(_name_mutex);
-						logw(LOG_TAG, "[%s] Managed queue is unstable. q.size(%d), q.threshold(%d) q.imps(%d), q.omps(%d), skip(%d)", _urn->ToString().CStr(),
-							 GetSize(), GetThreshold(), _input_message_per_second, _output_message_per_second, _skip_message_count);
+						logw(LOG_TAG, "[%s] Managed queue is unstable. q.size(%d), q.threshold(%d), skip(%d)", _urn->ToString().CStr(),
+							 GetSize(), GetThreshold(), _skip_message_count);
 					}
 					// If the queue is stable, slowly decrease the number of skip frames.
 					else if ((_skip_message_count > 0) &&										   // Skip Message is operating
@@ -415,8 +439,8 @@ namespace ov
 						_skip_messages_last_changed_time = curr_time;
 
 						auto shared_lock = std::shared_lock(_name_mutex);
-						logi(LOG_TAG, "[%s] Managed queue is stable. q.size(%d), q.threshold(%d) q.imps(%d), q.omps(%d), skip(%d)", _urn->ToString().CStr(),
-							 GetSize(), GetThreshold(), _input_message_per_second, _output_message_per_second, _skip_message_count);
+						logi(LOG_TAG, "[%s] Managed queue is stable. q.size(%d), q.threshold(%d), skip(%d)", _urn->ToString().CStr(),
+							 GetSize(), GetThreshold(), _skip_message_count);
 					}
 				}
 
@@ -427,11 +451,11 @@ namespace ov
 						_skip_messages_last_log_time = curr_time;
 
 						auto shared_lock = std::shared_lock(_name_mutex);
-						logw(LOG_TAG, "[%s] Drop a message by message skip. q.size(%d), q.threshold(%d) q.imps(%d), q.omps(%d), skip(%d)", _urn->ToString().CStr(),
-							 GetSize(), GetThreshold(), _input_message_per_second, _output_message_per_second, _skip_message_count);
+						logw(LOG_TAG, "[%s] Drop a message by message skip. q.size(%d), q.threshold(%d), skip(%d)", _urn->ToString().CStr(),
+							 GetSize(), GetThreshold(), _skip_message_count);
 					}
 
-					_drop_message_count++;
+					_statistics->drop_message_count.fetch_add(1, std::memory_order_relaxed);
 
 					delete node;
 
@@ -448,11 +472,11 @@ namespace ov
 						_skip_messages_last_log_time = curr_time;
 
 						auto shared_lock = std::shared_lock(_name_mutex);
-						logw(LOG_TAG, "[%s] Managed queue is exceed. drop message. q.size(%d), q.threshold(%d) q.imps(%d), q.omps(%d), skip(%d)", _urn->ToString().CStr(),
-							 GetSize(), GetThreshold(), _input_message_per_second, _output_message_per_second, _skip_message_count);
+						logw(LOG_TAG, "[%s] Managed queue is exceed. drop message. q.size(%d), q.threshold(%d), skip(%d)", _urn->ToString().CStr(),
+							 GetSize(), GetThreshold(), _skip_message_count);
 					}
 
-					_drop_message_count++;
+					_statistics->drop_message_count.fetch_add(1, std::memory_order_relaxed);
 					
 					delete node;
 
@@ -489,7 +513,7 @@ namespace ov
 				PushFront(node);
 			}
 
-			UpdateMetrics();
+			UpdateSize();
 
 			if (_buffering_delay == 0)
 			{
@@ -538,91 +562,40 @@ namespace ov
 		}
 
 	protected:
-		// Update statistical metrics and send data to monitoring module.
-		void UpdateMetrics()
+		// Publish the size for the metrics collector (mon::QueueMetrics), which calculates the rest of the statistics
+		void UpdateSize()
 		{
-			// Update the peak statistics
-			if (_peak < _size)
-			{
-				_peak = _size;
-			}
-
-			if (_timer.IsStart() == false)
-			{
-				_timer.Start();
-			}
+			_statistics->size.store(_size, std::memory_order_relaxed);
 
-			if (_timer.IsElapsed(_stats_metric_interval))
+			// Update the peak statistics
+			if (_statistics->peak.load(std::memory_order_relaxed) < _size)
 			{
-				int elapsed_time = _timer.Elapsed();
-				_timer.Update();
-
-				// Update statistics of message per second
-				_input_message_per_second = (double)(_input_message_count - _last_input_message_count) * (1000.0 / (double)elapsed_time);
-				_output_message_per_second = (double)(_output_message_count - _last_output_message_count) * (1000.0 / (double)elapsed_time);
-				_last_input_message_count = _input_message_count;
-				_last_output_message_count = _output_message_count;
-	
-				int adjusted_size = _size;
-
-				if (_buffering_delay > 0)
-				{
-					// excluding the estimated intended buffer size
-					int intended_buffer_size = (double)_input_message_per_second * ((double)_buffering_delay / 1000.0);
-					adjusted_size -= intended_buffer_size;
-
-					// logi("DEBUG", "intended buffer size: %d, input_message_count: %d, input_message_per_second: %d, buffering_delay: %d, size: %d, adjusted_size: %d", intended_buffer_size, _input_message_count, _input_message_per_second, _buffering_delay, _size, adjusted_size);
-					
-					if (adjusted_size < 0)
-					{
-						adjusted_size = 0;
-					}
-				}
-
-				if ((_threshold > 0) && ((size_t)adjusted_size >= _threshold))
-				{
-					_threshold_exceeded_time_in_us += _stats_metric_interval;
-
-					// Logging
-					_last_logging_time += _stats_metric_interval;
-					if ((_last_logging_time >= _log_interval) && (_last_logged_peak < _peak))
-					{
-						_last_logging_time = 0;
-
-						auto shared_lock = std::shared_lock(_name_mutex);
-						logw(LOG_TAG, "[%u] %s has exceeded the threshold and increased peak. size: %zu, threshold: %zu, peak: %zu", GetId(), _urn->ToString().CStr(), _size, _threshold, _peak);
-
-						_last_logged_peak = _peak;
-					}
-				}
-				else
-				{
-					_threshold_exceeded_time_in_us = 0;
-				}
-
-				MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this);
+				_statistics->peak.store(_size, std::memory_order_relaxed);
 			}
 		}
 
 		void ClearMetrics()
 		{
-			_peak = 0;
-			_input_message_per_second = 0;
-			_output_message_per_second = 0;
-			_input_message_count = 0;
-			_output_message_count = 0;
-			_threshold_exceeded_time_in_us = 0;
-
-			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this);
+			_statistics->size.store(0, std::memory_order_relaxed);
+			_statistics->peak.store(0, std::memory_order_relaxed);
 		}
 
 	private:
-		StopWatch _timer;
+		// The queues of the same part share a histogram
+		static std::shared_ptr<ov::Histogram> GetWaitingTimeHistogram(const std::shared_ptr<info::ManagedQueue::URN> &urn)
+		{
+			ov::String part = (urn != nullptr) ? urn->GetPart() : "";
 
-		int _stats_metric_interval = 0;
+			return mon::HistogramRegistry::GetInstance()->Get(
+				"ome_managed_queue_waiting_time_microseconds",
+				"Time that the messages waited in the managed queues",
+				ov::String::FormatString("part=\"%s\"", mon::HistogramRegistry::EscapeLabelValue(part.IsEmpty() ? "unknown" : part).CStr()));
+		}
 
-		int _log_interval = 0;
-		int64_t _last_logging_time = 0;
+		std::shared_ptr<ov::Histogram> _waiting_time_histogram;
+
+		// Input Message Count (for sampling)
+		int64_t _input_message_count = 0;
 
 		// Linked list of the queue
 		ManagedQueueNode* _front_node;
@@ -635,9 +608,6 @@ namespace ov
 		// Stop flag
 		bool _stop;
 
-		// Use to print logs when the peak value of the queue is increased.
-		size_t _last_logged_peak = 0;
-
 		// Message Skip for lack of performance
 		bool _skip_message_enabled = false;
 		int64_t _skip_messages_last_check_time = ov::Time::GetTimestampInMs();
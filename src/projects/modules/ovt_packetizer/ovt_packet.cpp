@@ -36,9 +36,12 @@ OvtPacket::OvtPacket(OvtPacket &src)
 	_payload_length		 = src._payload_length;
 	_is_packet_available = src._is_packet_available;
 
+	// If the payload is referenced, only the header is cloned
 	_data				 = src._data->Clone();
 	_data->SetLength(src._data->GetLength());
 	_buffer = _data->GetWritableDataAs<uint8_t>();
+
+	_payload_list		 = src._payload_list;
 }
 
 OvtPacket::~OvtPacket()
@@ -64,6 +67,8 @@ bool OvtPacket::LoadHeader(const ov::Data &data)
 	}
 
 	_data.reset();
+	_payload_list.clear();
+	_flattened_data.reset();
 
 	_data = std::make_shared<ov::Data>();
 	_data->Reserve(OVT_DEFAULT_MAX_PACKET_SIZE);
@@ -79,13 +84,8 @@ bool OvtPacket::LoadHeader(const ov::Data &data)
 	SetTimestamp(ByteReader<uint64_t>::ReadBigEndian(&buffer[4]));
 	SetSessionId(ByteReader<uint32_t>::ReadBigEndian(&buffer[12]));
 
+	// The payload can be larger than OVT_DEFAULT_MAX_PAYLOAD_SIZE if "maxPayloadSize" is negotiated (up to OVT_MAX_PAYLOAD_SIZE_LIMIT)
 	uint16_t payload_length = ByteReader<uint16_t>::ReadBigEndian(&buffer[16]);
-	if (payload_length > OVT_DEFAULT_MAX_PACKET_SIZE - OVT_FIXED_HEADER_SIZE)
-	{
-		loge("ERROR", "Invalid payload length : %u", payload_length);
-		_is_packet_available = false;
-		return false;
-	}
 	SetPayloadLength(payload_length);
 
 	if (PayloadLength() == 0)
@@ -175,6 +175,11 @@ uint16_t OvtPacket::PayloadLength() const
 
 const uint8_t *OvtPacket::Payload() const
 {
+	if (HasPayloadReferences())
+	{
+		return GetData()->GetDataAs<uint8_t>() + OVT_FIXED_HEADER_SIZE;
+	}
+
 	return &_buffer[OVT_FIXED_HEADER_SIZE];
 }
 
@@ -185,12 +190,51 @@ const uint8_t *OvtPacket::GetBuffer() const
 
 const std::shared_ptr<ov::Data> &OvtPacket::GetData() const
 {
-	return _data;
+	if (HasPayloadReferences() == false)
+	{
+		return _data;
+	}
+
+	if (_flattened_data == nullptr)
+	{
+		auto flattened_data = std::make_shared<ov::Data>(GetDataLength());
+
+		flattened_data->Append(_data);
+		for (const auto &payload : _payload_list)
+		{
+			flattened_data->Append(payload);
+		}
+
+		_flattened_data = flattened_data;
+	}
+
+	return _flattened_data;
+}
+
+std::vector<std::shared_ptr<const ov::Data>> OvtPacket::GetDataList() const
+{
+	std::vector<std::shared_ptr<const ov::Data>> data_list;
+
+	if (_data == nullptr)
+	{
+		return data_list;
+	}
+
+	data_list.reserve(1 + _payload_list.size());
+	data_list.push_back(_data);
+	data_list.insert(data_list.end(), _payload_list.begin(), _payload_list.end());
+
+	return data_list;
 }
 
 size_t OvtPacket::GetDataLength() const
 {
-	return _data == nullptr ? 0 : _data->GetLength();
+	if (_data == nullptr)
+	{
+		return 0;
+	}
+
+	return HasPayloadReferences() ? (OVT_FIXED_HEADER_SIZE + _payload_length) : _data->GetLength();
 }
 
 void OvtPacket::SetMarker(bool marker_bit)
@@ -243,19 +287,23 @@ void OvtPacket::SetPayloadLength(size_t payload_length)
 	_payload_length = payload_length;
 	ByteWriter<uint16_t>::WriteBigEndian(&_buffer[16], _payload_length);
 
-	_data->SetLength(OVT_FIXED_HEADER_SIZE + payload_length);
+	// If the payload is referenced, _data contains the header only
+	_data->SetLength(OVT_FIXED_HEADER_SIZE + (HasPayloadReferences() ? 0 : payload_length));
 	_buffer = _data->GetWritableDataAs<uint8_t>();
 }
 
 bool OvtPacket::SetPayload(const uint8_t *payload, size_t payload_length)
 {
-	if (OVT_FIXED_HEADER_SIZE + payload_length > _data->GetCapacity())
+	if (payload_length > OVT_MAX_PAYLOAD_SIZE_LIMIT)
 	{
-		OV_ASSERT(false, "Data capacity must be greater than %ld (packet : %ld)",
-				  _data->GetCapacity(), OVT_FIXED_HEADER_SIZE + payload_length);
+		OV_ASSERT(false, "Payload length must be less than or equal to %d (payload : %zu)",
+				  OVT_MAX_PAYLOAD_SIZE_LIMIT, payload_length);
 		return false;
 	}
 
+	_payload_list.clear();
+	_flattened_data.reset();
+
 	SetPayloadLength(payload_length);
 
 	// OVT_DEFAULT_MAX_PACKET_SIZE
@@ -266,3 +314,114 @@ bool OvtPacket::SetPayload(const uint8_t *payload, size_t payload_length)
 
 	return true;
 }
+
+bool OvtPacket::SetPayloadReferences(const std::vector<std::shared_ptr<const ov::Data>> &payload_list)
+{
+	size_t payload_length = 0;
+
+	for (const auto &payload : payload_list)
+	{
+		payload_length += payload->GetLength();
+	}
+
+	if (payload_length > OVT_MAX_PAYLOAD_SIZE_LIMIT)
+	{
+		OV_ASSERT(false, "Payload length must be less than or equal to %d (payload : %zu)",
+				  OVT_MAX_PAYLOAD_SIZE_LIMIT, payload_length);
+		return false;
+	}
+
+	_payload_list = payload_list;
+	_flattened_data.reset();
+
+	SetPayloadLength(payload_length);
+
+	_is_packet_available = true;
+
+	return true;
+}
+
+bool OvtPacket::HasPayloadReferences() const
+{
+	return _payload_list.empty() == false;
+}
+
+std::vector<std::shared_ptr<OvtPacket>> OvtPacket::Fragment(size_t max_payload_size) const
+{
+	std::vector<std::shared_ptr<OvtPacket>> packets;
+
+	if (max_payload_size == 0)
+	{
+		return packets;
+	}
+
+	std::vector<std::shared_ptr<const ov::Data>> payload_list;
+
+	if (HasPayloadReferences())
+	{
+		payload_list = _payload_list;
+	}
+	else if (_payload_length > 0)
+	{
+		payload_list.push_back(std::const_pointer_cast<const ov::Data>(_data)->Subdata(OVT_FIXED_HEADER_SIZE, _payload_length));
+	}
+
+	size_t offset = 0;
+
+	do
+	{
+		auto fragment_length = std::min(max_payload_size, static_cast<size_t>(_payload_length) - offset);
+
+		auto packet = std::make_shared<OvtPacket>();
+		packet->SetPayloadType(_payload_type);
+		packet->SetSequenceNumber(_sequence_number);
+		packet->SetTimestamp(_timestamp);
+		packet->SetSessionId(_session_id);
+		packet->SetPayloadReferences(SliceDataList(payload_list, offset, fragment_length));
+
+		offset += fragment_length;
+
+		packet->SetMarker((offset == _payload_length) ? Marker() : false);
+
+		packets.push_back(packet);
+	} while (offset < _payload_length);
+
+	return packets;
+}
+
+std::vector<std::shared_ptr<const ov::Data>> OvtPacket::SliceDataList(const std::vector<std::shared_ptr<const ov::Data>> &data_list, size_t offset, size_t length)
+{
+	std::vector<std::shared_ptr<const ov::Data>> slice_list;
+
+	for (const auto &data : data_list)
+	{
+		if (length == 0)
+		{
+			break;
+		}
+
+		auto data_length = data->GetLength();
+
+		if (offset >= data_length)
+		{
+			offset -= data_length;
+			continue;
+		}
+
+		auto slice_length = std::min(length, data_length - offset);
+
+		if ((offset == 0) && (slice_length == data_length))
+		{
+			slice_list.push_back(data);
+		}
+		else
+		{
+			slice_list.push_back(data->Subdata(offset, slice_length));
+		}
+
+		length -= slice_length;
+		offset = 0;
+	}
+
+	return slice_list;
+}
@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include <memory>
+#include <vector>
 #include <base/common_types.h>
 #include <base/ovlibrary/ovlibrary.h>
 
@@ -108,7 +109,8 @@
  		{
  			"id": 3921932,
 			"application" : "play", "stop",
- 			"target": "ovt://host:port/app/stream"
+ 			"target": "ovt://host:port/app/stream",
+			"maxPayloadSize" : 65535 // Optional (play only), the largest payload the client can receive
  		}
 
  		<! Later version can be extended to specify tracks or add other options. >
@@ -125,13 +127,17 @@
 			"application" : "play" | "stop",
 			"code" : 200 | 404 | 500,
 			"message" : "ok" | "app/stream not found" | "Internal Server Error",
+			"contents" :
+			{
+				"maxPayloadSize" : 65535 // Payload size of MEDIA packets, 32750 if the client did not request it
+			}
 		}
 
 		while(STOP or DISCONNECTED)
 		{
 			M  : 0 or 1
 			PT : MEDIA (30)
-			SI : 11992
+			SI : 0 (Media packets are serialized once and shared by all sessions of the stream)
 			SN : 1 ~ rolling
 			TS : Unix timestamp
 			Payload :
@@ -144,7 +150,10 @@
 #define OVT_VERSION							1
 #define OVT_FIXED_HEADER_SIZE				18
 #define OVT_DEFAULT_MAX_PACKET_SIZE			32768
-#define OVT_DEFAULT_MAX_PAYLOAD_SIZE		OVT_DEFAULT_MAX_PACKET_SIZE - OVT_FIXED_HEADER_SIZE;
+#define OVT_DEFAULT_MAX_PAYLOAD_SIZE		(OVT_DEFAULT_MAX_PACKET_SIZE - OVT_FIXED_HEADER_SIZE)
+// Payload Length is a 16-bit field, so a payload cannot be larger than this.
+// Peers that announce "maxPayloadSize" in the PLAY request can receive payloads up to this size.
+#define OVT_MAX_PAYLOAD_SIZE_LIMIT			0xFFFF
 
 #define OVT_PAYLOAD_TYPE_MESSAGE_REQUEST	10
 #define OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE	20
@@ -185,11 +194,25 @@ public:
 	void 		SetSessionId(uint32_t session_id);
 
 	bool 		SetPayload(const uint8_t *payload, size_t payload_size);
+	// Scatter/gather framing - The payload is not copied into the packet buffer.
+	// The packet keeps references to the given data (e.g. MediaPacket data), and GetDataList() returns header + references.
+	bool 		SetPayloadReferences(const std::vector<std::shared_ptr<const ov::Data>> &payload_list);
+	bool		HasPayloadReferences() const;
+
+	// Split this packet into packets whose payload is not larger than max_payload_size.
+	// Payloads of the split packets reference the payload of this packet. Only the last one has the marker bit of this packet.
+	std::vector<std::shared_ptr<OvtPacket>> Fragment(size_t max_payload_size) const;
 
 	const uint8_t* GetBuffer() const;
+	// If the payload is referenced, it is flattened into a new buffer (Use GetDataList() instead to avoid copying)
 	const std::shared_ptr<ov::Data>& GetData() const;
+	// [Header, Payload...] to be sent with ov::Socket::SendVector()
+	std::vector<std::shared_ptr<const ov::Data>> GetDataList() const;
 	size_t GetDataLength() const;
 
+	// Returns references to [offset, offset + length) of the data that are concatenated in data_list
+	static std::vector<std::shared_ptr<const ov::Data>> SliceDataList(const std::vector<std::shared_ptr<const ov::Data>> &data_list, size_t offset, size_t length);
+
 private:
 	void 		SetPayloadLength(size_t payload_length);
 
@@ -205,4 +228,8 @@ private:
 
 	uint8_t *					_buffer;
 	std::shared_ptr<ov::Data>	_data;
+
+	// Used when the payload is referenced (_data contains the header only)
+	std::vector<std::shared_ptr<const ov::Data>>	_payload_list;
+	mutable std::shared_ptr<ov::Data>				_flattened_data;
 };
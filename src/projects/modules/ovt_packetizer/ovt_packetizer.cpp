@@ -99,12 +99,11 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 
 	 *********************************************************************/
 
-	ov::Data payload;
+	// Only the header is written into the scratch buffer, and the data of media_packet is referenced.
+	auto header = std::make_shared<ov::Data>(MEDIA_PACKET_HEADER_SIZE);
+	header->SetLength(MEDIA_PACKET_HEADER_SIZE);
 
-	// Header + Data
-	payload.SetLength(MEDIA_PACKET_HEADER_SIZE + media_packet->GetDataLength());
-
-	auto buffer = payload.GetWritableDataAs<uint8_t>();
+	auto buffer = header->GetWritableDataAs<uint8_t>();
 
 	ByteWriter<uint32_t>::WriteBigEndian(&buffer[0], media_packet->GetTrackId());
 	ByteWriter<uint64_t>::WriteBigEndian(&buffer[4], media_packet->GetPts());
@@ -116,37 +115,39 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 	ByteWriter<uint8_t>::WriteBigEndian(&buffer[31], static_cast<int8_t>(media_packet->GetPacketType()));
 	ByteWriter<uint32_t>::WriteBigEndian(&buffer[32], media_packet->GetDataLength());
 
-	if (media_packet->GetData() != nullptr)
+	// Header + Data
+	std::vector<std::shared_ptr<const ov::Data>> payload_list;
+	payload_list.push_back(header);
+
+	if ((media_packet->GetData() != nullptr) && (media_packet->GetDataLength() > 0))
 	{
-		memcpy(&buffer[36], media_packet->GetData()->GetData(), media_packet->GetDataLength());
+		payload_list.push_back(media_packet->GetData());
 	}
 
-	size_t max_payload_size = OVT_DEFAULT_MAX_PACKET_SIZE - OVT_FIXED_HEADER_SIZE;
-	size_t remain_payload_len = payload.GetLength();
+	size_t max_payload_size = _max_payload_size;
+	size_t remain_payload_len = MEDIA_PACKET_HEADER_SIZE + media_packet->GetDataLength();
 	size_t offset = 0;
 
 	while(remain_payload_len != 0)
 	{
 		// Serialize
 		auto packet = std::make_shared<OvtPacket>();
-		// Session ID should be set in Session Level
+		// Media packets are shared by all sessions, so Session ID is not set
 		packet->SetSessionId(0);
 		packet->SetPayloadType(OVT_PAYLOAD_TYPE_MEDIA_PACKET);
 		packet->SetMarker(false);
 		packet->SetTimestamp(timestamp);
 
-		if(remain_payload_len > max_payload_size)
-		{
-			packet->SetPayload(&buffer[offset], max_payload_size);
-			offset += max_payload_size;
-			remain_payload_len -= max_payload_size;
-		}
-		else
+		auto payload_size = std::min(remain_payload_len, max_payload_size);
+
+		packet->SetPayloadReferences(OvtPacket::SliceDataList(payload_list, offset, payload_size));
+		offset += payload_size;
+		remain_payload_len -= payload_size;
+
+		if(remain_payload_len == 0)
 		{
 			// The last packet of group has marker bit.
 			packet->SetMarker(true);
-			packet->SetPayload(&buffer[offset], remain_payload_len);
-			remain_payload_len = 0;
 		}
 
 		packet->SetSequenceNumber(_sequence_number++);
@@ -169,6 +170,16 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 	return true;
 }
 
+void OvtPacketizer::SetMaxPayloadSize(size_t max_payload_size)
+{
+	_max_payload_size = std::clamp<size_t>(max_payload_size, OVT_DEFAULT_MAX_PAYLOAD_SIZE, OVT_MAX_PAYLOAD_SIZE_LIMIT);
+}
+
+size_t OvtPacketizer::GetMaxPayloadSize() const
+{
+	return _max_payload_size;
+}
+
 bool OvtPacketizer::IsAvailablePackets()
 {
 	return !_ovt_packets.empty();
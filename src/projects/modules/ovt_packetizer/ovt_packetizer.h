@@ -15,8 +15,13 @@ public:
 
 	bool PacketizeMessage(uint8_t payload_type, uint64_t timestamp, const std::shared_ptr<ov::Data> &message);
 	// Packetizing the MediaPacket
+	// Packets reference the data of media_packet instead of copying it (See OvtPacket::GetDataList())
 	bool PacketizeMediaPacket(uint64_t timestamp, const std::shared_ptr<MediaPacket> &media_packet);
 
+	// Maximum payload size of media packets (OVT_DEFAULT_MAX_PAYLOAD_SIZE ~ OVT_MAX_PAYLOAD_SIZE_LIMIT)
+	void SetMaxPayloadSize(size_t max_payload_size);
+	size_t GetMaxPayloadSize() const;
+
 	bool IsAvailablePackets();
 	std::shared_ptr<OvtPacket> PopPacket();
 
@@ -27,6 +32,7 @@ public:
 
 private:
 	uint16_t 									_sequence_number;
+	size_t										_max_payload_size = OVT_DEFAULT_MAX_PAYLOAD_SIZE;
 	std::shared_ptr<OvtPacketizerInterface> 	_stream = nullptr;
 	
 	std::queue<std::shared_ptr<OvtPacket>>		_ovt_packets;
@@ -13,6 +13,7 @@
 #include <modules/address/address_utilities.h>
 #include <modules/ice/ice.h>
 #include <modules/ice/ice_port.h>
+#include <base/ovlibrary/json_writer.h>
 #include <publishers/webrtc/webrtc_publisher.h>
 
 #include <utility>
@@ -187,6 +188,9 @@ bool RtcSignallingServer::PrepareForExternalIceServer()
 		_ice_servers = Json::nullValue;
 	}
 
+	_ice_servers_json = _ice_servers.isNull() ? "" : ov::Json::Stringify(_ice_servers, false);
+	_new_ice_servers_json = _new_ice_servers.isNull() ? "" : ov::Json::Stringify(_new_ice_servers, false);
+
 	return true;
 }
 
@@ -206,6 +210,12 @@ bool RtcSignallingServer::Start(
 		return false;
 	}
 
+	// Created before the servers are started, since the socket threads post the commands to it.
+	// It is not released in Stop(), since Post() may be called by the socket threads while stopping
+	worker_count = (worker_count > 0) ? worker_count : RTC_SIGNALLING_DEFAULT_WORKER_COUNT;
+	_worker_pool = std::make_unique<ov::ShardedWorkerPool>("RtcSig", worker_count, false);
+	logti("Signalling worker pool is started with %d workers", worker_count);
+
 	if (SetupWebSocketHandler(interceptor) == false)
 	{
 		OV_ASSERT(false, "SetupWebSocketHandler() failed");
@@ -376,53 +386,11 @@ bool RtcSignallingServer::SetupWebSocketHandler(std::shared_ptr<http::svr::ws::I
 				return false;
 			}
 
-			ov::JsonObject object = ov::Json::Parse(message);
-
-			if (object.IsNull())
-			{
-				logtw("Invalid request message from %s", ws_session->ToString().CStr());
-				return false;
-			}
-
-			auto &payload = object.GetJsonValue();
-
-			if ((payload.isObject() == false) || (payload.isMember("command") == false))
-			{
-				logtw("Invalid request message from %s", ws_session->ToString().CStr());
-				return false;
-			}
-
-			auto &command_value = payload["command"];
-
-			ov::String command = ov::Converter::ToString(command_value);
-
-			logtd("Trying to dispatch command: %s...", command.CStr());
-
-			auto error = DispatchCommand(ws_session, command, object, info, message);
-
-			if (error != nullptr)
-			{
-				if (error->GetCode() == 404)
-				{
-					logte("Cannot find stream [%s/%s]", info->vhost_app_name.CStr(), info->stream_name.CStr());
-				}
-				else
-				{
-					logte("An error occurred while dispatch command %s for stream [%s/%s]: %s, disconnecting...", command.CStr(), info->vhost_app_name.CStr(), info->stream_name.CStr(), error->What());
-				}
-
-				ov::JsonObject response_json;
-				Json::Value &value = response_json.GetJsonValue();
-
-				value["code"] = error->GetCode();
-				value["error"] = error->GetMessage().CStr();
-
-				ws_session->GetWebSocketResponse()->Send(response_json.ToString());
-
-				return false;
-			}
-
-			return true;
+			// Process the command on the signalling worker, so that the socket thread is not blocked
+			// while the offer is created (it may wait for AdmissionWebhooks, origin, ...)
+			return _worker_pool->Post(GetWorkerKey(ws_session), [this, ws_session, info, message]() {
+				HandleMessage(ws_session, info, message);
+			});
 		});
 
 	interceptor->SetErrorHandler(
@@ -439,19 +407,11 @@ bool RtcSignallingServer::SetupWebSocketHandler(std::shared_ptr<http::svr::ws::I
 
 			if (info != nullptr)
 			{
-				if (info->id != P2P_INVALID_PEER_ID)
+				// Clean up after the commands received before
+				if (_worker_pool->Post(GetWorkerKey(ws_session), [this, ws_session, info]() { HandleClose(ws_session, info); }) == false)
 				{
-					// The client is disconnected without send "close" command
-
-					// Forces the session to be cleaned up by sending a stop command
-					DispatchStop(ws_session, info);
+					HandleClose(ws_session, info);
 				}
-
-				logti("Client is disconnected: %s (%s / %s, ufrag: local: %s, remote: %s)",
-					  ws_session->ToString().CStr(),
-					  info->vhost_app_name.CStr(), info->stream_name.CStr(),
-					  (info->offer_sdp != nullptr) ? info->offer_sdp->GetIceUfrag().CStr() : "(N/A)",
-					  (info->answer_sdp != nullptr) ? info->answer_sdp->GetIceUfrag().CStr() : "(N/A)");
 			}
 			else
 			{
@@ -462,6 +422,80 @@ bool RtcSignallingServer::SetupWebSocketHandler(std::shared_ptr<http::svr::ws::I
 	return true;
 }
 
+uint64_t RtcSignallingServer::GetWorkerKey(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session)
+{
+	auto connection = ws_session->GetConnection();
+
+	return (connection != nullptr) ? connection->GetId() : 0;
+}
+
+void RtcSignallingServer::HandleMessage(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, std::shared_ptr<RtcSignallingInfo> info, const std::shared_ptr<const ov::Data> &message)
+{
+	ov::JsonObject object = ov::Json::Parse(message);
+
+	auto &payload = object.GetJsonValue();
+
+	if (object.IsNull() || (payload.isObject() == false) || (payload.isMember("command") == false))
+	{
+		logtw("Invalid request message from %s", ws_session->ToString().CStr());
+		ws_session->GetConnection()->Close(PhysicalPortDisconnectReason::Error);
+		return;
+	}
+
+	auto &command_value = payload["command"];
+
+	ov::String command = ov::Converter::ToString(command_value);
+
+	logtd("Trying to dispatch command: %s...", command.CStr());
+
+	auto error = DispatchCommand(ws_session, command, object, info, message);
+
+	if (error != nullptr)
+	{
+		if (error->GetCode() == 404)
+		{
+			logte("Cannot find stream [%s/%s]", info->vhost_app_name.CStr(), info->stream_name.CStr());
+		}
+		else
+		{
+			logte("An error occurred while dispatch command %s for stream [%s/%s]: %s, disconnecting...", command.CStr(), info->vhost_app_name.CStr(), info->stream_name.CStr(), error->What());
+		}
+
+		SendError(ws_session, error);
+
+		ws_session->GetConnection()->Close(PhysicalPortDisconnectReason::Error);
+	}
+}
+
+void RtcSignallingServer::HandleClose(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, std::shared_ptr<RtcSignallingInfo> info)
+{
+	if (info->id != P2P_INVALID_PEER_ID)
+	{
+		// The client is disconnected without send "close" command
+
+		// Forces the session to be cleaned up by sending a stop command
+		DispatchStop(ws_session, info);
+	}
+
+	logti("Client is disconnected: %s (%s / %s, ufrag: local: %s, remote: %s)",
+		  ws_session->ToString().CStr(),
+		  info->vhost_app_name.CStr(), info->stream_name.CStr(),
+		  (info->offer_sdp != nullptr) ? info->offer_sdp->GetIceUfrag().CStr() : "(N/A)",
+		  (info->answer_sdp != nullptr) ? info->answer_sdp->GetIceUfrag().CStr() : "(N/A)");
+}
+
+void RtcSignallingServer::SendError(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, const std::shared_ptr<const ov::Error> &error)
+{
+	ov::JsonWriter writer;
+
+	writer.BeginObject();
+	writer.Key("code").Value(error->GetCode());
+	writer.Key("error").Value(error->GetMessage());
+	writer.EndObject();
+
+	ws_session->GetWebSocketResponse()->Send(writer.ToString());
+}
+
 bool RtcSignallingServer::AddObserver(const std::shared_ptr<RtcSignallingObserver> &observer)
 {
 	for (const auto &item : _observers)
@@ -602,6 +636,11 @@ bool RtcSignallingServer::Stop()
 		}
 	}
 
+	if (_worker_pool != nullptr)
+	{
+		_worker_pool->Stop();
+	}
+
 	return result;
 }
 
@@ -727,26 +766,32 @@ std::shared_ptr<const ov::Error> RtcSignallingServer::DispatchRequestOffer(const
 				// P2P manager is disabled
 			}
 
-			ov::JsonObject response_json;
-
-			Json::Value &value = response_json.GetJsonValue();
-
-			// Create a "SDP" object into value
-			Json::Value &sdp_value = value["sdp"];
-
 			// Generate offer_sdp string from SessionDescription
 			ov::String offer_sdp = sdp->ToString();
 			if (offer_sdp.IsEmpty() == false)
 			{
-				value["command"] = "offer";
-				value["id"] = info->id;
-				value["peer_id"] = P2P_OME_PEER_ID;
-				sdp_value["sdp"] = offer_sdp.CStr();
-				sdp_value["type"] = "offer";
+				if (_tcp_force == true)
+				{
+					tcp_relay = true;
+				}
 
-				// candidates: [ <candidate>, <candidate>, ... ]
-				Json::Value candidates(Json::ValueType::arrayValue);
+				// This message is sent to every viewer, so it is written directly without building a Json::Value
+				ov::JsonWriter writer(offer_sdp.GetLength() + 1024);
 
+				writer.BeginObject();
+
+				writer.Key("command").Value("offer");
+				writer.Key("id").Value(info->id);
+				writer.Key("peer_id").Value(P2P_OME_PEER_ID);
+				writer.Key("code").Value(static_cast<int>(http::StatusCode::OK));
+
+				writer.Key("sdp").BeginObject();
+				writer.Key("sdp").Value(offer_sdp);
+				writer.Key("type").Value("offer");
+				writer.EndObject();
+
+				// candidates: [ <candidate>, <candidate>, ... ]
+				//
 				// candiate:
 				// {
 				//     "candidate":"candidate:0 1 UDP 50 192.168.0.183 10000 typ host generation 0",
@@ -755,44 +800,41 @@ std::shared_ptr<const ov::Error> RtcSignallingServer::DispatchRequestOffer(const
 				// }
 
 				// Send local candidate list to client
+				writer.Key("candidates").BeginArray();
 				for (const auto &candidate : info->local_candidates)
 				{
-					Json::Value item;
+					writer.BeginObject();
 
-					item["candidate"] = candidate.GetCandidateString().CStr();
-					item["sdpMLineIndex"] = candidate.GetSdpMLineIndex();
+					writer.Key("candidate").Value(candidate.GetCandidateString());
+					writer.Key("sdpMLineIndex").Value(candidate.GetSdpMLineIndex());
 					if (candidate.GetSdpMid().IsEmpty() == false)
 					{
-						item["sdpMid"] = candidate.GetSdpMid().CStr();
+						writer.Key("sdpMid").Value(candidate.GetSdpMid());
 					}
 
-					candidates.append(item);
-				}
-				value["candidates"] = candidates;
-				value["code"] = static_cast<int>(http::StatusCode::OK);
-
-				if (_tcp_force == true)
-				{
-					tcp_relay = true;
+					writer.EndObject();
 				}
+				writer.EndArray();
 
 				if (tcp_relay == true)
 				{
-					if (_ice_servers.isNull() == false)
+					if (_ice_servers_json.IsEmpty() == false)
 					{
 						// "ice_servers" is out of specification. This is a bug and "iceServers" is correct. "ice_servers" will be deprecated in the future.
-						value["ice_servers"] = _ice_servers;
+						writer.Key("ice_servers").RawValue(_ice_servers_json);
 					}
 
-					if (_new_ice_servers.isNull() == false)
+					if (_new_ice_servers_json.IsEmpty() == false)
 					{
-						value["iceServers"] = _new_ice_servers;
+						writer.Key("iceServers").RawValue(_new_ice_servers_json);
 					}
 				}
 
+				writer.EndObject();
+
 				info->offer_sdp = sdp;
 
-				ws_session->GetWebSocketResponse()->Send(response_json.ToString());
+				ws_session->GetWebSocketResponse()->Send(writer.ToString());
 			}
 			else
 			{
@@ -21,6 +21,8 @@
 #include "rtc_ice_candidate.h"
 #include "rtc_signalling_observer.h"
 
+#define RTC_SIGNALLING_DEFAULT_WORKER_COUNT 4
+
 class RtcSignallingServer : public ov::EnableSharedFromThis<RtcSignallingServer>
 {
 public:
@@ -142,6 +144,13 @@ protected:
 	bool PrepareForExternalIceServer();
 	bool SetupWebSocketHandler(std::shared_ptr<http::svr::ws::Interceptor> interceptor = nullptr);
 
+	// The commands of a connection are processed by the same worker
+	static uint64_t GetWorkerKey(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session);
+	// Called by the signalling worker
+	void HandleMessage(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, std::shared_ptr<RtcSignallingInfo> info, const std::shared_ptr<const ov::Data> &message);
+	void HandleClose(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, std::shared_ptr<RtcSignallingInfo> info);
+	void SendError(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, const std::shared_ptr<const ov::Error> &error);
+
 	std::shared_ptr<const ov::Error> DispatchCommand(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, const ov::String &command, const ov::JsonObject &object, std::shared_ptr<RtcSignallingInfo> &info, const std::shared_ptr<const ov::Data> &message);
 	std::shared_ptr<const ov::Error> DispatchRequestOffer(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, std::shared_ptr<RtcSignallingInfo> &info);
 	std::shared_ptr<const ov::Error> DispatchAnswer(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session, const ov::JsonObject &object, std::shared_ptr<RtcSignallingInfo> &info);
@@ -166,7 +175,16 @@ protected:
 
 	Json::Value _ice_servers;
 	Json::Value _new_ice_servers;
+	// Serialized in advance, since they are sent to every client
+	ov::String _ice_servers_json;
+	ov::String _new_ice_servers_json;
 	bool _tcp_force = false;
 
 	RtcP2PManager _p2p_manager;
+
+	// Runs the signalling commands outside of the socket threads.
+	// The tasks are sharded by the connection ID, so the commands of a connection are processed in the order
+	// they are received, and a slow command (e.g. request_offer waiting for AdmissionWebhooks) delays only
+	// the connections of the same worker.
+	std::unique_ptr<ov::ShardedWorkerPool> _worker_pool;
 };
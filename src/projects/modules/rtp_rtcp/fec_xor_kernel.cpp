@@ -0,0 +1,137 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "fec_xor_kernel.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	include <immintrin.h>
+#	define FEC_XOR_KERNEL_X86 1
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#	include <arm_neon.h>
+#	define FEC_XOR_KERNEL_NEON 1
+#endif
+
+namespace
+{
+	using XorFunction = void (*)(uint8_t *dst, const uint8_t *src, size_t length);
+
+	struct Kernel
+	{
+		XorFunction function;
+		const char *name;
+	};
+
+	void XorScalar(uint8_t *dst, const uint8_t *src, size_t length)
+	{
+		size_t index = 0;
+
+		// memcpy() is compiled to a single load/store, and doesn't require alignment
+		for (; (index + sizeof(uint64_t)) <= length; index += sizeof(uint64_t))
+		{
+			uint64_t dst_word;
+			uint64_t src_word;
+
+			::memcpy(&dst_word, dst + index, sizeof(uint64_t));
+			::memcpy(&src_word, src + index, sizeof(uint64_t));
+
+			dst_word ^= src_word;
+
+			::memcpy(dst + index, &dst_word, sizeof(uint64_t));
+		}
+
+		for (; index < length; index++)
+		{
+			dst[index] ^= src[index];
+		}
+	}
+
+#if FEC_XOR_KERNEL_X86
+	__attribute__((target("sse2"))) void XorSse2(uint8_t *dst, const uint8_t *src, size_t length)
+	{
+		size_t index = 0;
+
+		for (; (index + 16) <= length; index += 16)
+		{
+			auto dst_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + index));
+			auto src_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + index));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + index), _mm_xor_si128(dst_block, src_block));
+		}
+
+		XorScalar(dst + index, src + index, length - index);
+	}
+
+	__attribute__((target("avx2"))) void XorAvx2(uint8_t *dst, const uint8_t *src, size_t length)
+	{
+		size_t index = 0;
+
+		for (; (index + 32) <= length; index += 32)
+		{
+			auto dst_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + index));
+			auto src_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + index));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + index), _mm256_xor_si256(dst_block, src_block));
+		}
+
+		// The rest is less than 32 bytes
+		XorSse2(dst + index, src + index, length - index);
+	}
+#endif	// FEC_XOR_KERNEL_X86
+
+#if FEC_XOR_KERNEL_NEON
+	void XorNeon(uint8_t *dst, const uint8_t *src, size_t length)
+	{
+		size_t index = 0;
+
+		for (; (index + 16) <= length; index += 16)
+		{
+			vst1q_u8(dst + index, veorq_u8(vld1q_u8(dst + index), vld1q_u8(src + index)));
+		}
+
+		XorScalar(dst + index, src + index, length - index);
+	}
+#endif	// FEC_XOR_KERNEL_NEON
+
+	Kernel SelectKernel()
+	{
+#if FEC_XOR_KERNEL_X86
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return {XorAvx2, "avx2"};
+		}
+
+		if (__builtin_cpu_supports("sse2"))
+		{
+			return {XorSse2, "sse2"};
+		}
+#elif FEC_XOR_KERNEL_NEON
+		return {XorNeon, "neon"};
+#endif
+
+		return {XorScalar, "scalar"};
+	}
+
+	const Kernel &GetKernel()
+	{
+		static const Kernel kernel = SelectKernel();
+		return kernel;
+	}
+}  // namespace
+
+void FecXorKernel::Xor(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	GetKernel().function(dst, src, length);
+}
+
+const char *FecXorKernel::GetName()
+{
+	return GetKernel().name;
+}
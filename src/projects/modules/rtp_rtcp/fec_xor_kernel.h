@@ -0,0 +1,25 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// XORs the blocks for the FEC generation.
+//
+// The widest kernel supported by the CPU is selected at runtime on x86 (AVX2 or SSE2),
+// NEON is used on ARM, and the others XOR 8 bytes at a time.
+class FecXorKernel
+{
+public:
+	// dst[i] ^= src[i] for i in [0, length)
+	static void Xor(uint8_t *dst, const uint8_t *src, size_t length);
+
+	// The name of the selected kernel ("avx2", "sse2", "neon" or "scalar")
+	static const char *GetName();
+};
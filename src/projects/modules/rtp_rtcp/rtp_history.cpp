@@ -5,63 +5,55 @@ RtpHistory::RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, ui
 	_origin_paylod_type = origin_payload_type;
 	_rtx_paylod_type = rtx_payload_type;
 	_rtx_ssrc = rtx_ssrc;
-	_max_history_size = max_history_size;
 
-	_history.reserve(_max_history_size);
+	uint32_t capacity = 1;
+	while ((capacity < max_history_size) && (capacity < 65536))
+	{
+		capacity <<= 1;
+	}
+
+	_history.resize(capacity);
+	_index_mask = capacity - 1;
 }
 
-// Converting to RtxRtpPacket
-bool RtpHistory::StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet)
+bool RtpHistory::StoreRtpPacket(const std::shared_ptr<const RtpPacket> &packet)
 {
-	std::lock_guard<std::shared_mutex> guard(_history_lock);
+	auto old_packet = packet;
+
+	{
+		std::lock_guard<std::mutex> guard(_history_lock);
+		_history[GetIndex(packet->SequenceNumber())].swap(old_packet);
+	}
+
+	_stored_bytes += packet->GetDataLength();
 
-	_history[GetIndex(packet->SequenceNumber())] = packet;
+	// The overwritten packet is released outside of the lock
+	if (old_packet != nullptr)
+	{
+		_stored_bytes -= old_packet->GetDataLength();
+	}
 
 	return true;
 }
 
 std::shared_ptr<RtxRtpPacket> RtpHistory::GetRtxRtpPacket(uint16_t seq_no)
 {
-	auto index = GetIndex(seq_no);
-	// First, look in the cache
-	std::shared_lock<std::shared_mutex> cache_read_guard(_history_cache_lock);
-	auto cache_item = _history_cache.find(index);
-	if(cache_item != _history_cache.end())
+	std::shared_ptr<const RtpPacket> rtp_packet;
+
 	{
-		// Found!
-		auto rtx_packet = cache_item->second;
-		
-		if(rtx_packet->GetOriginalSequenceNumber() == seq_no)// && ov::Clock::GetElapsedMiliSecondsFromNow(rtx_packet->GetCreatedTime()) < VALID_TIME_MS_STORED_RTP_PACKET)
-		{
-			return rtx_packet;
-		}
+		std::lock_guard<std::mutex> guard(_history_lock);
+		rtp_packet = _history[GetIndex(seq_no)];
 	}
-	cache_read_guard.unlock();
 
-	// find in rtp history
-	std::shared_lock<std::shared_mutex> history_guard(_history_lock);
-	auto rtp_item = _history.find(index);
-	if(rtp_item != _history.end())
+	// now, I consider all requests are valid because webrtc player doesn't ask for too old packet anyway
+	//auto elapsed_ms = ov::Clock::GetElapsedMiliSecondsFromNow(rtp_packet->GetCreatedTime());
+	//if(elapsed_ms < VALID_TIME_MS_STORED_RTP_PACKET)
+	if ((rtp_packet == nullptr) || (rtp_packet->SequenceNumber() != seq_no))
 	{
-		auto rtp_packet = rtp_item->second;
-		history_guard.unlock();
-
-		// now, I consider all requests are valid because webrtc player doesn't ask for too old packet anyway 
-		//auto elapsed_ms = ov::Clock::GetElapsedMiliSecondsFromNow(rtp_packet->GetCreatedTime());
-		//if(elapsed_ms < VALID_TIME_MS_STORED_RTP_PACKET)
-		if(rtp_packet->SequenceNumber() == seq_no)
-		{
-			// Create Rtx Packet and store it
-			auto rtx_packet = std::make_shared<RtxRtpPacket>(GetRtxSsrc(), GetRtxPayloadType(), *rtp_packet);
-
-			std::lock_guard<std::shared_mutex> cache_write_guard(_history_cache_lock);
-			_history_cache[index] = rtx_packet;
-			
-			return rtx_packet;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	return std::make_shared<RtxRtpPacket>(GetRtxSsrc(), GetRtxPayloadType(), *rtp_packet);
 }
 
 uint8_t	RtpHistory::GetOriginPayloadType()
@@ -79,7 +71,12 @@ uint8_t RtpHistory::GetRtxPayloadType()
 	return _rtx_paylod_type;
 }
 
-uint16_t RtpHistory::GetIndex(uint16_t seq_no)
+size_t RtpHistory::GetStoredBytes() const
 {
-	return seq_no % _max_history_size;
-}
\ No newline at end of file
+	return _stored_bytes.load(std::memory_order_relaxed);
+}
+
+uint32_t RtpHistory::GetIndex(uint16_t seq_no) const
+{
+	return seq_no & _index_mask;
+}
@@ -33,6 +33,11 @@ RtpPacket::RtpPacket(const std::shared_ptr<const ov::Data> &data)
 }
 
 RtpPacket::RtpPacket(const RtpPacket &src)
+	: RtpPacket(src, src._data->Clone())
+{
+}
+
+RtpPacket::RtpPacket(const RtpPacket &src, const std::shared_ptr<ov::Data> &data)
 {
 	_marker = src._marker;
 	_payload_type = src._payload_type;
@@ -48,7 +53,7 @@ RtpPacket::RtpPacket(const RtpPacket &src)
 	_extensions = src._extensions;
 	_extension_buffer_offset = src._extension_buffer_offset;
 	_extension_type = src._extension_type;
-	_data = src._data->Clone();
+	_data = data;
 	_buffer = _data->GetWritableDataAs<uint8_t>();
 
 	// Extra Data
@@ -139,6 +139,9 @@ public:
 	RtpHeaderExtension::HeaderType GetExtensionType() const { return _extension_type; }
 
 protected:
+	// Copies the fields of src, and uses data as the buffer (must have the same header as src)
+	RtpPacket(const RtpPacket &src, const std::shared_ptr<ov::Data> &data);
+
 	size_t		_payload_offset = 0;	// Payload Start Point (Header size)
 	bool		_has_padding = false;
 	bool		_has_extension = false;
@@ -114,6 +114,11 @@ void RtpPacketizer::SetUlpfec(uint8_t red_payload_type, uint8_t ulpfec_payload_t
 	_ulpfec_payload_type = ulpfec_payload_type;
 }
 
+void RtpPacketizer::SetUlpfecProtection(WebRtcFecScheme scheme, int rate)
+{
+	_ulpfec_generator.SetProtection(scheme, rate);
+}
+
 bool RtpPacketizer::Packetize(FrameType frame_type,
                                    uint32_t rtp_timestamp,
 								   uint64_t ntp_timestamp,
@@ -22,6 +22,7 @@ public:
 
 	bool SetCodec(cmn::MediaCodecId codec_type);
 	void SetUlpfec(uint8_t _red_payload_type, uint8_t _ulpfec_payload_type);
+	void SetUlpfecProtection(WebRtcFecScheme scheme, int rate);
 	void SetTrackId(uint32_t track_id);
 	void SetPayloadType(uint8_t payload_type);
 	void SetSSRC(uint32_t ssrc);
@@ -112,6 +112,44 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 		return false;
 	}
 
+	OnRtpPacketSending(rtp_packet);
+
+	// Send RTP
+	_last_sent_rtp_packet = rtp_packet;
+	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
+}
+
+bool RtpRtcp::SendRtpPackets(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
+{
+	if(rtp_packets.empty())
+	{
+		return true;
+	}
+
+	std::shared_lock<std::shared_mutex> lock(_state_lock);
+	// nothing to do before node start
+	if(GetNodeState() != ov::Node::NodeState::Started)
+	{
+		logtd("Node has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	std::vector<std::shared_ptr<ov::Data>> data_list;
+	data_list.reserve(rtp_packets.size());
+
+	for(const auto &rtp_packet : rtp_packets)
+	{
+		OnRtpPacketSending(rtp_packet);
+		data_list.push_back(rtp_packet->GetData());
+	}
+
+	// Send RTP (SRTP protects them in a batch)
+	_last_sent_rtp_packet = rtp_packets.back();
+	return SendDataListToNextNode(NodeType::Rtp, data_list);
+}
+
+void RtpRtcp::OnRtpPacketSending(const std::shared_ptr<RtpPacket> &rtp_packet)
+{
 	// RTCP(SR + SR + SDES + SDES)
 	auto it = _rtcp_sr_generators.find(rtp_packet->Ssrc());
     if(it != _rtcp_sr_generators.end())
@@ -155,10 +193,6 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 			logd("RTCP", "Send RTCP succeed : pt(%d) ssrc(%u) length(%d)", rtp_packet->PayloadType(), rtp_packet->Ssrc(), compound_rtcp_data->GetLength());
 		}
 	}
-
-	// Send RTP
-	_last_sent_rtp_packet = rtp_packet;
-	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
 }
 
 bool RtpRtcp::SendPLI(uint32_t track_id)
@@ -62,6 +62,8 @@ public:
 	bool Stop() override;
 
 	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	// Sends the packets (e.g. the packets of a frame) at once, so that the next node can process them in a batch
+	bool SendRtpPackets(const std::vector<std::shared_ptr<RtpPacket>> &packets);
 	bool SendPLI(uint32_t track_id);
 	bool SendFIR(uint32_t track_id);
 
@@ -81,6 +83,9 @@ public:
 	std::optional<uint32_t> GetTrackId(uint32_t ssrc) const;
 	
 private:
+	// Updates the sender reports and sends RTCP(SR + SDES) periodically
+	void OnRtpPacketSending(const std::shared_ptr<RtpPacket> &rtp_packet);
+
 	bool OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::Data> &data);
 	bool OnRtcpReceived(NodeType from_node, const std::shared_ptr<const ov::Data> &data);
 
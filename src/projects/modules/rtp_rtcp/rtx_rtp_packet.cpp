@@ -2,7 +2,7 @@
 #include <base/ovlibrary/byte_io.h>
 
 RtxRtpPacket::RtxRtpPacket(uint32_t rtx_ssrc, uint8_t rtx_payload_type, const RtpPacket &src)
-	: RtpPacket(src)
+	: RtpPacket(src, MakeRtxData(src))
 {
 	PackageAsRtx(rtx_ssrc, rtx_payload_type, src);
 }
@@ -14,6 +14,22 @@ RtxRtpPacket::RtxRtpPacket(const RtxRtpPacket &src)
 	_origin_seq_no = src._origin_seq_no;
 }
 
+std::shared_ptr<ov::Data> RtxRtpPacket::MakeRtxData(const RtpPacket &src)
+{
+	auto length = src.HeadersSize() + RTX_HEADER_SIZE + src.PayloadSize();
+	// Leave room for the SRTP auth tag, which is appended in place
+	auto data = std::make_shared<ov::Data>(std::max<size_t>(length, RTP_DEFAULT_MAX_PACKET_SIZE));
+
+	uint8_t osn[RTX_HEADER_SIZE];
+	ByteWriter<uint16_t>::WriteBigEndian(osn, src.SequenceNumber());
+
+	data->Append(src.Header(), src.HeadersSize());
+	data->Append(osn, RTX_HEADER_SIZE);
+	data->Append(src.Payload(), src.PayloadSize());
+
+	return data;
+}
+
 bool RtxRtpPacket::PackageAsRtx(uint32_t rtx_ssrc, uint8_t rtx_payload_type, const RtpPacket &src)
 {
 	// replace with rtx payload type
@@ -22,21 +38,11 @@ bool RtxRtpPacket::PackageAsRtx(uint32_t rtx_ssrc, uint8_t rtx_payload_type, con
 	SetSsrc(rtx_ssrc);
 	SetTimestamp(src.Timestamp());
 
-	// Put OSN
+	// OSN has been put by MakeRtxData()
 	_origin_seq_no = src.SequenceNumber();
 
 	_payload_offset = _payload_offset + RTX_HEADER_SIZE;
-
-	if (_data->GetLength() < _payload_offset)
-	{
-		_data->SetLength(_payload_offset);
-		_buffer = _data->GetWritableDataAs<uint8_t>();
-	}
-
-	SetOriginalSequenceNumber(_origin_seq_no);
-	
-	// Rewrite payload
-	SetPayload(src.Payload(), src.PayloadSize());
+	_payload_size = src.PayloadSize();
 
 	return true;
 }
@@ -36,6 +36,9 @@ public:
 	void SetOriginalSequenceNumber(uint16_t seq_no);
 
 private:
+	// Builds the buffer of the RTX packet in a single allocation: the header of src, OSN and the payload of src
+	static std::shared_ptr<ov::Data> MakeRtxData(const RtpPacket &src);
+
 	bool PackageAsRtx(uint32_t rtx_ssrc, uint8_t rtx_payload_type, const RtpPacket &src);
 
 	uint8_t		_origin_payload_type; // related(original) payload type
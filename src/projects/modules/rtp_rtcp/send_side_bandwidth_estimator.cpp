@@ -0,0 +1,373 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "send_side_bandwidth_estimator.h"
+
+#include <cmath>
+
+#define OV_LOG_TAG "SendSideBWE"
+
+// The packets sent within this time are grouped (a frame is usually sent in a burst)
+#define BURST_TIME_US 5000
+// The number of the groups to calculate the trendline
+#define TRENDLINE_WINDOW_SIZE 20
+#define TRENDLINE_SMOOTHING_COEFFICIENT 0.9
+#define TRENDLINE_THRESHOLD_GAIN 4.0
+// The adaptive threshold (see "Analysis and Design of the Google Congestion Control for WebRTC")
+#define THRESHOLD_K_UP 0.0087
+#define THRESHOLD_K_DOWN 0.039
+#define MIN_THRESHOLD 6.0
+#define MAX_THRESHOLD 600.0
+// The overuse must last for this time to be signaled
+#define OVERUSING_TIME_THRESHOLD_MS 10.0
+// The window to measure the acknowledged bitrate
+#define ACKNOWLEDGED_BITRATE_WINDOW_US (500 * 1000)
+// AIMD
+#define DECREASE_FACTOR 0.85
+#define MIN_DECREASE_INTERVAL_US (200 * 1000)
+#define INCREASE_FACTOR_PER_SECOND 1.08
+// Loss based control
+#define HIGH_LOSS_RATE 0.1
+#define LOW_LOSS_RATE 0.02
+
+SendSideBandwidthEstimator::SendSideBandwidthEstimator(uint64_t start_bitrate)
+{
+	SetStartBitrate(start_bitrate);
+}
+
+void SendSideBandwidthEstimator::SetStartBitrate(uint64_t start_bitrate)
+{
+	if (_has_estimate == false)
+	{
+		_target_bitrate = std::clamp<double>(start_bitrate, SEND_SIDE_BWE_MIN_BITRATE, SEND_SIDE_BWE_MAX_BITRATE);
+	}
+}
+
+void SendSideBandwidthEstimator::OnTransportFeedback(const std::vector<PacketResult> &packet_result_list, int64_t now_us)
+{
+	if (packet_result_list.empty())
+	{
+		return;
+	}
+
+	size_t lost_count = 0;
+
+	for (const auto &packet_result : packet_result_list)
+	{
+		if (packet_result.arrival_time_us.has_value() == false)
+		{
+			lost_count++;
+			continue;
+		}
+
+		OnReceivedPacket(packet_result);
+	}
+
+	auto loss_rate = static_cast<double>(lost_count) / packet_result_list.size();
+	_loss_rate = _has_estimate ? (_loss_rate * 0.5 + loss_rate * 0.5) : loss_rate;
+
+	UpdateTargetBitrate(now_us);
+}
+
+void SendSideBandwidthEstimator::OnReceivedPacket(const PacketResult &packet_result)
+{
+	auto arrival_time_us = packet_result.arrival_time_us.value();
+
+	UpdateAcknowledgedBitrate(arrival_time_us, packet_result.size);
+
+	if (_current_group.has_value() == false)
+	{
+		_current_group = PacketGroup{packet_result.send_time_us, packet_result.send_time_us, arrival_time_us};
+		return;
+	}
+
+	auto &group = _current_group.value();
+
+	// Reordered packets are ignored
+	if (packet_result.send_time_us < group.first_send_time_us)
+	{
+		return;
+	}
+
+	if ((packet_result.send_time_us - group.first_send_time_us) > BURST_TIME_US)
+	{
+		// A new burst starts
+		OnPacketGroupCompleted(group);
+
+		_previous_group = group;
+		_current_group = PacketGroup{packet_result.send_time_us, packet_result.send_time_us, arrival_time_us};
+		return;
+	}
+
+	group.last_send_time_us = std::max(group.last_send_time_us, packet_result.send_time_us);
+	group.last_arrival_time_us = std::max(group.last_arrival_time_us, arrival_time_us);
+}
+
+void SendSideBandwidthEstimator::OnPacketGroupCompleted(const PacketGroup &group)
+{
+	if (_previous_group.has_value() == false)
+	{
+		return;
+	}
+
+	auto &previous_group = _previous_group.value();
+
+	auto send_delta_us = group.last_send_time_us - previous_group.last_send_time_us;
+	auto arrival_delta_us = group.last_arrival_time_us - previous_group.last_arrival_time_us;
+
+	// How much the one-way delay has increased since the previous group
+	auto delay_variation_ms = static_cast<double>(arrival_delta_us - send_delta_us) / 1000.0;
+
+	UpdateTrendline(delay_variation_ms, group.last_arrival_time_us / 1000);
+}
+
+void SendSideBandwidthEstimator::UpdateTrendline(double delay_variation_ms, int64_t arrival_time_ms)
+{
+	_group_count++;
+
+	if (_first_arrival_time_ms.has_value() == false)
+	{
+		_first_arrival_time_ms = arrival_time_ms;
+	}
+
+	_accumulated_delay_ms += delay_variation_ms;
+	_smoothed_delay_ms = (TRENDLINE_SMOOTHING_COEFFICIENT * _smoothed_delay_ms) + ((1.0 - TRENDLINE_SMOOTHING_COEFFICIENT) * _accumulated_delay_ms);
+
+	_trend_samples.push_back({static_cast<double>(arrival_time_ms - _first_arrival_time_ms.value()), _smoothed_delay_ms});
+
+	if (_trend_samples.size() > TRENDLINE_WINDOW_SIZE)
+	{
+		_trend_samples.pop_front();
+	}
+
+	double trend = _previous_trend;
+
+	if (_trend_samples.size() == TRENDLINE_WINDOW_SIZE)
+	{
+		// The slope of the linear regression
+		double sum_x = 0.0;
+		double sum_y = 0.0;
+
+		for (const auto &sample : _trend_samples)
+		{
+			sum_x += sample.arrival_time_ms;
+			sum_y += sample.smoothed_delay_ms;
+		}
+
+		auto mean_x = sum_x / _trend_samples.size();
+		auto mean_y = sum_y / _trend_samples.size();
+
+		double numerator = 0.0;
+		double denominator = 0.0;
+
+		for (const auto &sample : _trend_samples)
+		{
+			auto x = sample.arrival_time_ms - mean_x;
+
+			numerator += x * (sample.smoothed_delay_ms - mean_y);
+			denominator += x * x;
+		}
+
+		if (denominator != 0.0)
+		{
+			trend = numerator / denominator;
+		}
+	}
+
+	DetectOveruse(trend, arrival_time_ms);
+}
+
+void SendSideBandwidthEstimator::DetectOveruse(double trend, int64_t now_ms)
+{
+	auto modified_trend = std::min<size_t>(_group_count, 60) * trend * TRENDLINE_THRESHOLD_GAIN;
+	auto time_delta_ms = _last_detection_time_ms.has_value() ? static_cast<double>(now_ms - _last_detection_time_ms.value()) : 0.0;
+
+	_last_detection_time_ms = now_ms;
+
+	if (modified_trend > _threshold)
+	{
+		_overusing_time_ms += time_delta_ms;
+		_overuse_count++;
+
+		if ((_overusing_time_ms > OVERUSING_TIME_THRESHOLD_MS) && (_overuse_count > 1) && (trend >= _previous_trend))
+		{
+			_overusing_time_ms = 0.0;
+			_overuse_count = 0;
+			_bandwidth_usage = BandwidthUsage::Overusing;
+		}
+	}
+	else if (modified_trend < -_threshold)
+	{
+		_overusing_time_ms = 0.0;
+		_overuse_count = 0;
+		_bandwidth_usage = BandwidthUsage::Underusing;
+	}
+	else
+	{
+		_overusing_time_ms = 0.0;
+		_overuse_count = 0;
+		_bandwidth_usage = BandwidthUsage::Normal;
+	}
+
+	_previous_trend = trend;
+
+	UpdateThreshold(modified_trend, now_ms);
+}
+
+void SendSideBandwidthEstimator::UpdateThreshold(double modified_trend, int64_t now_ms)
+{
+	if (_last_threshold_update_time_ms.has_value() == false)
+	{
+		_last_threshold_update_time_ms = now_ms;
+	}
+
+	// Don't adapt to the spikes (e.g. a route change)
+	if (std::abs(modified_trend) > (_threshold + 15.0))
+	{
+		_last_threshold_update_time_ms = now_ms;
+		return;
+	}
+
+	auto k = (std::abs(modified_trend) < _threshold) ? THRESHOLD_K_DOWN : THRESHOLD_K_UP;
+	auto time_delta_ms = std::min<int64_t>(now_ms - _last_threshold_update_time_ms.value(), 100);
+
+	_threshold += k * (std::abs(modified_trend) - _threshold) * time_delta_ms;
+	_threshold = std::clamp(_threshold, MIN_THRESHOLD, MAX_THRESHOLD);
+
+	_last_threshold_update_time_ms = now_ms;
+}
+
+void SendSideBandwidthEstimator::UpdateAcknowledgedBitrate(int64_t arrival_time_us, size_t size)
+{
+	_acknowledged_packets.emplace_back(arrival_time_us, size);
+	_acknowledged_bytes += size;
+
+	while ((_acknowledged_packets.empty() == false) && ((arrival_time_us - _acknowledged_packets.front().first) > ACKNOWLEDGED_BITRATE_WINDOW_US))
+	{
+		_acknowledged_bytes -= _acknowledged_packets.front().second;
+		_acknowledged_packets.pop_front();
+	}
+}
+
+void SendSideBandwidthEstimator::UpdateTargetBitrate(int64_t now_us)
+{
+	if (_has_estimate == false)
+	{
+		_has_estimate = true;
+		_last_update_time_us = now_us;
+		return;
+	}
+
+	auto elapsed_seconds = std::clamp(static_cast<double>(now_us - _last_update_time_us.value()) / 1000000.0, 0.0, 1.0);
+	auto can_decrease = (_last_decrease_time_us.has_value() == false) || ((now_us - _last_decrease_time_us.value()) >= MIN_DECREASE_INTERVAL_US);
+	auto acknowledged_bitrate = static_cast<double>(GetAcknowledgedBitrate());
+
+	_last_update_time_us = now_us;
+
+	if (_loss_rate > HIGH_LOSS_RATE)
+	{
+		if (can_decrease)
+		{
+			_target_bitrate *= (1.0 - 0.5 * _loss_rate);
+			_last_decrease_time_us = now_us;
+		}
+	}
+	else
+	{
+		switch (_bandwidth_usage)
+		{
+			case BandwidthUsage::Overusing:
+				if (can_decrease)
+				{
+					auto base_bitrate = (acknowledged_bitrate > 0.0) ? acknowledged_bitrate : _target_bitrate;
+
+					_target_bitrate = std::min(_target_bitrate, DECREASE_FACTOR * base_bitrate);
+					_last_decrease_time_us = now_us;
+				}
+				break;
+
+			case BandwidthUsage::Underusing:
+				// The queues are draining, hold the bitrate until they are empty
+				break;
+
+			case BandwidthUsage::Normal:
+				if (_loss_rate <= LOW_LOSS_RATE)
+				{
+					auto increased_bitrate = _target_bitrate * std::pow(INCREASE_FACTOR_PER_SECOND, elapsed_seconds);
+
+					// Don't grow far beyond what is actually sent (e.g. a static scene), but don't decrease either
+					if (acknowledged_bitrate > 0.0)
+					{
+						increased_bitrate = std::min(increased_bitrate, std::max(_target_bitrate, 1.5 * acknowledged_bitrate + 10000.0));
+					}
+
+					_target_bitrate = increased_bitrate;
+				}
+				break;
+		}
+	}
+
+	_target_bitrate = std::clamp<double>(_target_bitrate, SEND_SIDE_BWE_MIN_BITRATE, SEND_SIDE_BWE_MAX_BITRATE);
+}
+
+bool SendSideBandwidthEstimator::HasEstimate() const
+{
+	return _has_estimate;
+}
+
+uint64_t SendSideBandwidthEstimator::GetTargetBitrate() const
+{
+	return static_cast<uint64_t>(_target_bitrate);
+}
+
+uint64_t SendSideBandwidthEstimator::GetAcknowledgedBitrate() const
+{
+	if (_acknowledged_packets.size() < 2)
+	{
+		return 0;
+	}
+
+	auto span_us = _acknowledged_packets.back().first - _acknowledged_packets.front().first;
+
+	// Too short to measure
+	if (span_us < (ACKNOWLEDGED_BITRATE_WINDOW_US / 5))
+	{
+		return 0;
+	}
+
+	return static_cast<uint64_t>(_acknowledged_bytes * 8 * 1000000 / span_us);
+}
+
+SendSideBandwidthEstimator::BandwidthUsage SendSideBandwidthEstimator::GetBandwidthUsage() const
+{
+	return _bandwidth_usage;
+}
+
+double SendSideBandwidthEstimator::GetLossRate() const
+{
+	return _loss_rate;
+}
+
+ov::String SendSideBandwidthEstimator::ToString() const
+{
+	const char *usage = "Normal";
+
+	switch (_bandwidth_usage)
+	{
+		case BandwidthUsage::Normal:
+			break;
+		case BandwidthUsage::Underusing:
+			usage = "Underusing";
+			break;
+		case BandwidthUsage::Overusing:
+			usage = "Overusing";
+			break;
+	}
+
+	return ov::String::FormatString("Target(%" PRIu64 " bps) Acknowledged(%" PRIu64 " bps) Usage(%s) Threshold(%.2f) Loss(%.2f%%)",
+									GetTargetBitrate(), GetAcknowledgedBitrate(), usage, _threshold, _loss_rate * 100.0);
+}
@@ -0,0 +1,119 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <optional>
+
+#define SEND_SIDE_BWE_DEFAULT_START_BITRATE (1000 * 1000)
+#define SEND_SIDE_BWE_MIN_BITRATE (50 * 1000)
+#define SEND_SIDE_BWE_MAX_BITRATE (50 * 1000 * 1000)
+
+// Estimates the available bandwidth from the transport-cc feedback (delay-based, like the GCC of libwebrtc).
+//
+// - The packets sent within a burst (5 ms) are grouped, and the variation of the one-way delay between the groups
+//   is accumulated. The slope of the accumulated delay (trendline) is compared with an adaptive threshold
+//   to detect the overuse (the queue of the bottleneck is growing) and the underuse.
+// - The target bitrate is controlled by AIMD: decreased to 85% of the acknowledged bitrate on overuse,
+//   held on underuse, and increased otherwise.
+// - A high loss rate in the feedback also decreases the target bitrate.
+//
+// It is not thread-safe, the feedback should be processed in a thread.
+class SendSideBandwidthEstimator
+{
+public:
+	struct PacketResult
+	{
+		// The time when the packet was sent (sender's clock)
+		int64_t send_time_us = 0;
+		// The time when the packet arrived (receiver's clock), nullopt if the packet is lost
+		std::optional<int64_t> arrival_time_us;
+		size_t size = 0;
+	};
+
+	enum class BandwidthUsage : uint8_t
+	{
+		Normal,
+		Underusing,
+		Overusing
+	};
+
+	explicit SendSideBandwidthEstimator(uint64_t start_bitrate = SEND_SIDE_BWE_DEFAULT_START_BITRATE);
+
+	void SetStartBitrate(uint64_t start_bitrate);
+
+	// packet_result_list must be in the order of the transport-wide sequence number
+	void OnTransportFeedback(const std::vector<PacketResult> &packet_result_list, int64_t now_us);
+
+	// Returns false until the first feedback is processed
+	bool HasEstimate() const;
+	uint64_t GetTargetBitrate() const;
+	// The bitrate that the receiver has acknowledged recently, 0 if unknown
+	uint64_t GetAcknowledgedBitrate() const;
+	BandwidthUsage GetBandwidthUsage() const;
+	double GetLossRate() const;
+
+	ov::String ToString() const;
+
+private:
+	struct PacketGroup
+	{
+		int64_t first_send_time_us = 0;
+		int64_t last_send_time_us = 0;
+		int64_t last_arrival_time_us = 0;
+	};
+
+	void OnReceivedPacket(const PacketResult &packet_result);
+	void OnPacketGroupCompleted(const PacketGroup &group);
+
+	void UpdateTrendline(double delay_variation_ms, int64_t arrival_time_ms);
+	void DetectOveruse(double trend, int64_t now_ms);
+	void UpdateThreshold(double modified_trend, int64_t now_ms);
+
+	void UpdateAcknowledgedBitrate(int64_t arrival_time_us, size_t size);
+	void UpdateTargetBitrate(int64_t now_us);
+
+	bool _has_estimate = false;
+	double _target_bitrate = 0.0;
+	std::optional<int64_t> _last_update_time_us;
+	std::optional<int64_t> _last_decrease_time_us;
+
+	// Inter-arrival grouping
+	std::optional<PacketGroup> _current_group;
+	std::optional<PacketGroup> _previous_group;
+
+	// Trendline
+	struct TrendSample
+	{
+		double arrival_time_ms;
+		double smoothed_delay_ms;
+	};
+	std::deque<TrendSample> _trend_samples;
+	std::optional<int64_t> _first_arrival_time_ms;
+	double _accumulated_delay_ms = 0.0;
+	double _smoothed_delay_ms = 0.0;
+	size_t _group_count = 0;
+	double _previous_trend = 0.0;
+
+	// Overuse detector
+	double _threshold = 12.5;
+	std::optional<int64_t> _last_threshold_update_time_ms;
+	double _overusing_time_ms = 0.0;
+	int _overuse_count = 0;
+	std::optional<int64_t> _last_detection_time_ms;
+	BandwidthUsage _bandwidth_usage = BandwidthUsage::Normal;
+
+	// Acknowledged bitrate: (arrival time, size) of the last packets
+	std::deque<std::pair<int64_t, size_t>> _acknowledged_packets;
+	size_t _acknowledged_bytes = 0;
+
+	// Loss
+	double _loss_rate = 0.0;
+};
@@ -1,6 +1,8 @@
 #include "ulpfec_generator.h"
 #include "base/ovlibrary/byte_io.h"
+#include "fec_xor_kernel.h"
 
+#include <monitoring/histogram_registry.h>
 #include <string.h>
 
 constexpr size_t 	kFecHeaderSize					= 10;
@@ -11,34 +13,55 @@ constexpr size_t	kFecLevelHeaderSizeLbitSet		= 2 + kMaskSizeLbitSet;
 constexpr size_t 	kUlpfecMaxMediaPacketsLbitClear	= 16;
 constexpr size_t 	kUlpfecMaxMediaPacketsLbitSet	= 48;
 
-constexpr size_t    kMediaPacketNumMakeFec          = 7; 
-
 UlpfecGenerator::UlpfecGenerator()
 {
-	_high_level = false;
+	_encode_duration_histogram = mon::HistogramRegistry::GetInstance()->Get(
+		"ome_ulpfec_encode_duration_microseconds",
+		"Time taken to generate the ULPFEC packets of a frame");
 }
 
 UlpfecGenerator::~UlpfecGenerator()
 {
 }
 
-void UlpfecGenerator::SetHighRateProtection(bool high_level)
+void UlpfecGenerator::SetProtection(WebRtcFecScheme scheme, int rate)
 {
-	_high_level = high_level;
+	_scheme = scheme;
+	_rate = std::clamp(rate, 1, 100);
 }
 
-bool UlpfecGenerator::AddRtpPacketAndGenerateFec(std::shared_ptr<RedRtpPacket> packet)
+bool UlpfecGenerator::AddRtpPacketAndGenerateFec(const std::shared_ptr<RedRtpPacket> &packet)
 {
-	auto copy_packet = std::make_shared<RedRtpPacket>(*packet);
-	_media_packets.push_back(copy_packet);
+	MediaPacket media_packet;
+
+	media_packet.packet = packet;
+	media_packet.first_byte = packet->Header()[0];
+	// The media_packet is red packet. So buffer[1] of RTP header has red payload type.
+	// We should use media payload type in the red header.
+	media_packet.marker_and_pt = packet->Header()[packet->HeadersSize() - 1];
+	if(packet->Marker())
+	{
+		media_packet.marker_and_pt |= 0x80;
+	}
+	else
+	{
+		media_packet.marker_and_pt &= 0x7F;
+	}
+	media_packet.sequence_number = packet->SequenceNumber();
+	media_packet.timestamp = packet->Timestamp();
+	media_packet.payload_offset = packet->HeadersSize();
+	media_packet.payload_size = packet->PayloadSize();
 
-	if(copy_packet->Marker())
+	_media_packets.push_back(std::move(media_packet));
+
+	if(packet->Marker())
 	{
 		Encode();
 	}
 
 	return true;
 }
+
 bool UlpfecGenerator::IsAvailableFecPackets() const
 {
 	return !_generated_fec_packets.empty();
@@ -60,162 +83,177 @@ bool UlpfecGenerator::NextPacket(RtpPacket *packet)
 
 bool UlpfecGenerator::Encode()
 {
-	size_t media_size = _media_packets.size();
-	//uint32_t rate = static_cast<uint32_t>(kMediaPacketNumMakeFec / (_high_level?2:1));
-	uint32_t fec_packet_count = static_cast<uint32_t>(std::ceil((float)media_size / (float)kMediaPacketNumMakeFec));
-	uint32_t media_packet_idx = 0;
-	size_t mask_len = 0;
+	auto start_time = std::chrono::steady_clock::now();
 
-	size_t fec_header_size = kFecHeaderSize;
-	if(_media_packets.size() <= kUlpfecMaxMediaPacketsLbitClear)
-	{
-		fec_header_size += kFecLevelHeaderSizeLbitClear;
-		mask_len = kMaskSizeLbitClear;
-	}
-	else
-	{
-		fec_header_size += kFecLevelHeaderSizeLbitSet;
-		mask_len = kMaskSizeLbitSet;
-	}
+	size_t media_size = _media_packets.size();
+	std::vector<size_t> indices;
 
-	for(uint32_t i=0; i<fec_packet_count; i++)
+	// The mask can cover up to kUlpfecMaxMediaPacketsLbitSet packets
+	for(size_t block_start = 0; block_start < media_size; block_start += kUlpfecMaxMediaPacketsLbitSet)
 	{
-		uint16_t sn_base = 0;
-		bool first_media_packet;
-		uint8_t mask[6];
-		int selected_media_count;
-
-		first_media_packet = true;
+		size_t block_size = std::min(media_size - block_start, kUlpfecMaxMediaPacketsLbitSet);
+		size_t block_end = block_start + block_size;
+		size_t fec_packet_count = std::clamp<size_t>(((block_size * _rate) + 99) / 100, 1, block_size);
 
-		// TODO(Getroot): A more efficient algorithm should be used like random mask or bursty mask.
-		auto fec_packet = std::make_shared<ov::Data>();
-		fec_packet->SetLength(fec_header_size);
-		auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+		// Runs of consecutive packets, distributed evenly
+		auto encode_consecutive = [&](size_t group_count) {
+			size_t media_packet_idx = block_start;
 
-		// Initialize
-		memset(mask, 0, sizeof(mask));
-		first_media_packet = true;
-		selected_media_count = (media_size-media_packet_idx) / (fec_packet_count - i);
-
-		for(int j=0; j<selected_media_count; j++)
-		{
-			auto media_packet = _media_packets[media_packet_idx];
+			for(size_t group = 0; group < group_count; group++)
+			{
+				size_t selected_media_count = (block_end - media_packet_idx) / (group_count - group);
 
-			size_t fec_packet_length = fec_header_size + media_packet->PayloadSize();
+				indices.clear();
+				for(size_t i = 0; i < selected_media_count; i++)
+				{
+					indices.push_back(media_packet_idx++);
+				}
 
-			if(fec_packet->GetLength() < fec_packet_length)
-			{
-				fec_packet->SetLength(fec_packet_length);
-				fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+				EncodeFecPacket(indices);
 			}
+		};
 
-			if(first_media_packet)
+		// Every group_count-th packet
+		auto encode_interleaved = [&](size_t group_count) {
+			for(size_t group = 0; group < group_count; group++)
 			{
-				// Write P, X, CC fields.
-				// Bits 0, 1 are overwritten in FinalizeFecHeaders.
-				fec_buffer[0] = media_packet->Buffer()[0];
-
-				// The media_packet is red packet. So buffer[1] of RTP header has red payload type.
-				// We should use media payload type in the red header.
-				// M, and PT recovery
-				fec_buffer[1] = media_packet->Buffer()[media_packet->HeadersSize() - 1];
-				if(media_packet->Marker())
-				{
-					fec_buffer[1] |= 0x80;
-				}
-				else
+				indices.clear();
+				for(size_t media_packet_idx = block_start + group; media_packet_idx < block_end; media_packet_idx += group_count)
 				{
-					fec_buffer[1] &= 0x7F;
+					indices.push_back(media_packet_idx);
 				}
 
-				// SN Base
-				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[2], media_packet->SequenceNumber());
-				// Write timestamp recovery field.
-				ByteWriter<uint32_t>::WriteBigEndian(&fec_buffer[4], media_packet->Timestamp());
-				// Write length recovery field.
-				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[8], (uint16_t)media_packet->PayloadSize());
-				// Write Payload.
-				memcpy(&fec_buffer[fec_header_size], media_packet->Payload(), media_packet->PayloadSize());
-
-				sn_base = media_packet->SequenceNumber();
-
-				first_media_packet = false;
-			}
-			else
-			{
-				XorFecPacket(fec_buffer, fec_header_size, media_packet.get());
+				EncodeFecPacket(indices);
 			}
+		};
 
-			uint16_t diff = media_packet->SequenceNumber() - sn_base;
-			mask[diff / 8] |= 1 << (7 - (diff % 8));
-			media_packet_idx++;
-		}
+		switch(_scheme)
+		{
+			case WebRtcFecScheme::Consecutive:
+				encode_consecutive(fec_packet_count);
+				break;
+
+			case WebRtcFecScheme::Interleaved:
+				encode_interleaved(fec_packet_count);
+				break;
 
-		FinalizeFecHeader(fec_buffer, fec_packet->GetLength() - fec_header_size, mask, mask_len);
+			case WebRtcFecScheme::TwoDimensional: {
+				size_t row_count = (fec_packet_count + 1) / 2;
+				size_t column_count = fec_packet_count - row_count;
 
-		_generated_fec_packets.push(fec_packet);
+				encode_consecutive(row_count);
+				if(column_count > 0)
+				{
+					encode_interleaved(column_count);
+				}
+				break;
+			}
+		}
 	}
+
 	// clear media packet
 	_media_packets.clear();
 
+	_encode_duration_histogram->Observe(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count());
+
 	return true;
 }
 
-void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *media_packet)
+void UlpfecGenerator::EncodeFecPacket(const std::vector<size_t> &media_packet_indices)
 {
-	auto rtp_header = media_packet->Header();
-	auto rtp_header_len = media_packet->HeadersSize();
-	auto rtp_payload = media_packet->Payload();
-	auto rtp_payload_len = media_packet->PayloadSize();
+	const auto &first_media_packet = _media_packets[media_packet_indices.front()];
+	uint16_t sn_base = first_media_packet.sequence_number;
 
-	// XOR the first 2 bytes of the header: V, P, X, CC
-	fec_packet[0] ^= rtp_header[0];
+	// The L bit is set if the mask needs more than 16 bits
+	uint16_t span = _media_packets[media_packet_indices.back()].sequence_number - sn_base + 1;
+	bool l_bit = (span > kUlpfecMaxMediaPacketsLbitClear);
+	size_t mask_len = l_bit ? kMaskSizeLbitSet : kMaskSizeLbitClear;
+	size_t fec_header_size = kFecHeaderSize + (l_bit ? kFecLevelHeaderSizeLbitSet : kFecLevelHeaderSizeLbitClear);
 
-	uint8_t m_pt_fields = rtp_header[rtp_header_len-1];
-	if(media_packet->Marker())
+	size_t max_payload_size = 0;
+	for(auto index : media_packet_indices)
 	{
-		m_pt_fields |= 0x80;
+		max_payload_size = std::max(max_payload_size, _media_packets[index].payload_size);
 	}
-	else
+
+	// Allocated at once (zero-filled), so the payloads can be XORed without resizing
+	auto fec_packet = std::make_shared<ov::Data>(fec_header_size + max_payload_size);
+	fec_packet->SetLength(fec_header_size + max_payload_size);
+	auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+
+	uint8_t mask[kMaskSizeLbitSet];
+	memset(mask, 0, sizeof(mask));
+
+	// Write P, X, CC fields.
+	// Bits 0, 1 are overwritten in FinalizeFecHeaders.
+	fec_buffer[0] = first_media_packet.first_byte;
+	// M, and PT recovery
+	fec_buffer[1] = first_media_packet.marker_and_pt;
+	// SN Base
+	ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[2], sn_base);
+	// Write timestamp recovery field.
+	ByteWriter<uint32_t>::WriteBigEndian(&fec_buffer[4], first_media_packet.timestamp);
+	// Write length recovery field.
+	ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[8], (uint16_t)first_media_packet.payload_size);
+	// Write Payload.
+	memcpy(&fec_buffer[fec_header_size], first_media_packet.Payload(), first_media_packet.payload_size);
+
+	for(size_t i = 0; i < media_packet_indices.size(); i++)
 	{
-		m_pt_fields &= 0x7F;
+		const auto &media_packet = _media_packets[media_packet_indices[i]];
+
+		if(i > 0)
+		{
+			XorFecPacket(fec_buffer, fec_header_size, media_packet);
+		}
+
+		uint16_t diff = media_packet.sequence_number - sn_base;
+		mask[diff / 8] |= 1 << (7 - (diff % 8));
 	}
-	fec_packet[1] ^= m_pt_fields;
+
+	FinalizeFecHeader(fec_buffer, max_payload_size, l_bit, mask, mask_len);
+
+	_generated_fec_packets.push(fec_packet);
+}
+
+void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, const MediaPacket &media_packet)
+{
+	// XOR the first 2 bytes of the header: V, P, X, CC
+	fec_packet[0] ^= media_packet.first_byte;
+	fec_packet[1] ^= media_packet.marker_and_pt;
 
 	// XOR TS recovery
-	fec_packet[4] ^= rtp_header[4];
-	fec_packet[5] ^= rtp_header[5];
-	fec_packet[6] ^= rtp_header[6];
-	fec_packet[7] ^= rtp_header[7];
+	uint8_t timestamp_network_order[4];
+	ByteWriter<uint32_t>::WriteBigEndian(timestamp_network_order, media_packet.timestamp);
+	fec_packet[4] ^= timestamp_network_order[0];
+	fec_packet[5] ^= timestamp_network_order[1];
+	fec_packet[6] ^= timestamp_network_order[2];
+	fec_packet[7] ^= timestamp_network_order[3];
 
 	// XOR Length recovery
 	uint8_t rtp_payload_length_network_order[2];
-	ByteWriter<uint16_t>::WriteBigEndian(rtp_payload_length_network_order, (uint16_t)rtp_payload_len);
+	ByteWriter<uint16_t>::WriteBigEndian(rtp_payload_length_network_order, (uint16_t)media_packet.payload_size);
 	fec_packet[8] ^= rtp_payload_length_network_order[0];
 	fec_packet[9] ^= rtp_payload_length_network_order[1];
 
 	// XOR Payload
-	for(size_t i = 0; i < rtp_payload_len; i++)
-	{
-		fec_packet[fec_header_len + i] ^= rtp_payload[i];
-	}
+	FecXorKernel::Xor(&fec_packet[fec_header_len], media_packet.Payload(), media_packet.payload_size);
 }
 
-void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len)
+void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, bool l_bit, const uint8_t *mask, const size_t mask_len)
 {
 	// Set E bit to zero.
 	fec_packet[0] &= 0x7f;
 
-	// Set L bit
-	if(_media_packets.size() <= kUlpfecMaxMediaPacketsLbitClear)
+	if(l_bit)
 	{
-		// Clear L bit
-		fec_packet[0] &= 0xbf;
+		// Set L bit
+		fec_packet[0] |= 0x40;
 	}
 	else
 	{
-		// Set L bit
-		fec_packet[0] |= 0x40;
+		// Clear L bit
+		fec_packet[0] &= 0xbf;
 	}
 
 	// FEC Level header
@@ -225,4 +263,4 @@ void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_pa
 
 	// Mask
 	memcpy(&fec_packet[12], mask, mask_len);
-}
\ No newline at end of file
+}
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <base/ovlibrary/histogram.h>
+
 #include "base/common_types.h"
 #include "red_rtp_packet.h"
 
@@ -34,32 +36,60 @@
 */
 
 /*
- *	The current version of OME protects all contiguous media packets with one FEC packet,
- *  and one media packet only protects with one FEC packet.
- *  Fec packets is generated by a frame.
- *  Current version generates only one fec packet, near future we will apply bursty mask model.
- *  The session determines whether the FEC PACKET is sent according to the network status (using RTCP RR).
+ *  FEC packets are generated by a frame, once per stream (the packets are shared by all sessions).
+ *  The media packets of a frame are split into blocks of up to 48 packets (the size of the mask),
+ *  and (rate / 100) FEC packets are generated for each block, grouping the media packets by the scheme:
+ *  - Consecutive: runs of consecutive packets
+ *  - Interleaved: every N-th packet, which recovers a burst loss
+ *  - TwoDimensional: both of the above, so a media packet is protected by two FEC packets
  */
 
+#define ULPFEC_DEFAULT_PROTECTION_RATE 14
+
 class UlpfecGenerator
 {
 public:
 	UlpfecGenerator();
 	~UlpfecGenerator();
 
-	void SetHighRateProtection(bool high_level);
-	// Because RTP is already being sent out, we execute ulpfec using the newly created red packet.
-	// I used this technique to reduce the copying and improve performance.
-	bool AddRtpPacketAndGenerateFec(std::shared_ptr<RedRtpPacket> packet);
+	// rate: the number of FEC packets per 100 media packets (1 ~ 100)
+	void SetProtection(WebRtcFecScheme scheme, int rate);
+	// The packet is referenced (not copied) until the FEC packets of the frame are generated,
+	// so it must not be modified except PackageAsRtp().
+	bool AddRtpPacketAndGenerateFec(const std::shared_ptr<RedRtpPacket> &packet);
 	bool IsAvailableFecPackets() const;
 	bool NextPacket(RtpPacket *packet);
 
 private:
+	// The fields of the media packet that are protected, taken when the packet is in the RED format
+	struct MediaPacket
+	{
+		std::shared_ptr<const RedRtpPacket> packet;
+		uint8_t first_byte = 0;		// V, P, X, CC
+		uint8_t marker_and_pt = 0;	// M and the media payload type (in the RED header)
+		uint16_t sequence_number = 0;
+		uint32_t timestamp = 0;
+		// The payload in the RED format
+		size_t payload_offset = 0;
+		size_t payload_size = 0;
+
+		const uint8_t *Payload() const
+		{
+			return packet->Buffer() + payload_offset;
+		}
+	};
+
 	bool Encode();
-	void XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *packet);
-	void FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len);
+	// Generates a FEC packet that protects the media packets of the indices (ascending)
+	void EncodeFecPacket(const std::vector<size_t> &media_packet_indices);
+	void XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, const MediaPacket &packet);
+	void FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, bool l_bit, const uint8_t *mask, const size_t mask_len);
 
 	std::queue<std::shared_ptr<ov::Data>>	    _generated_fec_packets;
-	std::vector<std::shared_ptr<RedRtpPacket>>	_media_packets;
-	bool                                        _high_level;
+	std::vector<MediaPacket>					_media_packets;
+
+	WebRtcFecScheme								_scheme = WebRtcFecScheme::Consecutive;
+	int											_rate = ULPFEC_DEFAULT_PROTECTION_RATE;
+
+	std::shared_ptr<ov::Histogram>				_encode_duration_histogram;
 };
\ No newline at end of file
@@ -29,6 +29,17 @@ public:
 protected:
 	virtual bool UpdateData(ov::String &sdp) = 0;
 
+	const ov::String &GetText() const
+	{
+		return _sdp_text;
+	}
+
+	// The caller must keep the text consistent with the fields
+	void SetText(ov::String sdp_text)
+	{
+		_sdp_text = std::move(sdp_text);
+	}
+
 private:
 	ov::String _sdp_text;
 };
@@ -34,13 +34,11 @@ SessionDescription::SdpType SessionDescription::GetType() const
 bool SessionDescription::UpdateData(ov::String &sdp)
 {
 	// Session
-	sdp.Format(
-		"v=%d\r\n"
-		"o=%s %u %d %s IP%d %s\r\n"
+	sdp.Format("v=%d\r\n", _version);
+	AppendOriginLine(sdp);
+	sdp.AppendFormat(
 		"s=%s\r\n"
 		"t=%d %d\r\n",
-		_version,
-		_user_name.CStr(), _session_id, _session_version, _net_type.CStr(), _ip_version, _address.CStr(),
 		_session_name.CStr(),
 		_start_time, _stop_time
 	);
@@ -99,6 +97,81 @@ bool SessionDescription::UpdateData(ov::String &sdp)
 	return true;
 }
 
+void SessionDescription::AppendOriginLine(ov::String &sdp) const
+{
+	sdp.AppendFormat(
+		"o=%s %u %d %s IP%d %s\r\n",
+		_user_name.CStr(), _session_id, _session_version, _net_type.CStr(), _ip_version, _address.CStr());
+}
+
+bool SessionDescription::UpdateOriginAndIce()
+{
+	const auto &sdp = GetText();
+	auto text = sdp.CStr();
+	auto length = sdp.GetLength();
+
+	// Only the session section (before the first m= line) is patched, and the media sections are copied as they are
+	auto media_section = sdp.IndexOf("\r\nm=");
+	size_t session_section_length = (media_section >= 0) ? (media_section + 2) : length;
+
+	ov::String patched;
+	patched.SetCapacity(length + 64);
+
+	bool has_origin = false;
+	bool has_ice_ufrag = false;
+	bool has_ice_pwd = false;
+
+	size_t line_start = 0;
+
+	while (line_start < session_section_length)
+	{
+		auto line_end = sdp.IndexOf("\r\n", line_start);
+
+		if ((line_end < 0) || (static_cast<size_t>(line_end) >= session_section_length))
+		{
+			// Invalid text
+			return Update();
+		}
+
+		auto line = text + line_start;
+		auto next_line_start = line_end + 2;
+
+		if (::strncmp(line, "o=", 2) == 0)
+		{
+			AppendOriginLine(patched);
+			has_origin = true;
+		}
+		else if (::strncmp(line, "a=ice-ufrag:", 12) == 0)
+		{
+			patched.AppendFormat("a=ice-ufrag:%s\r\n", GetIceUfrag().CStr());
+			has_ice_ufrag = true;
+		}
+		else if (::strncmp(line, "a=ice-pwd:", 10) == 0)
+		{
+			patched.AppendFormat("a=ice-pwd:%s\r\n", GetIcePwd().CStr());
+			has_ice_pwd = true;
+		}
+		else
+		{
+			patched.Append(line, next_line_start - line_start);
+		}
+
+		line_start = next_line_start;
+	}
+
+	if ((has_origin == false) || (has_ice_ufrag == false) || (has_ice_pwd == false))
+	{
+		// The template doesn't have the lines (e.g. ICE attributes are in the media sections)
+		return Update();
+	}
+
+	patched.Append(text + session_section_length, length - session_section_length);
+
+	SetText(std::move(patched));
+
+	return true;
+}
+
 bool SessionDescription::FromString(const ov::String &sdp)
 {
 	static const std::regex ValidLineRegex("^([a-z])=(.*)");
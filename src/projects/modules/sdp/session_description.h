@@ -64,6 +64,11 @@ public:
 
 	bool FromString(const ov::String &sdp) override;
 
+	// Updates the SDP text of a copied description when only the origin and the ICE ufrag/pwd are changed.
+	// The lines are replaced in the text of the original description (the template) instead of serializing
+	// all the attributes again, and Update() is called if the text doesn't have the lines.
+	bool UpdateOriginAndIce();
+
 	// v=0
 	void SetVersion(uint8_t version);
 	uint8_t GetVersion() const;
@@ -119,6 +124,7 @@ public:
 
 private:
 	bool UpdateData(ov::String &sdp) override;
+	void AppendOriginLine(ov::String &sdp) const;
 	bool ParsingSessionLine(char type, std::string content);
 
 	// SdpType
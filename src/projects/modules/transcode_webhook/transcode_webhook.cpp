@@ -12,7 +12,7 @@
 #include <monitoring/monitoring.h>
 #include <modules/json_serdes/application.h>
 #include <modules/json_serdes/stream.h>
-#include <modules/http/client/http_client.h>
+#include <modules/http/client/webhook_client.h>
 
 #define OV_LOG_TAG "TranscodeWebhook"
 
@@ -47,19 +47,6 @@ TranscodeWebhook::Policy TranscodeWebhook::RequestOutputProfiles(const info::Str
 	}
 
 	auto signature_sha1_base64 = ov::Base64::Encode(md_sha1, true);
-    auto timeout_msec = _config.GetTimeout();
-    auto client = std::make_shared<http::clnt::HttpClient>();
-    client->SetMethod(http::Method::Post);
-	client->SetBlockingMode(ov::BlockingMode::Blocking);
-	client->SetConnectionTimeout(timeout_msec);
-    client->SetRecvTimeout(timeout_msec);
-	client->SetRequestHeader("X-OME-Signature", signature_sha1_base64);
-	client->SetRequestHeader("Content-Type", "application/json");
-	client->SetRequestHeader("Accept", "application/json");
-	client->SetRequestBody(body);
-
-    ov::StopWatch watch;
-	watch.Start();
 
     auto control_server_url = ov::Url::Parse(_config.GetControlServerUrl());
     if (control_server_url == nullptr)
@@ -68,38 +55,42 @@ TranscodeWebhook::Policy TranscodeWebhook::RequestOutputProfiles(const info::Str
         return Policy::DeleteStream;
     }
 
-    int elapsed_ms = 0;
+	http::clnt::WebhookRequest request;
+	request.method = http::Method::Post;
+	request.url = control_server_url->ToUrlString(true);
+	request.timeout_msec = _config.GetTimeout();
+	request.headers["X-OME-Signature"] = signature_sha1_base64;
+	request.headers["Content-Type"] = "application/json";
+	request.headers["Accept"] = "application/json";
+	request.body = body.ToData(false);
+	// The response only depends on the request, so the same requests in flight can share it
+	request.coalesce = true;
+
+	auto response = http::clnt::WebhookClient::GetInstance()->Send(request);
+
     TranscodeWebhook::Policy policy;
 
-    client->Request(control_server_url->ToUrlString(true), [&](http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) 
-	{
-        elapsed_ms = watch.Elapsed();
-
-		// A response was received from the server.
-		if(error == nullptr) 
-		{	
-			if(status_code == http::StatusCode::OK) 
-			{
-				// Parsing response
-				policy = ParseResponse(input_stream_info, data, output_profiles);
-				return;
-			} 
-			else 
-			{
-                policy = _config.GetUseLocalProfilesOnErrorResponse() ? Policy::UseLocalProfiles : Policy::DeleteStream;
-                
-                logti("Control Server responded error status. HTTP code(%d) use local profiles(%s)", static_cast<uint16_t>(status_code), policy == Policy::UseLocalProfiles ? "true" : "false");
-                return;
-			}
-		}
-		else
+	// A response was received from the server.
+	if(response->error == nullptr) 
+	{	
+		if(response->status_code == http::StatusCode::OK) 
 		{
-            policy = _config.GetUseLocalProfilesOnConnectionFailure() ? Policy::UseLocalProfiles : Policy::DeleteStream;
-			// A connection error or an error that does not conform to the HTTP spec has occurred.
-			logte("The HTTP client's request failed. error code(%d) error message(%s) use local profile(%s)", error->GetCode(), error->GetMessage().CStr(), policy == Policy::UseLocalProfiles ? "true" : "false");
-			return;
+			// Parsing response
+			policy = ParseResponse(input_stream_info, response->body, output_profiles);
+		} 
+		else 
+		{
+            policy = _config.GetUseLocalProfilesOnErrorResponse() ? Policy::UseLocalProfiles : Policy::DeleteStream;
+            
+            logti("Control Server responded error status. HTTP code(%d) use local profiles(%s)", static_cast<uint16_t>(response->status_code), policy == Policy::UseLocalProfiles ? "true" : "false");
 		}
-	});
+	}
+	else
+	{
+        policy = _config.GetUseLocalProfilesOnConnectionFailure() ? Policy::UseLocalProfiles : Policy::DeleteStream;
+		// A connection error or an error that does not conform to the HTTP spec has occurred.
+		logte("The HTTP client's request failed. error code(%d) error message(%s) use local profile(%s)", response->error->GetCode(), response->error->GetMessage().CStr(), policy == Policy::UseLocalProfiles ? "true" : "false");
+	}
 
     return policy;
 }
@@ -9,7 +9,7 @@
 #include "notification.h"
 
 #include "../monitoring_private.h"
-#include <modules/http/client/http_client.h>
+#include <modules/http/client/webhook_client.h>
 #include <modules/json_serdes/converters.h>
 
 namespace mon::alrt
@@ -82,41 +82,37 @@ namespace mon::alrt
 
 		auto signature_sha1_base64 = ov::Base64::Encode(md_sha1, true);
 
-		auto client				   = std::make_shared<http::clnt::HttpClient>();
-		client->SetMethod(http::Method::Post);
-		client->SetBlockingMode(ov::BlockingMode::Blocking);
-		client->SetConnectionTimeout(_timeout_msec);
-		client->SetRecvTimeout(_timeout_msec);
-		client->SetRequestHeader("X-OME-Signature", signature_sha1_base64);
-		client->SetRequestHeader("Content-Type", "application/json");
-		client->SetRequestHeader("Accept", "application/json");
-		client->SetRequestBody(_message_body);
+		http::clnt::WebhookRequest request;
+		request.method = http::Method::Post;
+		request.url = _notification_server_url->ToUrlString(true);
+		request.timeout_msec = _timeout_msec;
+		request.headers["X-OME-Signature"] = signature_sha1_base64;
+		request.headers["Content-Type"] = "application/json";
+		request.headers["Accept"] = "application/json";
+		request.body = _message_body.ToData(false);
 
-		ov::StopWatch watch;
-		watch.Start();
+		auto response = http::clnt::WebhookClient::GetInstance()->Send(request);
 
-		client->Request(_notification_server_url->ToUrlString(true), [=](http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) {
-			_elapsed_msec = watch.Elapsed();
+		_elapsed_msec = response->elapsed_msec;
 
-			// A response was received from the server.
-			if (error == nullptr)
+		// A response was received from the server.
+		if (response->error == nullptr)
+		{
+			if (response->status_code == http::StatusCode::OK)
 			{
-				if (status_code == http::StatusCode::OK)
-				{
-					return;
-				}
-				else
-				{
-					SetStatus(StatusCode::INVALID_STATUS_CODE, ov::String::FormatString("Control server responded with %d status code.", static_cast<uint16_t>(status_code)));
-					return;
-				}
+				return;
 			}
 			else
 			{
-				// A connection error or an error that does not conform to the HTTP spec has occurred.
-				SetStatus(StatusCode::INTERNAL_ERROR, ov::String::FormatString("The HTTP client's request failed. (error code(%d) error message(%s)", error->GetCode(), error->GetMessage().CStr()));
+				SetStatus(StatusCode::INVALID_STATUS_CODE, ov::String::FormatString("Control server responded with %d status code.", static_cast<uint16_t>(response->status_code)));
 				return;
 			}
-		});
+		}
+		else
+		{
+			// A connection error or an error that does not conform to the HTTP spec has occurred.
+			SetStatus(StatusCode::INTERNAL_ERROR, ov::String::FormatString("The HTTP client's request failed. (error code(%d) error message(%s)", response->error->GetCode(), response->error->GetMessage().CStr()));
+			return;
+		}
 	}
 }  // namespace mon::alrt
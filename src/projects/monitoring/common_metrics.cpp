@@ -9,10 +9,31 @@ namespace mon
 {
 #define THROUGHPUT_MEASURE_INTERVAL 1
 
+	namespace
+	{
+		// The threads are assigned to the shards in a round-robin manner
+		size_t GetShardIndex()
+		{
+			static std::atomic<size_t> last_shard_index = 0;
+			thread_local size_t shard_index = last_shard_index.fetch_add(1, std::memory_order_relaxed) % METRICS_SHARD_COUNT;
+
+			return shard_index;
+		}
+
+		// The resolution of the coarse clock (a few milliseconds) is enough for "last sent time",
+		// and it is much cheaper than system_clock::now()
+		int64_t GetCoarseTimeMSec()
+		{
+			struct timespec now;
+			::clock_gettime(CLOCK_REALTIME_COARSE, &now);
+
+			return (static_cast<int64_t>(now.tv_sec) * 1000) + (now.tv_nsec / 1000000);
+		}
+	}  // namespace
+
 	CommonMetrics::CommonMetrics()
 	{
 		_total_bytes_in				  = 0;
-		_total_bytes_out			  = 0;
 		_total_connections			  = 0;
 		_max_total_connections		  = 0;
 
@@ -30,11 +51,9 @@ namespace mon
 
 		_max_total_connection_time	  = std::chrono::system_clock::now();
 		_last_recv_time				  = std::chrono::system_clock::now();
-		_last_sent_time				  = std::chrono::system_clock::now();
 
 		for (int i = 0; i < static_cast<int8_t>(PublisherType::NumberOfPublishers); i++)
 		{
-			_publisher_metrics[i]._bytes_out   = 0;
 			_publisher_metrics[i]._connections = 0;
 		}
 		_created_time = std::chrono::system_clock::now();
@@ -91,9 +110,10 @@ namespace mon
 		return _created_time;
 	}
 
-	const std::chrono::system_clock::time_point &CommonMetrics::GetLastUpdatedTime() const
+	std::chrono::system_clock::time_point CommonMetrics::GetLastUpdatedTime() const
 	{
-		return _last_updated_time;
+		// Sending the data updates the metrics too, but it doesn't renew _last_updated_time for every packet
+		return std::max(_last_updated_time, GetLastSentTime());
 	}
 
 	uint64_t CommonMetrics::GetTotalBytesIn() const
@@ -102,7 +122,14 @@ namespace mon
 	}
 	uint64_t CommonMetrics::GetTotalBytesOut() const
 	{
-		return _total_bytes_out;
+		uint64_t total_bytes_out = 0;
+
+		for (const auto &shard : _outbound_shards)
+		{
+			total_bytes_out += shard.total_bytes_out.load(std::memory_order_relaxed);
+		}
+
+		return total_bytes_out;
 	}
 
 	uint64_t CommonMetrics::GetAvgThroughputIn() const
@@ -156,12 +183,27 @@ namespace mon
 
 	std::chrono::system_clock::time_point CommonMetrics::GetLastSentTime() const
 	{
-		return _last_sent_time;
+		int64_t last_sent_time_msec = 0;
+
+		for (const auto &shard : _outbound_shards)
+		{
+			last_sent_time_msec = std::max(last_sent_time_msec, shard.last_sent_time_msec.load(std::memory_order_relaxed));
+		}
+
+		// Same as before anything is sent
+		return std::max(_created_time, std::chrono::system_clock::time_point(std::chrono::milliseconds(last_sent_time_msec)));
 	}
 
 	uint64_t CommonMetrics::GetBytesOut(PublisherType type) const
 	{
-		return _publisher_metrics[static_cast<int8_t>(type)]._bytes_out;
+		uint64_t bytes_out = 0;
+
+		for (const auto &shard : _outbound_shards)
+		{
+			bytes_out += shard.bytes_out[static_cast<int8_t>(type)].load(std::memory_order_relaxed);
+		}
+
+		return bytes_out;
 	}
 	uint64_t CommonMetrics::GetConnections(PublisherType type) const
 	{
@@ -196,11 +238,16 @@ namespace mon
 			return;
 		}
 
-		_publisher_metrics[static_cast<int8_t>(type)]._bytes_out += value;
-		_total_bytes_out += value;
-		_last_sent_time = std::chrono::system_clock::now();
+		AddBytesOut(type, value);
+	}
+
+	void CommonMetrics::AddBytesOut(PublisherType type, uint64_t value)
+	{
+		auto &shard = _outbound_shards[GetShardIndex()];
 
-		UpdateDate();
+		shard.bytes_out[static_cast<int8_t>(type)].fetch_add(value, std::memory_order_relaxed);
+		shard.total_bytes_out.fetch_add(value, std::memory_order_relaxed);
+		shard.last_sent_time_msec.store(GetCoarseTimeMSec(), std::memory_order_relaxed);
 	}
 
 	void CommonMetrics::IncreaseModuleUsageCount(cmn::MediaCodecModuleId module_id)
@@ -267,15 +314,16 @@ namespace mon
 			_last_total_bytes_in.store(_total_bytes_in);
 
 			// Calculate last second throughput of publisher
-			_last_throughtput_out = (_total_bytes_out.load() - _last_total_bytes_out.load());
+			auto total_bytes_out  = GetTotalBytesOut();
+			_last_throughtput_out = (total_bytes_out - _last_total_bytes_out.load());
 
 			// Calculate average throughput of publisher
-			_avg_throughtput_out  = (_total_bytes_out.load() - _last_total_bytes_out.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
+			_avg_throughtput_out  = (total_bytes_out - _last_total_bytes_out.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
 			if (_avg_throughtput_out.load() > _max_throughtput_out.load())
 			{
 				_max_throughtput_out.store(_avg_throughtput_out);
 			}
-			_last_total_bytes_out.store(_total_bytes_out);
+			_last_total_bytes_out.store(total_bytes_out);
 		}
 	}
 }  // namespace mon
\ No newline at end of file
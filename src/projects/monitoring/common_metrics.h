@@ -8,6 +8,9 @@
 #include "base/info/info.h"
 #include "base/info/stream.h"
 
+// The number of shards of the counters that are updated on the hot paths
+#define METRICS_SHARD_COUNT 16
+
 namespace mon
 {
 	class CommonMetrics
@@ -18,7 +21,7 @@ namespace mon
 
 		uint32_t GetUnusedTimeSec() const;
 		const std::chrono::system_clock::time_point &GetCreatedTime() const;
-		const std::chrono::system_clock::time_point &GetLastUpdatedTime() const;
+		std::chrono::system_clock::time_point GetLastUpdatedTime() const;
 
 		virtual uint64_t GetTotalBytesIn() const;
 		virtual uint64_t GetTotalBytesOut() const;
@@ -39,6 +42,9 @@ namespace mon
 
 		virtual void IncreaseBytesIn(uint64_t value);
 		virtual void IncreaseBytesOut(PublisherType type, uint64_t value);
+		// Increases the counters of this metrics only (IncreaseBytesOut() of StreamMetrics propagates it to the origin stream).
+		// It only updates the shard of the calling thread, so it can be called for every packet.
+		void AddBytesOut(PublisherType type, uint64_t value);
 		void IncreaseModuleUsageCount(cmn::MediaCodecModuleId module_id);
 		void DecreaseModuleUsageCount(cmn::MediaCodecModuleId module_id);
 		virtual void OnSessionConnected(PublisherType type);
@@ -59,16 +65,12 @@ namespace mon
 		// From Provider
 		std::atomic<uint64_t> _total_bytes_in;
 
-		// From Publishers
-		std::atomic<uint64_t> _total_bytes_out;
-
 		std::atomic<uint32_t> _total_connections;
 		std::atomic<uint32_t> _max_total_connections;
 		// Time to reach maximum number of connections.
 		// TODO(Getroot): Does it need mutex? Check!
 		std::chrono::system_clock::time_point _max_total_connection_time;
 		std::chrono::system_clock::time_point _last_recv_time;
-		std::chrono::system_clock::time_point _last_sent_time;
 
 		// Throughput from Provider
 		std::atomic<uint64_t> _avg_throughtput_in;
@@ -88,11 +90,22 @@ namespace mon
 		class PublisherMetrics
 		{
 		public:
-			std::atomic<uint64_t> _bytes_out;
 			std::atomic<uint32_t> _connections;
 		};
 
 		PublisherMetrics _publisher_metrics[static_cast<int8_t>(PublisherType::NumberOfPublishers)];
+
+		// From Publishers - updated for every packet sent to every session, so each thread updates its own shard
+		// (to avoid bouncing a cache line between the cores), and the shards are summed up when they are read
+		struct alignas(64) OutboundShard
+		{
+			std::atomic<uint64_t> total_bytes_out = 0;
+			std::atomic<uint64_t> bytes_out[static_cast<int8_t>(PublisherType::NumberOfPublishers)] = {};
+			// Milliseconds since epoch
+			std::atomic<int64_t> last_sent_time_msec = 0;
+		};
+
+		OutboundShard _outbound_shards[METRICS_SHARD_COUNT];
 		std::atomic<int32_t> _module_usage_count[ov::ToUnderlyingType(cmn::MediaCodecModuleId::NB)] = {};
 	};
 }  // namespace mon
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include <base/ovlibrary/files.h>
 #include <base/ovlibrary/path_manager.h>
-#include <modules/http/client/http_client.h>
+#include <modules/http/client/webhook_client.h>
 
 #include "event_logger.h"
 #include "monitoring_private.h"
@@ -321,32 +321,22 @@ namespace mon
 
 	bool EventForwarder::AuthOvenConsole()
 	{
-		auto client = std::make_shared<http::clnt::HttpClient>();
-		client->SetMethod(http::Method::Post);
-		client->SetBlockingMode(ov::BlockingMode::Blocking);
-		client->SetConnectionTimeout(3000);
-		client->SetRequestHeader("Authorization", ov::String::FormatString("Bearer %s", _user_key.CStr()));
-		client->Request(OVEN_CONSOLE_AUTH_URL, [=](http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) {
-			// A response was received from the server.
-			if (error == nullptr)
-			{
-				if (status_code == http::StatusCode::OK)
-				{
-					return true;
-				}
-				else
-				{
-					// Receive Invalid Status Code
-					return false;
-				}
-			}
-			else
-			{
-				// A connection error or an error that does not conform to the HTTP spec has occurred.
-				return false;
-			}
-		});
+		http::clnt::WebhookRequest request;
+		request.method = http::Method::Post;
+		request.url = OVEN_CONSOLE_AUTH_URL;
+		request.timeout_msec = 3000;
+		request.headers["Authorization"] = ov::String::FormatString("Bearer %s", _user_key.CStr());
+
+		auto response = http::clnt::WebhookClient::GetInstance()->Send(request);
+
+		// A response was received from the server.
+		if (response->error == nullptr)
+		{
+			// false if the status code is invalid
+			return response->status_code == http::StatusCode::OK;
+		}
 
+		// A connection error or an error that does not conform to the HTTP spec has occurred.
 		return false;
 	}
 
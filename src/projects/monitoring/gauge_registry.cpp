@@ -0,0 +1,40 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "gauge_registry.h"
+
+namespace mon
+{
+	void GaugeRegistry::Register(const ov::String &name, const ov::String &help, const ov::String &labels, Getter getter)
+	{
+		auto key = ov::String::FormatString("%s{%s}", name.CStr(), labels.CStr());
+
+		std::lock_guard lock_guard(_item_map_mutex);
+
+		_item_map[key] = {name, help, labels, std::move(getter)};
+	}
+
+	void GaugeRegistry::Unregister(const ov::String &name, const ov::String &labels)
+	{
+		auto key = ov::String::FormatString("%s{%s}", name.CStr(), labels.CStr());
+
+		// The getters are called with the lock held in Iterate()
+		std::lock_guard lock_guard(_item_map_mutex);
+
+		_item_map.erase(key);
+	}
+
+	void GaugeRegistry::Iterate(const Iterator &iterator) const
+	{
+		std::lock_guard lock_guard(_item_map_mutex);
+
+		for (const auto &[key, item] : _item_map)
+		{
+			iterator(item.name, item.help, item.labels, item.getter());
+		}
+	}
+}  // namespace mon
@@ -0,0 +1,49 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace mon
+{
+	// The gauges of the components that are not a part of the ServerMetrics (e.g. the depth of the queues of a worker pool),
+	// exported by the PrometheusExporter.
+	//
+	// The value is read by the getter when the snapshot is rendered, so the component doesn't need to push it.
+	class GaugeRegistry : public ov::Singleton<GaugeRegistry>
+	{
+	public:
+		// Called in the thread that renders the snapshot, so it must be thread-safe
+		using Getter = std::function<int64_t()>;
+		using Iterator = std::function<void(const ov::String &name, const ov::String &help, const ov::String &labels, int64_t value)>;
+
+		// labels: The labels in the exposition format without braces (e.g. R"(pool="DTLS")")
+		// The gauge of the same name and labels is replaced.
+		// The getter is called until Unregister(), so the owner of the objects it refers to must unregister it
+		// before releasing them (e.g. in its destructor).
+		void Register(const ov::String &name, const ov::String &help, const ov::String &labels, Getter getter);
+		// Waits for the getter if it is being called, so the getter is never called after this returns
+		void Unregister(const ov::String &name, const ov::String &labels = "");
+
+		// The gauges of the same name are iterated in a row
+		void Iterate(const Iterator &iterator) const;
+
+	private:
+		struct Item
+		{
+			ov::String name;
+			ov::String help;
+			ov::String labels;
+			Getter getter;
+		};
+
+		mutable std::mutex _item_map_mutex;
+		// key: <name>{<labels>} - sorted, so the items of the same name are adjacent
+		std::map<ov::String, Item> _item_map;
+	};
+}  // namespace mon
@@ -0,0 +1,93 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "histogram_registry.h"
+
+namespace mon
+{
+	std::shared_ptr<ov::Histogram> HistogramRegistry::Get(const ov::String &name, const ov::String &help, const ov::String &labels)
+	{
+		auto key = ov::String::FormatString("%s{%s}", name.CStr(), labels.CStr());
+
+		std::lock_guard lock_guard(_item_map_mutex);
+
+		auto &item = _item_map[key];
+
+		if (item.histogram == nullptr)
+		{
+			item.name = name;
+			item.help = help;
+			item.labels = labels;
+			item.histogram = std::make_shared<ov::Histogram>();
+		}
+
+		return item.histogram;
+	}
+
+	void HistogramRegistry::Remove(const ov::String &name, const ov::String &labels)
+	{
+		auto key = ov::String::FormatString("%s{%s}", name.CStr(), labels.CStr());
+
+		std::lock_guard lock_guard(_item_map_mutex);
+
+		_item_map.erase(key);
+	}
+
+	void HistogramRegistry::Iterate(const Iterator &iterator) const
+	{
+		std::vector<Item> item_list;
+
+		{
+			std::lock_guard lock_guard(_item_map_mutex);
+
+			item_list.reserve(_item_map.size());
+
+			for (const auto &[key, item] : _item_map)
+			{
+				item_list.push_back(item);
+			}
+		}
+
+		for (const auto &item : item_list)
+		{
+			iterator(item.name, item.help, item.labels, *(item.histogram));
+		}
+	}
+
+	ov::String HistogramRegistry::EscapeLabelValue(const ov::String &value)
+	{
+		ov::String escaped;
+
+		escaped.SetCapacity(value.GetLength());
+
+		for (size_t index = 0; index < value.GetLength(); index++)
+		{
+			auto character = value[index];
+
+			switch (character)
+			{
+				case '\\':
+					escaped.Append("\\\\");
+					break;
+
+				case '"':
+					escaped.Append("\\\"");
+					break;
+
+				case '\n':
+					escaped.Append("\\n");
+					break;
+
+				default:
+					escaped.Append(character);
+					break;
+			}
+		}
+
+		return escaped;
+	}
+}  // namespace mon
@@ -0,0 +1,49 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/histogram.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace mon
+{
+	// The latency histograms of the hot paths, exported by the PrometheusExporter.
+	//
+	// Get() takes a lock, so the callers should look up the histogram once (e.g. when a queue is created)
+	// and keep it. Observing a value is lock-free (see ov::Histogram).
+	class HistogramRegistry : public ov::Singleton<HistogramRegistry>
+	{
+	public:
+		using Iterator = std::function<void(const ov::String &name, const ov::String &help, const ov::String &labels, const ov::Histogram &histogram)>;
+
+		// labels: The labels in the exposition format without braces (e.g. R"(stage="decode")")
+		std::shared_ptr<ov::Histogram> Get(const ov::String &name, const ov::String &help, const ov::String &labels = "");
+		// Stops exporting the histogram (e.g. when the stream or the session of the labels is deleted).
+		// The owners that still have the histogram can keep observing it.
+		void Remove(const ov::String &name, const ov::String &labels = "");
+
+		// The histograms of the same name are iterated in a row
+		void Iterate(const Iterator &iterator) const;
+
+		// Escapes a label value (\, " and newline)
+		static ov::String EscapeLabelValue(const ov::String &value);
+
+	private:
+		struct Item
+		{
+			ov::String name;
+			ov::String help;
+			ov::String labels;
+			std::shared_ptr<ov::Histogram> histogram;
+		};
+
+		mutable std::mutex _item_map_mutex;
+		// key: <name>{<labels>} - sorted, so the items of the same name are adjacent
+		std::map<ov::String, Item> _item_map;
+	};
+}  // namespace mon
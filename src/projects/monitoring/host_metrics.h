@@ -58,8 +58,43 @@ namespace mon
 			return GetApplicationMetrics(app_info.GetId());
 		}
 
+		// AdmissionWebhooks decision cache
+		void IncreaseAdmissionWebhooksCacheHits()
+		{
+			_admission_webhooks_cache_hits++;
+		}
+
+		void IncreaseAdmissionWebhooksCacheMisses()
+		{
+			_admission_webhooks_cache_misses++;
+		}
+
+		void IncreaseAdmissionWebhooksCacheCoalesced()
+		{
+			_admission_webhooks_cache_coalesced++;
+		}
+
+		uint64_t GetAdmissionWebhooksCacheHits() const
+		{
+			return _admission_webhooks_cache_hits;
+		}
+
+		uint64_t GetAdmissionWebhooksCacheMisses() const
+		{
+			return _admission_webhooks_cache_misses;
+		}
+
+		uint64_t GetAdmissionWebhooksCacheCoalesced() const
+		{
+			return _admission_webhooks_cache_coalesced;
+		}
+
 	private:
 		std::shared_mutex _map_guard;
 		std::map<uint32_t, std::shared_ptr<ApplicationMetrics>> _applications;
+
+		std::atomic<uint64_t> _admission_webhooks_cache_hits{0};
+		std::atomic<uint64_t> _admission_webhooks_cache_misses{0};
+		std::atomic<uint64_t> _admission_webhooks_cache_coalesced{0};
 	};
 }  // namespace mon
\ No newline at end of file
@@ -108,10 +108,28 @@ namespace mon
 				},
 				5000);
 
-			_timer.Start();
-
 			_forwarder.Start(server_config);
 		}
+
+		// Sample the statistics of the queues in one place, instead of in every Enqueue/Dequeue
+		_timer.Push(
+			[this](void *parameter) -> ov::DelayQueueAction {
+				_server_metric->CollectQueueMetrics();
+				return ov::DelayQueueAction::Repeat;
+			},
+			MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC);
+
+		// Render the snapshot off the API threads, so scraping doesn't walk the metrics
+		_prometheus_exporter.UpdateSnapshot(_server_metric);
+
+		_timer.Push(
+			[this](void *parameter) -> ov::DelayQueueAction {
+				_prometheus_exporter.UpdateSnapshot(_server_metric);
+				return ov::DelayQueueAction::Repeat;
+			},
+			PROMETHEUS_SNAPSHOT_INTERVAL_MSEC);
+
+		_timer.Start();
 	}
 
 	bool Monitoring::OnHostCreated(const info::Host &host_info)
@@ -443,6 +461,43 @@ namespace mon
 		stream_metric->IncreaseBytesOut(type, value);
 	}
 
+	std::shared_ptr<StreamMetricsHandle> Monitoring::GetStreamMetricsHandle(const info::Stream &stream_info)
+	{
+		auto server_metric = _server_metric;
+		if (server_metric == nullptr)
+		{
+			return nullptr;
+		}
+		auto host_metric = server_metric->GetHostMetrics(stream_info.GetApplicationInfo().GetHostInfo());
+		if (host_metric == nullptr)
+		{
+			return nullptr;
+		}
+		auto app_metric = host_metric->GetApplicationMetrics(stream_info.GetApplicationInfo());
+		if (app_metric == nullptr)
+		{
+			return nullptr;
+		}
+		auto stream_metric = app_metric->GetStreamMetrics(stream_info);
+		if (stream_metric == nullptr)
+		{
+			return nullptr;
+		}
+
+		std::vector<std::shared_ptr<CommonMetrics>> metrics_list{server_metric, host_metric, app_metric};
+
+		// Same as StreamMetrics::IncreaseBytesOut(), the origin streams are counted too
+		while (stream_metric != nullptr)
+		{
+			metrics_list.push_back(stream_metric);
+
+			auto origin_stream_info = stream_metric->GetLinkedInputStream();
+			stream_metric = (origin_stream_info != nullptr) ? app_metric->GetStreamMetrics(*origin_stream_info) : nullptr;
+		}
+
+		return std::make_shared<StreamMetricsHandle>(std::move(metrics_list));
+	}
+
 	void Monitoring::OnSessionConnected(const info::Stream &stream_info, PublisherType type)
 	{
 		auto host_metric = _server_metric->GetHostMetrics(stream_info.GetApplicationInfo().GetHostInfo());
@@ -532,4 +587,9 @@ namespace mon
 		return _alert;
 	}
 
+	std::shared_ptr<const ov::String> Monitoring::GetPrometheusSnapshot() const
+	{
+		return _prometheus_exporter.GetSnapshot();
+	}
+
 }  // namespace mon
\ No newline at end of file
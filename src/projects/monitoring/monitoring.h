@@ -9,7 +9,9 @@
 #include "base/ovlibrary/delay_queue.h"
 #include "event_forwarder.h"
 #include "event_logger.h"
+#include "prometheus_exporter.h"
 #include "server_metrics.h"
+#include "stream_metrics_handle.h"
 
 #define MonitorInstance mon::Monitoring::GetInstance()
 #define HostMetrics(info) mon::Monitoring::GetInstance()->GetHostMetrics(info);
@@ -56,17 +58,24 @@ namespace mon
 
 		void IncreaseBytesIn(const info::Stream &stream_info, uint64_t value);
 		void IncreaseBytesOut(const info::Stream &stream_info, PublisherType type, uint64_t value);
+		// Returns nullptr if the metrics of the stream is not found.
+		// The sessions that send the data frequently should hold it instead of calling IncreaseBytesOut().
+		std::shared_ptr<StreamMetricsHandle> GetStreamMetricsHandle(const info::Stream &stream_info);
 		void OnSessionConnected(const info::Stream &stream_info, PublisherType type);
 		void OnSessionDisconnected(const info::Stream &stream_info, PublisherType type);
 		void OnSessionsDisconnected(const info::Stream &stream_info, PublisherType type, uint64_t number_of_sessions);
 
 		std::shared_ptr<alrt::Alert> GetAlert();
 
+		// The last snapshot in the Prometheus text exposition format
+		std::shared_ptr<const ov::String> GetPrometheusSnapshot() const;
+
 	private:
 		ov::DelayQueue _timer{"MonLogTimer"};
 		std::shared_ptr<ServerMetrics> _server_metric = nullptr;
 		EventLogger _logger;
 		EventForwarder _forwarder;
+		PrometheusExporter _prometheus_exporter;
 		std::shared_ptr<alrt::Alert> _alert = nullptr;
 		bool _is_analytics_on				= false;
 	};
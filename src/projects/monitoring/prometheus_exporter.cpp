@@ -0,0 +1,193 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "prometheus_exporter.h"
+
+#include "monitoring_private.h"
+
+namespace mon
+{
+	void PrometheusExporter::Family::AppendSample(const ov::String &labels, uint64_t value)
+	{
+		if (labels.IsEmpty())
+		{
+			samples.AppendFormat("%s %" PRIu64 "\n", name, value);
+		}
+		else
+		{
+			samples.AppendFormat("%s{%s} %" PRIu64 "\n", name, labels.CStr(), value);
+		}
+	}
+
+	void PrometheusExporter::UpdateSnapshot(const std::shared_ptr<ServerMetrics> &server_metrics)
+	{
+		auto snapshot = std::make_shared<const ov::String>(Render(server_metrics));
+
+		std::lock_guard lock_guard(_snapshot_mutex);
+		_snapshot = std::move(snapshot);
+	}
+
+	std::shared_ptr<const ov::String> PrometheusExporter::GetSnapshot() const
+	{
+		std::lock_guard lock_guard(_snapshot_mutex);
+
+		if (_snapshot == nullptr)
+		{
+			return std::make_shared<const ov::String>();
+		}
+
+		return _snapshot;
+	}
+
+	ov::String PrometheusExporter::Render(const std::shared_ptr<ServerMetrics> &server_metrics)
+	{
+		Family bytes_in("ome_bytes_in_total", "counter", "Bytes received from the providers");
+		Family bytes_out("ome_bytes_out_total", "counter", "Bytes sent by the publishers");
+		Family connections("ome_connections", "gauge", "Number of the connected sessions");
+		Family publisher_bytes_out("ome_publisher_bytes_out_total", "counter", "Bytes sent by each publisher");
+		Family publisher_connections("ome_publisher_connections", "gauge", "Number of the connected sessions of each publisher");
+		Family rtx_history_bytes("ome_rtx_history_bytes", "gauge", "Bytes of the RTP packets kept for the retransmission");
+
+		auto append_metrics = [&](const ov::String &labels, const std::shared_ptr<CommonMetrics> &metrics) {
+			bytes_in.AppendSample(labels, metrics->GetTotalBytesIn());
+			bytes_out.AppendSample(labels, metrics->GetTotalBytesOut());
+			connections.AppendSample(labels, metrics->GetTotalConnections());
+
+			for (int type = static_cast<int>(PublisherType::Unknown) + 1; type < static_cast<int>(PublisherType::NumberOfPublishers); type++)
+			{
+				auto publisher_type = static_cast<PublisherType>(type);
+				auto publisher_labels = ov::String::FormatString(
+					"%s%spublisher=\"%s\"",
+					labels.CStr(), labels.IsEmpty() ? "" : ",",
+					StringFromPublisherType(publisher_type).CStr());
+
+				publisher_bytes_out.AppendSample(publisher_labels, metrics->GetBytesOut(publisher_type));
+				publisher_connections.AppendSample(publisher_labels, metrics->GetConnections(publisher_type));
+			}
+		};
+
+		if (server_metrics != nullptr)
+		{
+			append_metrics("", server_metrics);
+
+			for (const auto &[host_id, host_metrics] : server_metrics->GetHostMetricsList())
+			{
+				auto vhost_name = HistogramRegistry::EscapeLabelValue(host_metrics->GetName());
+
+				for (const auto &[app_id, app_metrics] : host_metrics->GetApplicationMetricsList())
+				{
+					auto app_name = HistogramRegistry::EscapeLabelValue(app_metrics->GetVHostAppName().GetAppName());
+
+					for (const auto &[stream_id, stream_metrics] : app_metrics->GetStreamMetricsMap())
+					{
+						auto stream_labels = ov::String::FormatString(
+							"vhost=\"%s\",app=\"%s\",stream=\"%s\"",
+							vhost_name.CStr(), app_name.CStr(),
+							HistogramRegistry::EscapeLabelValue(stream_metrics->GetName()).CStr());
+
+						append_metrics(stream_labels, stream_metrics);
+						rtx_history_bytes.AppendSample(stream_labels, stream_metrics->GetRtxHistorySize());
+					}
+				}
+			}
+		}
+
+		ov::String text;
+
+		AppendFamily(text, bytes_in);
+		AppendFamily(text, bytes_out);
+		AppendFamily(text, connections);
+		AppendFamily(text, publisher_bytes_out);
+		AppendFamily(text, publisher_connections);
+		AppendFamily(text, rtx_history_bytes);
+
+		ov::String last_name;
+
+		GaugeRegistry::GetInstance()->Iterate(
+			[&](const ov::String &name, const ov::String &help, const ov::String &labels, int64_t value) {
+				if (name != last_name)
+				{
+					text.AppendFormat("# HELP %s %s\n# TYPE %s gauge\n", name.CStr(), help.CStr(), name.CStr());
+					last_name = name;
+				}
+
+				if (labels.IsEmpty())
+				{
+					text.AppendFormat("%s %" PRId64 "\n", name.CStr(), value);
+				}
+				else
+				{
+					text.AppendFormat("%s{%s} %" PRId64 "\n", name.CStr(), labels.CStr(), value);
+				}
+			});
+
+		HistogramRegistry::GetInstance()->Iterate(
+			[&](const ov::String &name, const ov::String &help, const ov::String &labels, const ov::Histogram &histogram) {
+				if (name != last_name)
+				{
+					text.AppendFormat("# HELP %s %s\n# TYPE %s histogram\n", name.CStr(), help.CStr(), name.CStr());
+					last_name = name;
+				}
+
+				AppendHistogram(text, name, labels, histogram);
+			});
+
+		return text;
+	}
+
+	void PrometheusExporter::AppendFamily(ov::String &text, const Family &family)
+	{
+		text.AppendFormat("# HELP %s %s\n# TYPE %s %s\n", family.name, family.help, family.name, family.type);
+		text.Append(family.samples);
+	}
+
+	void PrometheusExporter::AppendHistogram(ov::String &text, const ov::String &name, const ov::String &labels, const ov::Histogram &histogram)
+	{
+		auto buckets = histogram.GetBuckets();
+		auto separator = labels.IsEmpty() ? "" : ",";
+
+		// Omit the empty buckets at the end, the "+Inf" bucket covers them
+		size_t last_index = 0;
+
+		for (size_t index = 0; index < buckets.size(); index++)
+		{
+			if (buckets[index] > 0)
+			{
+				last_index = index;
+			}
+		}
+
+		// The buckets are read one by one while being updated, so use their total as the count
+		// to keep the exposition consistent ("+Inf" bucket == count)
+		uint64_t cumulative_count = 0;
+
+		for (size_t index = 0; index < buckets.size(); index++)
+		{
+			cumulative_count += buckets[index];
+
+			if (index <= last_index)
+			{
+				text.AppendFormat("%s_bucket{%s%sle=\"%" PRIu64 "\"} %" PRIu64 "\n",
+								  name.CStr(), labels.CStr(), separator,
+								  ov::Histogram::GetBucketUpperBound(index), cumulative_count);
+			}
+		}
+
+		text.AppendFormat("%s_bucket{%s%sle=\"+Inf\"} %" PRIu64 "\n", name.CStr(), labels.CStr(), separator, cumulative_count);
+
+		if (labels.IsEmpty())
+		{
+			text.AppendFormat("%s_sum %" PRIu64 "\n%s_count %" PRIu64 "\n", name.CStr(), histogram.GetSum(), name.CStr(), cumulative_count);
+		}
+		else
+		{
+			text.AppendFormat("%s_sum{%s} %" PRIu64 "\n%s_count{%s} %" PRIu64 "\n",
+							  name.CStr(), labels.CStr(), histogram.GetSum(),
+							  name.CStr(), labels.CStr(), cumulative_count);
+		}
+	}
+}  // namespace mon
@@ -0,0 +1,59 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "gauge_registry.h"
+#include "histogram_registry.h"
+#include "server_metrics.h"
+
+// The interval of rendering the snapshot
+#define PROMETHEUS_SNAPSHOT_INTERVAL_MSEC 5000
+#define PROMETHEUS_CONTENT_TYPE "text/plain; version=0.0.4; charset=utf-8"
+
+namespace mon
+{
+	// Renders the metrics in the Prometheus text exposition format.
+	//
+	// The snapshot is rendered periodically by the timer of the Monitoring, and the API only takes the last one,
+	// so scraping costs O(size of the snapshot) regardless of how often it is scraped, and never touches the media path.
+	class PrometheusExporter
+	{
+	public:
+		void UpdateSnapshot(const std::shared_ptr<ServerMetrics> &server_metrics);
+
+		// Returns an empty string until the first snapshot is rendered
+		std::shared_ptr<const ov::String> GetSnapshot() const;
+
+	private:
+		// The lines of a metric family are grouped in the exposition
+		struct Family
+		{
+			Family(const char *name, const char *type, const char *help)
+				: name(name), type(type), help(help)
+			{
+			}
+
+			void AppendSample(const ov::String &labels, uint64_t value);
+
+			const char *name;
+			const char *type;
+			const char *help;
+			ov::String samples;
+		};
+
+		static ov::String Render(const std::shared_ptr<ServerMetrics> &server_metrics);
+		static void AppendFamily(ov::String &text, const Family &family);
+		static void AppendHistogram(ov::String &text, const ov::String &name, const ov::String &labels, const ov::Histogram &histogram);
+
+		// Only guards swapping the snapshot
+		mutable std::mutex _snapshot_mutex;
+		std::shared_ptr<const ov::String> _snapshot;
+	};
+}  // namespace mon
@@ -0,0 +1,76 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "queue_metrics.h"
+
+#include "monitoring_private.h"
+
+namespace mon
+{
+	void QueueMetrics::Collect(int64_t elapsed_ms)
+	{
+		if (elapsed_ms <= 0)
+		{
+			return;
+		}
+
+		auto input_message_count = _statistics->input_message_count.load(std::memory_order_relaxed);
+		auto output_message_count = _statistics->output_message_count.load(std::memory_order_relaxed);
+		auto waiting_time_sum_in_us = _statistics->waiting_time_sum_in_us.load(std::memory_order_relaxed);
+		auto waiting_time_sample_count = _statistics->waiting_time_sample_count.load(std::memory_order_relaxed);
+
+		_size = _statistics->size.load(std::memory_order_relaxed);
+		_peak = _statistics->peak.load(std::memory_order_relaxed);
+		_drop_count = _statistics->drop_message_count.load(std::memory_order_relaxed);
+
+		// Update statistics of message per second
+		_input_message_per_second = (input_message_count - _last_input_message_count) * 1000 / elapsed_ms;
+		_output_message_per_second = (output_message_count - _last_output_message_count) * 1000 / elapsed_ms;
+		_last_input_message_count = input_message_count;
+		_last_output_message_count = output_message_count;
+
+		// Average of the messages sampled during the interval (keep the last one if nothing is sampled)
+		auto sample_count = waiting_time_sample_count - _last_waiting_time_sample_count;
+		if (sample_count > 0)
+		{
+			_waiting_time = (waiting_time_sum_in_us - _last_waiting_time_sum_in_us) / sample_count;
+		}
+		_last_waiting_time_sum_in_us = waiting_time_sum_in_us;
+		_last_waiting_time_sample_count = waiting_time_sample_count;
+
+		int64_t adjusted_size = _size;
+		auto buffering_delay = _statistics->buffering_delay_in_ms.load(std::memory_order_relaxed);
+
+		if (buffering_delay > 0)
+		{
+			// excluding the estimated intended buffer size
+			int64_t intended_buffer_size = (double)_input_message_per_second * ((double)buffering_delay / 1000.0);
+			adjusted_size = std::max<int64_t>(adjusted_size - intended_buffer_size, 0);
+		}
+
+		if ((_threshold > 0) && (static_cast<size_t>(adjusted_size) >= _threshold))
+		{
+			_threshold_exceeded_time_ms += elapsed_ms;
+
+			// Logging
+			_last_logging_time_ms += elapsed_ms;
+			if ((_last_logging_time_ms >= _statistics->log_interval_in_ms) && (_last_logged_peak < _peak))
+			{
+				_last_logging_time_ms = 0;
+
+				logtw("[%u] %s has exceeded the threshold and increased peak. size: %zu, threshold: %zu, peak: %zu",
+					  _id, (_urn != nullptr) ? _urn->ToString().CStr() : "No Urn", _size, _threshold, _peak);
+
+				_last_logged_peak = _peak;
+			}
+		}
+		else
+		{
+			_threshold_exceeded_time_ms = 0;
+		}
+	}
+}  // namespace mon
@@ -21,7 +21,8 @@ namespace mon
 			  _input_message_per_second(0),
 			  _output_message_per_second(0),
 			  _drop_count(0),
-			  _waiting_time(0)
+			  _waiting_time(0),
+			  _statistics(info.GetStatistics())
 		{
 		}
 
@@ -51,14 +52,13 @@ namespace mon
 			_threshold = info.GetThreshold();
 		}
 
-		void UpdateMetrics(const info::ManagedQueue &info)
+		// Samples the statistics of the queue, called by ServerMetrics::CollectQueueMetrics() every elapsed_ms
+		void Collect(int64_t elapsed_ms);
+
+		// How long the queue has exceeded the threshold
+		int64_t GetThresholdExceededTimeMs() const
 		{
-			_peak					   = info.GetPeak();
-			_size					   = info.GetSize();
-			_input_message_per_second  = info.GetInputMessagePerSecond();
-			_output_message_per_second = info.GetOutputMessagePerSecond();
-			_drop_count				   = info.GetDropCount();
-			_waiting_time			   = info.GetWaitingTimeInUs();
+			return _threshold_exceeded_time_ms;
 		}
 
 		const size_t &GetPeak() const
@@ -110,5 +110,19 @@ namespace mon
 		size_t _output_message_per_second;
 		size_t _drop_count;
 		int64_t _waiting_time;
+		int64_t _threshold_exceeded_time_ms = 0;
+
+		// Shared with the queue
+		std::shared_ptr<info::ManagedQueue::Statistics> _statistics;
+
+		// The values of the last collection
+		int64_t _last_input_message_count = 0;
+		int64_t _last_output_message_count = 0;
+		int64_t _last_waiting_time_sum_in_us = 0;
+		int64_t _last_waiting_time_sample_count = 0;
+
+		// Use to print logs when the peak value of the queue is increased.
+		int64_t _last_logging_time_ms = 0;
+		size_t _last_logged_peak = 0;
 	};
 }  // namespace mon
\ No newline at end of file
@@ -149,48 +149,65 @@ namespace mon
 		{
 			queue->UpdateMetadata(queue_info);
 		}
-		queue->UpdateMetrics(queue_info);
-
-		/**
-			[Experimental] Delete lazy stream
-
-			If the size of the queue lasts beyond the limit for N seconds, it is determined to be an invalid stream. 
-			For system recovery, the problematic stream is forcibly deleted.
-
-			server.xml:
-				<Modules>
-					<Recovery>
-						<!--  
-						If the packet/frame queue is exceed for a certain period of time(millisecond, ms), it will be automatically deleted. 
-						If this value is set to zero, the stream will not be deleted. 
-						
-						-->
-						<DeleteLazyStreamTimeout>10000</DeleteLazyStreamTimeout>
-					</Recovery>
-				</Modules>
-		*/
+
+		return true;
+	}
+
+	void ServerMetrics::CollectQueueMetrics()
+	{
+		auto now = std::chrono::steady_clock::now();
+		auto elapsed_ms = (_last_queue_metrics_collected_time.has_value())
+							  ? std::chrono::duration_cast<std::chrono::milliseconds>(now - _last_queue_metrics_collected_time.value()).count()
+							  : MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC;
+		_last_queue_metrics_collected_time = now;
+
 		auto delete_lazy_stream_timeout_conf = _server_config->GetModules().GetRecovery().GetDeleteLazyStreamTimeout();
-		if (delete_lazy_stream_timeout_conf > 0)
+
+		// Iterate a copy, so that the queues can be deleted while terminating the streams
+		for (const auto &[queue_id, queue] : GetQueueMetricsList())
 		{
-			if ((queue_info.GetThresholdExceededTimeInUs() > delete_lazy_stream_timeout_conf) && (!queue_info.GetUrn()->GetStreamName().IsEmpty()))
+			queue->Collect(elapsed_ms);
+
+			/**
+				[Experimental] Delete lazy stream
+
+				If the size of the queue lasts beyond the limit for N seconds, it is determined to be an invalid stream. 
+				For system recovery, the problematic stream is forcibly deleted.
+
+				server.xml:
+					<Modules>
+						<Recovery>
+							<!--  
+							If the packet/frame queue is exceed for a certain period of time(millisecond, ms), it will be automatically deleted. 
+							If this value is set to zero, the stream will not be deleted. 
+							
+							-->
+							<DeleteLazyStreamTimeout>10000</DeleteLazyStreamTimeout>
+						</Recovery>
+					</Modules>
+			*/
+			auto urn = queue->GetUrn();
+
+			if ((delete_lazy_stream_timeout_conf > 0) && (urn != nullptr))
 			{
-				auto vhost_app	 = queue_info.GetUrn()->GetVHostAppName();
-				auto stream_name = queue_info.GetUrn()->GetStreamName();
+				if ((queue->GetThresholdExceededTimeMs() > delete_lazy_stream_timeout_conf) && (!urn->GetStreamName().IsEmpty()))
+				{
+					auto vhost_app	 = urn->GetVHostAppName();
+					auto stream_name = urn->GetStreamName();
 
-				logtc("The %s queue has been exceeded for %lld ms. stream will be forcibly deleted. VhostApp(%s), Stream(%s)",
-					  queue_info.GetUrn()->ToString().CStr(), queue_info.GetThresholdExceededTimeInUs(), vhost_app.CStr(), stream_name.CStr());
+					logtc("The %s queue has been exceeded for %lld ms. stream will be forcibly deleted. VhostApp(%s), Stream(%s)",
+						  urn->ToString().CStr(), queue->GetThresholdExceededTimeMs(), vhost_app.CStr(), stream_name.CStr());
 
-				if (vhost_app.IsValid())
-				{
-					ocst::Orchestrator::GetInstance()->TerminateStream(vhost_app, stream_name);
-				}
+					if (vhost_app.IsValid())
+					{
+						ocst::Orchestrator::GetInstance()->TerminateStream(vhost_app, stream_name);
+					}
 
-				// Clear memory fragmentation
-				malloc_trim(0);
+					// Clear memory fragmentation
+					malloc_trim(0);
+				}
 			}
 		}
-
-		return true;
 	}
 
 	std::map<uint32_t, std::shared_ptr<QueueMetrics>> ServerMetrics::GetQueueMetricsList()
@@ -6,6 +6,8 @@
 
 #include <base/ovlibrary/ovlibrary.h>
 
+#include <optional>
+
 #include "base/info/host.h"
 #include "base/info/managed_queue.h"
 #include "host_metrics.h"
@@ -44,11 +46,14 @@ namespace mon
 		bool OnQueueCreated(const info::ManagedQueue &queue_info);
 		bool OnQueueDeleted(const info::ManagedQueue &queue_info);
 		bool OnQueueUpdated(const info::ManagedQueue &queue_info, bool with_metadata = false);
+		// Samples the statistics of all queues, called every MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC
+		void CollectQueueMetrics();
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> GetQueueMetricsList();
 		std::shared_ptr<mon::QueueMetrics> GetQueueMetrics(const info::ManagedQueue &queue_info);
 
 	protected:
 		std::shared_mutex _queue_map_guard;
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> _queues;
+		std::optional<std::chrono::steady_clock::time_point> _last_queue_metrics_collected_time;
 	};
 }  // namespace mon
\ No newline at end of file
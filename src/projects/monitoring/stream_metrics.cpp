@@ -54,6 +54,23 @@ namespace mon
 		return _subscribe_time_from_origin_msec.load();
 	}
 
+	uint64_t StreamMetrics::GetGopCacheSize() const
+	{
+		uint64_t size = 0;
+
+		for (const auto &gop_cache_size : _gop_cache_size)
+		{
+			size += gop_cache_size.load();
+		}
+
+		return size;
+	}
+
+	uint64_t StreamMetrics::GetRtxHistorySize() const
+	{
+		return _rtx_history_size.load();
+	}
+
 	// Setter
 	void StreamMetrics::SetOriginConnectionTimeMSec(int64_t value)
 	{
@@ -66,6 +83,16 @@ namespace mon
 		UpdateDate();
 	}
 
+	void StreamMetrics::SetGopCacheSize(PublisherType type, uint64_t size)
+	{
+		_gop_cache_size[static_cast<int8_t>(type)] = size;
+	}
+
+	void StreamMetrics::SetRtxHistorySize(uint64_t size)
+	{
+		_rtx_history_size = size;
+	}
+
 	void StreamMetrics::IncreaseBytesIn(uint64_t value)
 	{
 		CommonMetrics::IncreaseBytesIn(value);
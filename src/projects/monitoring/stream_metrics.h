@@ -48,6 +48,14 @@ namespace mon
 		void SetOriginConnectionTimeMSec(int64_t value);
 		void SetOriginSubscribeTimeMSec(int64_t value);
 
+		// Memory used by the GOP caches of the publishers
+		uint64_t GetGopCacheSize() const;
+		void SetGopCacheSize(PublisherType type, uint64_t size);
+
+		// Memory used by the RTX histories of the WebRTC publisher
+		uint64_t GetRtxHistorySize() const;
+		void SetRtxHistorySize(uint64_t size);
+
 		// Overriding from CommonMetrics
 		void IncreaseBytesIn(uint64_t value) override;
 		void IncreaseBytesOut(PublisherType type, uint64_t value) override;
@@ -67,6 +75,9 @@ namespace mon
 		std::atomic<int64_t> _connection_time_to_origin_msec  = 0;
 		std::atomic<int64_t> _subscribe_time_from_origin_msec = 0;
 
+		std::atomic<uint64_t> _gop_cache_size[static_cast<int8_t>(PublisherType::NumberOfPublishers)] = {};
+		std::atomic<uint64_t> _rtx_history_size = 0;
+
 		// If this stream is from Provider(input stream) it has multiple output streams
 		std::vector<std::shared_ptr<StreamMetrics>> _output_stream_metrics;
 
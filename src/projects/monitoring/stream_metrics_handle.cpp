@@ -0,0 +1,31 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "stream_metrics_handle.h"
+
+#include "monitoring_private.h"
+
+namespace mon
+{
+	StreamMetricsHandle::StreamMetricsHandle(std::vector<std::shared_ptr<CommonMetrics>> metrics_list)
+		: _metrics_list(std::move(metrics_list))
+	{
+	}
+
+	void StreamMetricsHandle::IncreaseBytesOut(PublisherType type, uint64_t value)
+	{
+		if (value == 0)
+		{
+			return;
+		}
+
+		for (const auto &metrics : _metrics_list)
+		{
+			metrics->AddBytesOut(type, value);
+		}
+	}
+}  // namespace mon
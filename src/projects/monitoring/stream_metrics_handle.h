@@ -0,0 +1,26 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "common_metrics.h"
+
+namespace mon
+{
+	// The metrics that are updated when a stream sends the data (server, host, application, stream and its origin streams),
+	// resolved once so that the publishers don't have to look up the metrics maps for every packet
+	class StreamMetricsHandle
+	{
+	public:
+		StreamMetricsHandle(std::vector<std::shared_ptr<CommonMetrics>> metrics_list);
+
+		void IncreaseBytesOut(PublisherType type, uint64_t value);
+
+	private:
+		std::vector<std::shared_ptr<CommonMetrics>> _metrics_list;
+	};
+}  // namespace mon
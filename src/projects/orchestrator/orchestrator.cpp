@@ -43,9 +43,16 @@ namespace ocst
 					return ov::DelayQueueAction::Repeat;
 				},
 				10000);
-			_timer.Start();
 		}
 
+		_timer.Push(
+			[this](void *paramter) -> ov::DelayQueueAction {
+				_stream_prewarmer.Update();
+				return ov::DelayQueueAction::Repeat;
+			},
+			1000);
+		_timer.Start();
+
 		return true;
 	}
 
@@ -80,6 +87,8 @@ namespace ocst
 
 	ocst::Result Orchestrator::Release()
 	{
+		_timer.Stop();
+
 		auto vhost_list = GetVirtualHostList();
 		for (auto &vhost_item : vhost_list)
 		{
@@ -1061,6 +1070,8 @@ namespace ocst
 
 		mon::Monitoring::GetInstance()->OnHostCreated(vhost_info);
 
+		_stream_prewarmer.OnVirtualHostCreated(vhost_info);
+
 		return Result::Succeeded;
 	}
 
@@ -1108,6 +1119,8 @@ namespace ocst
 				}
 			}
 			
+			_stream_prewarmer.OnVirtualHostDeleted(vhost_info.GetName());
+
 			mon::Monitoring::GetInstance()->OnHostDeleted(vhost_info);
 			return Result::Succeeded;
 		}
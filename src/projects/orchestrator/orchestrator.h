@@ -14,6 +14,7 @@
 
 #include "virtual_host.h"
 #include "module.h"
+#include "stream_prewarmer.h"
 
 namespace ocst
 {
@@ -162,6 +163,7 @@ namespace ocst
 
 		/// Find Provider Stream from StreamInfo
 		std::shared_ptr<pvd::Stream> GetProviderStream(const std::shared_ptr<const info::Stream> &stream_info);
+		std::shared_ptr<pvd::Stream> GetProviderStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 		/// Find Publisher Stream from StreamInfo
 		std::shared_ptr<pub::Stream> GetPublisherStream(PublisherType publisher_type, const std::shared_ptr<const info::Stream> &stream_info);
 
@@ -173,6 +175,12 @@ namespace ocst
 		CommonErrorCode RegisterStreamToOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 		CommonErrorCode UnregisterStreamFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 
+		// Prewarm
+		StreamPrewarmer &GetStreamPrewarmer()
+		{
+			return _stream_prewarmer;
+		}
+
 		// Mirror Stream
 		bool CheckIfStreamExist(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 		CommonErrorCode MirrorStream(std::shared_ptr<MediaRouterStreamTap> &stream_tap, const info::VHostAppName &vhost_app_name, const ov::String &stream_name, MediaRouterInterface::MirrorPosition posision);
@@ -227,7 +235,8 @@ namespace ocst
 		std::vector<std::shared_ptr<VirtualHost>> _virtual_host_list;
 		mutable std::shared_mutex _virtual_host_mutex;
 
-		std::shared_ptr<pvd::Stream> GetProviderStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+		// Keeps streams pulled before viewers request them
+		StreamPrewarmer _stream_prewarmer;
 
 		// Module Timer : It is called periodically by the timer
 		ov::DelayQueue _timer{"Orchestrator"};
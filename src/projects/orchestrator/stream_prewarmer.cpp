@@ -0,0 +1,511 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "stream_prewarmer.h"
+
+#include <base/provider/pull_provider/stream.h>
+#include <base/provider/pull_provider/stream_props.h>
+#include <monitoring/monitoring.h>
+
+#include <cmath>
+#include <unordered_map>
+
+#include "orchestrator.h"
+#include "orchestrator_private.h"
+
+// If the prewarmer fails to pull a stream, it will not try again for this time
+#define PREWARM_PULL_RETRY_INTERVAL_MS 5000
+// Streams less popular than this are forgotten
+#define PREWARM_MIN_POPULARITY 0.01
+
+namespace ocst
+{
+	const char *StreamPrewarmer::StringFromSource(Source source)
+	{
+		switch (source)
+		{
+			case Source::None:
+				return "None";
+			case Source::Config:
+				return "Config";
+			case Source::Api:
+				return "Api";
+			case Source::Popular:
+				return "Popular";
+		}
+
+		return "Unknown";
+	}
+
+	ov::String StreamPrewarmer::MakeKey(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		return ov::String::FormatString("%s/%s", vhost_app_name.CStr(), stream_name.CStr());
+	}
+
+	StreamPrewarmer::StreamEntry &StreamPrewarmer::GetEntry(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		auto &entry = _stream_map[MakeKey(vhost_app_name, stream_name)];
+
+		if (entry.stream_name.IsEmpty())
+		{
+			entry.vhost_app_name = vhost_app_name;
+			entry.stream_name = stream_name;
+			entry.worker_key = _pull_worker_pool.IssueKey();
+		}
+
+		return entry;
+	}
+
+	void StreamPrewarmer::OnVirtualHostCreated(const info::Host &host_info)
+	{
+		auto &prewarm_config = host_info.GetOrigins().GetPrewarm();
+		VHostConfig config;
+
+		for (const auto &stream : prewarm_config.GetStreams().GetStreamList())
+		{
+			auto tokens = stream.Split("/");
+			if ((tokens.size() != 2) || tokens[0].IsEmpty() || tokens[1].IsEmpty())
+			{
+				logtw("Invalid prewarm stream: %s (It must be in the form of <app>/<stream>)", stream.CStr());
+				continue;
+			}
+
+			if ((stream.IndexOf('*') >= 0) || (stream.IndexOf('?') >= 0))
+			{
+				auto regex = ov::Regex(ov::Regex::WildCardRegex(stream));
+				auto error = regex.Compile();
+
+				if (error != nullptr)
+				{
+					logtw("Invalid prewarm stream pattern: %s (%s)", stream.CStr(), error->What());
+					continue;
+				}
+
+				config.pattern_list.push_back(regex);
+			}
+			else
+			{
+				config.stream_list.push_back(stream);
+			}
+		}
+
+		config.popular_stream_count = std::max(prewarm_config.GetPopularStreamCount(), 0);
+		config.popularity_half_life_ms = prewarm_config.GetPopularityHalfLife();
+
+		if (config.stream_list.empty() && (config.popular_stream_count == 0))
+		{
+			return;
+		}
+
+		logti("Prewarm is configured for %s: %zu stream(s), %zu pattern(s), %zu popular stream(s)",
+			  host_info.GetName().CStr(), config.stream_list.size(), config.pattern_list.size(), config.popular_stream_count);
+
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+		_config_map[host_info.GetName()] = std::move(config);
+	}
+
+	void StreamPrewarmer::OnVirtualHostDeleted(const ov::String &vhost_name)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		_config_map.erase(vhost_name);
+		_hit_count_map.erase(vhost_name);
+		_miss_count_map.erase(vhost_name);
+
+		for (auto it = _stream_map.begin(); it != _stream_map.end();)
+		{
+			if (it->second.vhost_app_name.GetVHostName() == vhost_name)
+			{
+				it = _stream_map.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	bool StreamPrewarmer::AddStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		if (vhost_app_name.IsValid() == false || stream_name.IsEmpty())
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+		GetEntry(vhost_app_name, stream_name).from_api = true;
+
+		return true;
+	}
+
+	bool StreamPrewarmer::RemoveStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		auto item = _stream_map.find(MakeKey(vhost_app_name, stream_name));
+		if ((item == _stream_map.end()) || (item->second.from_api == false))
+		{
+			return false;
+		}
+
+		// The entry is removed in Update() after the prewarm flag of the stream is cleared
+		item->second.from_api = false;
+
+		return true;
+	}
+
+	void StreamPrewarmer::OnStreamPulledOnDemand(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		_miss_count_map[vhost_app_name.GetVHostName()]++;
+
+		auto &entry = GetEntry(vhost_app_name, stream_name);
+		entry.popularity += 1.0;
+		entry.is_waiting_for_viewer = false;
+	}
+
+	std::map<ov::String, uint32_t> StreamPrewarmer::CollectViewers() const
+	{
+		std::map<ov::String, uint32_t> viewers_map;
+
+		for (const auto &[host_key, host_metrics] : mon::Monitoring::GetInstance()->GetHostMetricsList())
+		{
+			for (const auto &[app_key, app_metrics] : host_metrics->GetApplicationMetricsList())
+			{
+				for (const auto &[stream_key, stream_metrics] : app_metrics->GetStreamMetricsMap())
+				{
+					if (stream_metrics->IsInputStream() == false)
+					{
+						continue;
+					}
+
+					// Viewers are connected to the output streams of the input stream
+					uint32_t viewers = stream_metrics->GetTotalConnections();
+					for (const auto &output_stream_metrics : stream_metrics->GetLinkedOutputStreamMetrics())
+					{
+						viewers += output_stream_metrics->GetTotalConnections();
+					}
+
+					viewers_map[MakeKey(app_metrics->GetVHostAppName(), stream_metrics->GetName())] = viewers;
+				}
+			}
+		}
+
+		return viewers_map;
+	}
+
+	bool StreamPrewarmer::IsEligibleForPopularity(const VHostConfig &config, const StreamEntry &entry) const
+	{
+		if (config.pattern_list.empty())
+		{
+			return true;
+		}
+
+		auto app_stream = ov::String::FormatString("%s/%s", entry.vhost_app_name.GetAppName().CStr(), entry.stream_name.CStr());
+
+		for (const auto &regex : config.pattern_list)
+		{
+			if (regex.Matches(app_stream.CStr()).IsMatched())
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void StreamPrewarmer::Update()
+	{
+		auto viewers_map = CollectViewers();
+		auto now = std::chrono::steady_clock::now();
+
+		struct Action
+		{
+			info::VHostAppName vhost_app_name = info::VHostAppName::InvalidVHostAppName();
+			ov::String stream_name;
+			bool prewarm;
+			bool needs_pull;
+			uint64_t worker_key;
+		};
+		std::vector<Action> action_list;
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			auto elapsed_ms = (_last_update_time.time_since_epoch().count() == 0)
+								  ? 0
+								  : std::chrono::duration_cast<std::chrono::milliseconds>(now - _last_update_time).count();
+			_last_update_time = now;
+
+			// Streams in the configuration are always prewarmed
+			for (const auto &[vhost_name, config] : _config_map)
+			{
+				auto orchestrator = Orchestrator::GetInstance();
+
+				for (const auto &app_stream : config.stream_list)
+				{
+					auto tokens = app_stream.Split("/");
+					GetEntry(orchestrator->ResolveApplicationName(vhost_name, tokens[0]), tokens[1]);
+				}
+			}
+
+			// Update popularity and decide which streams should be prewarmed
+			std::unordered_map<const StreamEntry *, Source> source_map;
+			std::map<ov::String, std::vector<StreamEntry *>> candidates_map;
+
+			for (auto &[key, entry] : _stream_map)
+			{
+				auto &vhost_name = entry.vhost_app_name.GetVHostName();
+				auto config_item = _config_map.find(vhost_name);
+				const VHostConfig *config = (config_item != _config_map.end()) ? &(config_item->second) : nullptr;
+
+				auto viewers_item = viewers_map.find(key);
+				auto is_pulled = (viewers_item != viewers_map.end());
+				auto viewers = is_pulled ? viewers_item->second : 0U;
+
+				if ((config != nullptr) && (config->popularity_half_life_ms > 0))
+				{
+					entry.popularity *= std::pow(0.5, static_cast<double>(elapsed_ms) / config->popularity_half_life_ms);
+				}
+				else
+				{
+					entry.popularity = 0.0;
+				}
+				entry.popularity += viewers;
+
+				// A viewer joined the stream while it was kept pulled by the prewarmer
+				if (is_pulled && entry.is_waiting_for_viewer && (viewers > 0))
+				{
+					_hit_count_map[vhost_name]++;
+				}
+
+				entry.is_pulled = is_pulled;
+				entry.viewers = viewers;
+
+				auto source = Source::None;
+
+				if (config != nullptr)
+				{
+					auto app_stream = ov::String::FormatString("%s/%s", entry.vhost_app_name.GetAppName().CStr(), entry.stream_name.CStr());
+
+					if (std::find(config->stream_list.begin(), config->stream_list.end(), app_stream) != config->stream_list.end())
+					{
+						source = Source::Config;
+					}
+				}
+
+				if ((source == Source::None) && entry.from_api)
+				{
+					source = Source::Api;
+				}
+
+				if ((source == Source::None) && (config != nullptr) && (config->popular_stream_count > 0) &&
+					(entry.popularity >= PREWARM_MIN_POPULARITY) && IsEligibleForPopularity(*config, entry))
+				{
+					candidates_map[vhost_name].push_back(&entry);
+				}
+
+				source_map[&entry] = source;
+			}
+
+			// Pick the most popular streams of each vhost
+			for (auto &[vhost_name, candidate_list] : candidates_map)
+			{
+				auto count = std::min(candidate_list.size(), _config_map[vhost_name].popular_stream_count);
+
+				std::partial_sort(candidate_list.begin(), candidate_list.begin() + count, candidate_list.end(),
+								  [](const StreamEntry *a, const StreamEntry *b) {
+									  return a->popularity > b->popularity;
+								  });
+
+				for (size_t index = 0; index < count; index++)
+				{
+					source_map[candidate_list[index]] = Source::Popular;
+				}
+			}
+
+			for (auto it = _stream_map.begin(); it != _stream_map.end();)
+			{
+				auto &entry = it->second;
+				auto source = source_map[&entry];
+
+				if (source != Source::None)
+				{
+					auto needs_pull = (entry.is_pulled == false) && (entry.is_pull_in_flight == false) && (now >= entry.next_pull_time);
+
+					if (needs_pull)
+					{
+						entry.next_pull_time = now + std::chrono::milliseconds(PREWARM_PULL_RETRY_INTERVAL_MS);
+						entry.is_pull_in_flight = true;
+					}
+
+					if (entry.is_pulled || needs_pull)
+					{
+						action_list.push_back({entry.vhost_app_name, entry.stream_name, true, needs_pull, entry.worker_key});
+					}
+
+					entry.is_waiting_for_viewer = entry.is_pulled && (entry.viewers == 0);
+				}
+				else
+				{
+					if ((entry.source != Source::None) && entry.is_pulled)
+					{
+						// No longer prewarmed, so the stream will be deleted when it is unused
+						action_list.push_back({entry.vhost_app_name, entry.stream_name, false, false, entry.worker_key});
+					}
+
+					entry.is_waiting_for_viewer = false;
+				}
+
+				entry.source = source;
+
+				// The entry of a stream being pulled is kept until the pull is done, so it is not pulled twice
+				if ((source == Source::None) && (entry.popularity < PREWARM_MIN_POPULARITY) && (entry.is_pull_in_flight == false))
+				{
+					it = _stream_map.erase(it);
+					continue;
+				}
+
+				++it;
+			}
+		}
+
+		for (const auto &action : action_list)
+		{
+			if (action.needs_pull)
+			{
+				// Pulling a stream may take a while, so it doesn't block the timer of the Orchestrator
+				auto posted = _pull_worker_pool.Post(action.worker_key, [this, vhost_app_name = action.vhost_app_name, stream_name = action.stream_name]() {
+					Prewarm(vhost_app_name, stream_name);
+				});
+
+				if (posted == false)
+				{
+					std::lock_guard<std::mutex> lock_guard(_mutex);
+
+					auto item = _stream_map.find(MakeKey(action.vhost_app_name, action.stream_name));
+					if (item != _stream_map.end())
+					{
+						item->second.is_pull_in_flight = false;
+					}
+				}
+
+				continue;
+			}
+
+			SetPrewarm(action.vhost_app_name, action.stream_name, action.prewarm);
+		}
+	}
+
+	void StreamPrewarmer::Prewarm(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		logti("Prewarming stream: [%s/%s]", vhost_app_name.CStr(), stream_name.CStr());
+
+		if (PullStream(vhost_app_name, stream_name))
+		{
+			SetPrewarm(vhost_app_name, stream_name, true);
+		}
+		else
+		{
+			logtw("Could not prewarm stream: [%s/%s]", vhost_app_name.CStr(), stream_name.CStr());
+		}
+
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		auto item = _stream_map.find(MakeKey(vhost_app_name, stream_name));
+		if (item != _stream_map.end())
+		{
+			item->second.is_pull_in_flight = false;
+		}
+	}
+
+	bool StreamPrewarmer::PullStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		auto orchestrator = Orchestrator::GetInstance();
+
+		if (orchestrator->CheckIfStreamExist(vhost_app_name, stream_name))
+		{
+			return true;
+		}
+
+		// The host of the URL is not used to find the origin
+		auto request_from = ov::Url::Parse(ov::String::FormatString("prewarm://localhost/%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr()));
+		if (request_from == nullptr)
+		{
+			return false;
+		}
+
+		if (orchestrator->RequestPullStreamWithOriginMap(request_from, vhost_app_name, stream_name))
+		{
+			return true;
+		}
+
+		auto origin_url = orchestrator->GetOriginUrlFromOriginMapStore(vhost_app_name, stream_name);
+		if (origin_url == nullptr)
+		{
+			return false;
+		}
+
+		auto properties = std::make_shared<pvd::PullStreamProperties>();
+		properties->EnableFromOriginMapStore(true);
+		if (origin_url->Scheme().UpperCaseString() == "OVT")
+		{
+			properties->EnableRelay(true);
+		}
+
+		return orchestrator->RequestPullStreamWithUrls(request_from, vhost_app_name, stream_name, {origin_url->ToUrlString()}, 0, properties);
+	}
+
+	bool StreamPrewarmer::SetPrewarm(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, bool prewarm)
+	{
+		auto stream = std::dynamic_pointer_cast<pvd::PullStream>(Orchestrator::GetInstance()->GetProviderStream(vhost_app_name, stream_name));
+		if (stream == nullptr)
+		{
+			return false;
+		}
+
+		auto properties = stream->GetProperties();
+		if (properties == nullptr)
+		{
+			return false;
+		}
+
+		if (properties->IsPrewarm() != prewarm)
+		{
+			logtd("Prewarm of the stream [%s/%s] is %s", vhost_app_name.CStr(), stream_name.CStr(), prewarm ? "enabled" : "disabled");
+			properties->EnablePrewarm(prewarm);
+		}
+
+		return true;
+	}
+
+	StreamPrewarmer::Status StreamPrewarmer::GetStatus(const ov::String &vhost_name) const
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		Status status;
+
+		for (const auto &[key, entry] : _stream_map)
+		{
+			if ((entry.vhost_app_name.GetVHostName() != vhost_name) || (entry.source == Source::None))
+			{
+				continue;
+			}
+
+			status.stream_list.push_back({entry.vhost_app_name, entry.stream_name, entry.source, entry.is_pulled, entry.viewers, entry.popularity});
+		}
+
+		auto hit_item = _hit_count_map.find(vhost_name);
+		status.hit_count = (hit_item != _hit_count_map.end()) ? hit_item->second : 0;
+
+		auto miss_item = _miss_count_map.find(vhost_name);
+		status.miss_count = (miss_item != _miss_count_map.end()) ? miss_item->second : 0;
+
+		return status;
+	}
+}  // namespace ocst
@@ -0,0 +1,140 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/host.h>
+#include <base/info/vhost_app_name.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/regex.h>
+
+#include <map>
+#include <mutex>
+
+// The number of threads that pull the streams to prewarm
+#define PREWARM_PULL_WORKER_COUNT 2
+
+namespace ocst
+{
+	// Keeps streams pulled from the origin before any viewer requests them, so that the first viewer
+	// of a stream joins an already running (GOP-buffered) stream instead of waiting for the origin.
+	//
+	// Streams to prewarm are decided by:
+	//   1) <Origins><Prewarm><Streams><Stream> entries without wildcards
+	//   2) Streams added via API (startPrewarm)
+	//   3) The N most popular streams (<PopularStreamCount>) that match the wildcard entries
+	class StreamPrewarmer
+	{
+	public:
+		enum class Source : uint8_t
+		{
+			None,
+			Config,
+			Api,
+			Popular
+		};
+
+		struct StreamStatus
+		{
+			info::VHostAppName vhost_app_name = info::VHostAppName::InvalidVHostAppName();
+			ov::String stream_name;
+			Source source = Source::None;
+			bool is_pulled = false;
+			uint32_t viewers = 0;
+			double popularity = 0.0;
+		};
+
+		struct Status
+		{
+			std::vector<StreamStatus> stream_list;
+
+			// A viewer joined a stream that was already pulled by the prewarmer
+			uint64_t hit_count = 0;
+			// A viewer had to wait for the stream to be pulled on demand
+			uint64_t miss_count = 0;
+		};
+
+		static const char *StringFromSource(Source source);
+
+		void OnVirtualHostCreated(const info::Host &host_info);
+		void OnVirtualHostDeleted(const ov::String &vhost_name);
+
+		bool AddStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+		bool RemoveStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+
+		// Called when a publisher has to pull a stream because a viewer requested it
+		void OnStreamPulledOnDemand(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+
+		// Called periodically by the Orchestrator's timer
+		void Update();
+
+		Status GetStatus(const ov::String &vhost_name) const;
+
+	private:
+		struct VHostConfig
+		{
+			// <app>/<stream>
+			std::vector<ov::String> stream_list;
+			std::vector<ov::Regex> pattern_list;
+			size_t popular_stream_count = 0;
+			int64_t popularity_half_life_ms = 0;
+		};
+
+		struct StreamEntry
+		{
+			info::VHostAppName vhost_app_name = info::VHostAppName::InvalidVHostAppName();
+			ov::String stream_name;
+
+			// Decayed viewer count
+			double popularity = 0.0;
+			uint32_t viewers = 0;
+
+			bool from_api = false;
+			Source source = Source::None;
+			bool is_pulled = false;
+			// The stream was kept pulled by the prewarmer and had no viewers at the last update
+			bool is_waiting_for_viewer = false;
+
+			std::chrono::steady_clock::time_point next_pull_time;
+			// The stream is being pulled by the worker pool, so it is not requested again
+			bool is_pull_in_flight = false;
+			// The key of the entry in the worker pool
+			uint64_t worker_key = 0;
+		};
+
+		static ov::String MakeKey(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+
+		StreamEntry &GetEntry(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+
+		// key: <vhost app name>/<stream name>, value: the number of viewers
+		std::map<ov::String, uint32_t> CollectViewers() const;
+		bool IsEligibleForPopularity(const VHostConfig &config, const StreamEntry &entry) const;
+
+		// Runs in the worker pool
+		void Prewarm(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+		bool PullStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+		bool SetPrewarm(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, bool prewarm);
+
+		mutable std::mutex _mutex;
+
+		// key: vhost name
+		std::map<ov::String, VHostConfig> _config_map;
+		// key: MakeKey()
+		std::map<ov::String, StreamEntry> _stream_map;
+
+		// key: vhost name
+		std::map<ov::String, uint64_t> _hit_count_map;
+		std::map<ov::String, uint64_t> _miss_count_map;
+
+		std::chrono::steady_clock::time_point _last_update_time;
+
+		// Pulling a stream may take up to the connection timeout of the origin, so the streams are pulled
+		// in these threads instead of the timer of the Orchestrator.
+		// It is declared last, so the threads are stopped before the other members are destroyed.
+		ov::ShardedWorkerPool _pull_worker_pool{"Prewarm", PREWARM_PULL_WORKER_COUNT, false};
+	};
+}  // namespace ocst
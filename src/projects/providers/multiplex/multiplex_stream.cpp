@@ -14,6 +14,14 @@
 
 namespace pvd
 {
+    // The tasks of a channel are sharded by its key, so they are never run concurrently
+    static ov::ShardedWorkerPool &GetMultiplexWorkerPool()
+    {
+        static ov::ShardedWorkerPool worker_pool("Multiplex", kMultiplexWorkerCount, false);
+
+        return worker_pool;
+    }
+
     // Implementation of MultiplexStream
     std::shared_ptr<MultiplexStream> MultiplexStream::Create(const std::shared_ptr<Application> &application, const info::Stream &stream_info, const std::shared_ptr<MultiplexProfile> &multiplex_profile)
     {
@@ -33,30 +41,35 @@ namespace pvd
 
     bool MultiplexStream::Start()
     {
-        // Create Worker
-        _worker_thread_running = true;
-        _worker_thread = std::thread(&MultiplexStream::WorkerThread, this);
-        pthread_setname_np(_worker_thread.native_handle(), "Multiplex");
+        _weak_this = GetSharedPtrAs<MultiplexStream>();
+        _worker_key = GetMultiplexWorkerPool().IssueKey();
+        _running = true;
+
+        GetMultiplexWorkerPool().Post(_worker_key, [weak_this = _weak_this]() {
+            if (auto stream = weak_this.lock())
+            {
+                stream->Pull();
+            }
+        });
 
         return Stream::Start();
     }
 
     bool MultiplexStream::Stop()
     {
-        ReleaseSourceStreams();
-
-        if (_worker_thread_running == false)
+        if (_running.exchange(false) == false)
         {
+            ReleaseSourceStreams();
             return true;
         }
 
-        _worker_thread_running = false;
-
-        if (_worker_thread.joinable())
         {
-            _worker_thread.join();
+            // Waits for the task running now, and the tasks posted later do nothing
+            std::lock_guard lock_guard(_task_mutex);
         }
 
+        ReleaseSourceStreams();
+
         return Stream::Stop();
     }
 
@@ -100,52 +113,97 @@ namespace pvd
         return _multiplex_profile;
     }
 
-    void MultiplexStream::WorkerThread()
+    void MultiplexStream::Pull()
     {
-		ov::logger::ThreadHelper thread_helper;
+        std::lock_guard lock_guard(_task_mutex);
+
+        if (_running == false)
+        {
+            return;
+        }
+
+        _mux_state = MuxState::Pulling;
+        if (PullSourceStreams() == false)
+        {
+            // retry
+            GetMultiplexWorkerPool().PostDelayed(_worker_key, [weak_this = _weak_this]() {
+                if (auto stream = weak_this.lock())
+                {
+                    stream->Pull();
+                }
+            }, std::chrono::milliseconds(kMultiplexPullRetryIntervalMs));
+            return;
+        }
+
+        _mux_state = MuxState::Playing;
 
-        while (_worker_thread_running)
+        // The packets pushed while pulling
+        ScheduleDrain();
+    }
+
+    void MultiplexStream::ScheduleDrain()
+    {
+        if (_drain_scheduled.exchange(true) == true)
         {
-            _mux_state = MuxState::Pulling;
-            if (PullSourceStreams() == false)
+            // Not drained yet
+            return;
+        }
+
+        GetMultiplexWorkerPool().Post(_worker_key, [weak_this = _weak_this]() {
+            if (auto stream = weak_this.lock())
             {
-                // sleep and retry
-                std::this_thread::sleep_for(std::chrono::seconds(1));
-                continue;
+                stream->Drain();
             }
+        });
+    }
+
+    void MultiplexStream::Drain()
+    {
+        std::lock_guard lock_guard(_task_mutex);
 
-            break;
+        // The packets pushed from now on schedule another drain
+        _drain_scheduled = false;
+
+        if ((_running == false) || (_mux_state != MuxState::Playing))
+        {
+            return;
         }
 
-        while (_worker_thread_running)
+        auto source_streams = _multiplex_profile->GetSourceStreams();
+        int packet_count = 0;
+        bool popped = true;
+
+        // Takes a packet from each stream in turn, as the polling thread did
+        while (popped && (packet_count < kMultiplexMaxPacketsPerDrain))
         {
-            _mux_state = MuxState::Playing;
-            bool break_loop = false;
-            // Get Streams and Push
-            auto source_streams = _multiplex_profile->GetSourceStreams();
+            popped = false;
+
             for (auto &source_stream : source_streams)
             {
                 auto stream_tap = source_stream->GetStreamTap();
                 if (stream_tap == nullptr || stream_tap->GetState() != MediaRouterStreamTap::State::Tapped)
                 {
                     logte("Multiplex Channel : %s/%s: Stream [%s] is untapped", GetApplicationName(), GetName().CStr(), source_stream->GetUrlStr().CStr());
+                    _mux_state = MuxState::Stopped;
                     Terminate();
-                    break_loop = true;
-                    break;
+                    return;
                 }
 
-                auto media_packet = stream_tap->Pop(100);
+                auto media_packet = stream_tap->Pop(0);
                 if (media_packet == nullptr)
                 {
                     continue;
                 }
 
+                popped = true;
+                packet_count++;
+
 				if (IsPublished() == false)
 				{
 					if (Publish() == false)
 					{
-						break_loop = true;
-						break;
+						_mux_state = MuxState::Stopped;
+						return;
 					}
 				}
 
@@ -160,14 +218,13 @@ namespace pvd
 
                 SendFrame(media_packet);
             }
-
-            if (break_loop)
-            {
-                break;
-            }
         }
 
-        logti("Multiplex Channel : %s/%s: Worker thread stopped", GetApplicationName(), GetName().CStr());
+        if (packet_count >= kMultiplexMaxPacketsPerDrain)
+        {
+            // Let the other channels of the worker run in between
+            ScheduleDrain();
+        }
     }
 
     uint64_t MultiplexStream::MakeSourceTrackIdUnique(uint32_t tap_id, uint32_t track_id) const
@@ -198,6 +255,10 @@ namespace pvd
             }
 
 			stream_tap->SetNeedPastData(true);
+			// Called in the thread of MediaRouter, and cleared (waiting for the call in progress) in ReleaseSourceStreams()
+			stream_tap->SetReadyCallback([this]() {
+				ScheduleDrain();
+			});
 			stream_tap->Start();
 
             if (stream_tap->GetState() != MediaRouterStreamTap::State::Tapped)
@@ -295,6 +356,8 @@ namespace pvd
                 continue;
             }
 
+            stream_tap->SetReadyCallback(nullptr);
+
             if (stream_tap->GetState() != MediaRouterStreamTap::State::Tapped)
             {
                 continue;
@@ -17,6 +17,14 @@
 
 namespace pvd
 {
+    // The maximum number of packets forwarded at once, before yielding to the other channels of the worker
+    constexpr int kMultiplexMaxPacketsPerDrain = 256;
+    constexpr int kMultiplexPullRetryIntervalMs = 1000;
+    // The number of threads that forward the packets of the multiplex channels
+    constexpr int kMultiplexWorkerCount = 4;
+
+    // The channels are driven by a worker pool shared by them: the taps of the source streams notify
+    // when a packet is pushed, and the packets are forwarded in a task of the pool.
     class MultiplexStream : public Stream
     {
     public:
@@ -44,7 +52,11 @@ namespace pvd
         ov::String GetPullingStateMsg() const;
 
     private:
-        void WorkerThread();
+        // Posted until the source streams are pulled
+        void Pull();
+        // Posted when a packet is pushed to a tap
+        void Drain();
+        void ScheduleDrain();
 
         bool PullSourceStreams();
         bool ReleaseSourceStreams();
@@ -59,8 +71,12 @@ namespace pvd
 
         std::map<uint64_t, uint32_t> _source_track_id_to_new_id_map;
 
-        std::thread _worker_thread;
-        bool _worker_thread_running = false;
+        uint64_t _worker_key = 0;
+        std::weak_ptr<MultiplexStream> _weak_this;
+        std::atomic<bool> _running{false};
+        std::atomic<bool> _drain_scheduled{false};
+        // Held while a task is running, so Stop() can wait for it
+        std::mutex _task_mutex;
 
         MuxState _mux_state = MuxState::None;
         ov::String _pulling_state_msg;
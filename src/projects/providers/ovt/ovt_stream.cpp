@@ -509,6 +509,8 @@ namespace pvd
 		root["id"] = _last_request_id;
 		root["application"] = "play";
 		root["target"] = _curr_url->Source().CStr();
+		// The depacketizer accepts payloads up to the limit of the Payload Length field
+		root["maxPayloadSize"] = OVT_MAX_PAYLOAD_SIZE_LIMIT;
 
 		auto message = ov::Json::Stringify(root).ToData(false);
 
@@ -578,6 +580,11 @@ namespace pvd
 			return false;
 		}
 
+		// Origin that doesn't support "maxPayloadSize" doesn't respond it, and uses OVT_DEFAULT_MAX_PAYLOAD_SIZE
+		Json::Value &json_max_payload_size = object.GetJsonValue()["contents"]["maxPayloadSize"];
+		logtd("%s/%s(%u) - Negotiated max payload size : %u", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(),
+			  json_max_payload_size.isUInt() ? json_max_payload_size.asUInt() : OVT_DEFAULT_MAX_PAYLOAD_SIZE);
+
 		SetState(State::PLAYING);
 		return true;
 	}
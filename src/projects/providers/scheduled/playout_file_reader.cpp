@@ -0,0 +1,221 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "playout_file_reader.h"
+
+#include "playout_scheduler.h"
+#include "scheduled_provider_private.h"
+
+namespace pvd
+{
+	PlayoutFileReader::PlayoutFileReader(uint64_t key, const std::shared_ptr<AVFormatContext> &context)
+		: _key(key),
+		  _context(context)
+	{
+	}
+
+	void PlayoutFileReader::SetStartPosition(int stream_index, int64_t start_dts_ms)
+	{
+		_start_stream_index = stream_index;
+		_start_dts_ms = start_dts_ms;
+	}
+
+	void PlayoutFileReader::SetKeyframeIndex(int stream_index, const std::shared_ptr<PlayoutKeyframeIndex> &keyframe_index)
+	{
+		_keyframe_stream_index = stream_index;
+		_keyframe_index = keyframe_index;
+		_last_keyframe_dts.reset();
+	}
+
+	void PlayoutFileReader::Start()
+	{
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			if (IsReadNeeded() == false)
+			{
+				return;
+			}
+
+			_reading = true;
+		}
+
+		PostRead();
+	}
+
+	void PlayoutFileReader::Stop()
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		_stop = true;
+		_packet_queue.clear();
+	}
+
+	std::shared_ptr<AVPacket> PlayoutFileReader::Pop()
+	{
+		std::shared_ptr<AVPacket> packet;
+		bool read_needed = false;
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			if (_packet_queue.empty())
+			{
+				_waiting = (_state == State::Reading);
+			}
+			else
+			{
+				packet = std::move(_packet_queue.front());
+				_packet_queue.pop_front();
+
+				if (packet->dts != AV_NOPTS_VALUE)
+				{
+					_last_popped_dts_ms = ::av_rescale_q(packet->dts, _context->streams[packet->stream_index]->time_base, {1, 1000});
+				}
+			}
+
+			// Reads more before the buffer runs out
+			if (IsReadNeeded() && (_packet_queue.empty() || ((_last_read_dts_ms - _last_popped_dts_ms) < (PLAYOUT_READ_AHEAD_MS / 2))))
+			{
+				_reading = true;
+				read_needed = true;
+			}
+		}
+
+		if (read_needed)
+		{
+			PostRead();
+		}
+
+		return packet;
+	}
+
+	PlayoutFileReader::State PlayoutFileReader::GetState(int *error) const
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		if (error != nullptr)
+		{
+			*error = _error;
+		}
+
+		// The packets read before the end should be played first
+		return _packet_queue.empty() ? _state : State::Reading;
+	}
+
+	bool PlayoutFileReader::IsReadNeeded() const
+	{
+		return (_reading == false) && (_stop == false) && (_state == State::Reading);
+	}
+
+	void PlayoutFileReader::PostRead()
+	{
+		auto self = shared_from_this();
+
+		PlayoutScheduler::GetInstance()->PostRead(_key, [self]() {
+			self->ReadAhead();
+		});
+	}
+
+	void PlayoutFileReader::ReadAhead()
+	{
+		while (true)
+		{
+			{
+				std::lock_guard lock_guard(_mutex);
+
+				if (_stop ||
+					(_packet_queue.size() >= PLAYOUT_READ_AHEAD_MAX_PACKETS) ||
+					((_packet_queue.empty() == false) && ((_last_read_dts_ms - _last_popped_dts_ms) >= PLAYOUT_READ_AHEAD_MS)))
+				{
+					break;
+				}
+			}
+
+			std::shared_ptr<AVPacket> packet(::av_packet_alloc(), [](AVPacket *packet) {
+				::av_packet_free(&packet);
+			});
+
+			int32_t ret = ::av_read_frame(_context.get(), packet.get());
+			if (ret == AVERROR(EAGAIN))
+			{
+				logtw("Failed to read frame. Error (%d, %s)", ret, "EAGAIN");
+				continue;
+			}
+
+			if ((ret >= 0) && (_keyframe_index != nullptr) && (packet->stream_index == _keyframe_stream_index) && (packet->flags & AV_PKT_FLAG_KEY))
+			{
+				if (packet->dts != AV_NOPTS_VALUE)
+				{
+					_keyframe_index->Add(packet->dts, packet->pos, _last_keyframe_dts);
+					_last_keyframe_dts = packet->dts;
+				}
+				else
+				{
+					// A keyframe that can't be indexed, so the next one doesn't follow the last one
+					_last_keyframe_dts.reset();
+				}
+			}
+
+			if ((ret >= 0) && (packet->dts != AV_NOPTS_VALUE))
+			{
+
+				if ((_start_stream_index >= 0) && (packet->stream_index != _start_stream_index) &&
+					(::av_rescale_q(packet->dts, _context->streams[packet->stream_index]->time_base, {1, 1000}) < _start_dts_ms))
+				{
+					// Before the keyframe that the playback starts from
+					continue;
+				}
+			}
+
+			bool wakeup = false;
+			bool ended = false;
+
+			{
+				std::lock_guard lock_guard(_mutex);
+
+				if ((ret == AVERROR_EOF) || ::avio_feof(_context->pb))
+				{
+					_state = State::EndOfFile;
+				}
+				else if (ret < 0)
+				{
+					_state = State::Error;
+					_error = ret;
+				}
+				else
+				{
+					if (packet->dts != AV_NOPTS_VALUE)
+					{
+						_last_read_dts_ms = ::av_rescale_q(packet->dts, _context->streams[packet->stream_index]->time_base, {1, 1000});
+					}
+
+					_packet_queue.push_back(std::move(packet));
+				}
+
+				wakeup = _waiting;
+				_waiting = false;
+
+				ended = (_state != State::Reading);
+			}
+
+			if (wakeup)
+			{
+				// The task is waiting for this packet (or the end), so it doesn't wait for the rest to be read
+				PlayoutScheduler::GetInstance()->Wakeup(_key);
+			}
+
+			if (ended)
+			{
+				break;
+			}
+		}
+
+		std::lock_guard lock_guard(_mutex);
+		_reading = false;
+	}
+}  // namespace pvd
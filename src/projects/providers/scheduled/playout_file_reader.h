@@ -0,0 +1,86 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/ffmpeg/compat.h>
+
+#include <deque>
+
+#include "playout_keyframe_index.h"
+
+// The duration of the packets read ahead of the playout
+#define PLAYOUT_READ_AHEAD_MS 1000
+// The reading stops when this many packets are buffered, even if PLAYOUT_READ_AHEAD_MS is not reached (e.g. broken timestamps)
+#define PLAYOUT_READ_AHEAD_MAX_PACKETS 2048
+
+namespace pvd
+{
+	// Reads the packets of a file ahead of the playout in the readers of the PlayoutScheduler,
+	// so the playout worker only pops the packets that are already read.
+	class PlayoutFileReader : public std::enable_shared_from_this<PlayoutFileReader>
+	{
+	public:
+		enum class State : uint8_t
+		{
+			Reading,
+			EndOfFile,
+			Error
+		};
+
+		// key: The key of the PlayoutTask to wake up when a packet is read after Pop() returned nullptr
+		PlayoutFileReader(uint64_t key, const std::shared_ptr<AVFormatContext> &context);
+
+		// Called before Start(), after seeking to a keyframe of the stream.
+		// Drops the packets of the other streams before the keyframe, so all the streams start at the same position.
+		void SetStartPosition(int stream_index, int64_t start_dts_ms);
+		// Called before Start(). Adds the keyframes of the stream to the index while reading.
+		void SetKeyframeIndex(int stream_index, const std::shared_ptr<PlayoutKeyframeIndex> &keyframe_index);
+
+		void Start();
+		// The packet being read is dropped, and the context is released when it is read
+		void Stop();
+
+		// Returns nullptr if no packet is buffered. Then GetState() tells whether it is the end of the file.
+		std::shared_ptr<AVPacket> Pop();
+
+		// error: The error of av_read_frame() if the state is Error
+		State GetState(int *error = nullptr) const;
+
+	private:
+		// Must be called with _mutex locked
+		bool IsReadNeeded() const;
+		void PostRead();
+		void ReadAhead();
+
+		const uint64_t _key;
+		const std::shared_ptr<AVFormatContext> _context;
+
+		int _start_stream_index = -1;
+		int64_t _start_dts_ms = 0;
+
+		int _keyframe_stream_index = -1;
+		std::shared_ptr<PlayoutKeyframeIndex> _keyframe_index;
+		// The last keyframe read, so the keyframes read one after another are known to have no gap between them
+		std::optional<int64_t> _last_keyframe_dts;
+
+		mutable std::mutex _mutex;
+
+		std::deque<std::shared_ptr<AVPacket>> _packet_queue;
+		int64_t _last_read_dts_ms = 0;
+		int64_t _last_popped_dts_ms = 0;
+
+		bool _reading = false;
+		bool _stop = false;
+		// Pop() returned nullptr, so the task should be woken up when a packet is read
+		bool _waiting = false;
+
+		State _state = State::Reading;
+		int _error = 0;
+	};
+}  // namespace pvd
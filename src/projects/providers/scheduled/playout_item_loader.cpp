@@ -0,0 +1,225 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "playout_item_loader.h"
+
+#include "playout_scheduler.h"
+#include "scheduled_provider_private.h"
+
+namespace pvd
+{
+	PlayoutItemLoader::PlayoutItemLoader(uint64_t key, const std::shared_ptr<Schedule::Item> &item)
+		: _key(key),
+		  _item(item),
+		  _start_time_ms(item->_start_time_ms)
+	{
+	}
+
+	void PlayoutItemLoader::Start()
+	{
+		auto self = shared_from_this();
+
+		PlayoutScheduler::GetInstance()->PostLoad(_key, [self]() {
+			self->Load();
+		});
+	}
+
+	void PlayoutItemLoader::Stop()
+	{
+		std::shared_ptr<PlayoutFileReader> reader;
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			_stop = true;
+
+			reader = std::move(_reader);
+			_context.reset();
+		}
+
+		if (reader != nullptr)
+		{
+			reader->Stop();
+		}
+	}
+
+	PlayoutItemLoader::State PlayoutItemLoader::GetState()
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		_waiting = (_state == State::Loading);
+
+		return _state;
+	}
+
+	const std::shared_ptr<Schedule::Item> &PlayoutItemLoader::GetItem() const
+	{
+		return _item;
+	}
+
+	std::shared_ptr<AVFormatContext> PlayoutItemLoader::GetContext() const
+	{
+		std::lock_guard lock_guard(_mutex);
+		return _context;
+	}
+
+	std::shared_ptr<PlayoutFileReader> PlayoutItemLoader::GetReader() const
+	{
+		std::lock_guard lock_guard(_mutex);
+		return _reader;
+	}
+
+	void PlayoutItemLoader::Load()
+	{
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			if (_stop)
+			{
+				return;
+			}
+		}
+
+		ov::StopWatch stop_watch;
+		stop_watch.Start();
+
+		auto context = _item->OpenContext();
+		std::shared_ptr<PlayoutFileReader> reader;
+
+		if (context != nullptr)
+		{
+			reader = std::make_shared<PlayoutFileReader>(_key, context);
+
+			Seek(context, reader);
+
+			// The first packets are ready before the item is played
+			reader->Start();
+
+			logtd("Item loaded: %s (start: %lld ms, %lld ms)", _item->_file_path.CStr(), _start_time_ms, stop_watch.Elapsed());
+		}
+
+		bool wakeup = false;
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			if (_stop == false)
+			{
+				_context = context;
+				_reader = reader;
+				reader = nullptr;
+
+				_state = (context != nullptr) ? State::Loaded : State::Failed;
+
+				wakeup = _waiting;
+				_waiting = false;
+			}
+		}
+
+		if (reader != nullptr)
+		{
+			// Stopped while loading
+			reader->Stop();
+		}
+
+		if (wakeup)
+		{
+			PlayoutScheduler::GetInstance()->Wakeup(_key);
+		}
+	}
+
+	void PlayoutItemLoader::Seek(const std::shared_ptr<AVFormatContext> &context, const std::shared_ptr<PlayoutFileReader> &reader)
+	{
+		if (_start_time_ms <= 0)
+		{
+			// A new context starts from the beginning
+			return;
+		}
+
+		AVStream *video_stream = nullptr;
+		for (uint32_t index = 0; index < context->nb_streams; index++)
+		{
+			if (context->streams[index]->codecpar->codec_type == AVMEDIA_TYPE_VIDEO)
+			{
+				video_stream = context->streams[index];
+				break;
+			}
+		}
+
+		auto keyframe_index = (video_stream != nullptr) ? PlayoutKeyframeIndex::Get(_item->_file_path) : nullptr;
+
+		if (keyframe_index != nullptr)
+		{
+			bool is_mpegts = (std::strncmp(context->iformat->name, "mpegts", 6) == 0);
+
+			// The index of the demuxer has all the keyframes
+			std::optional<int64_t> previous_timestamp;
+
+			int entry_count = ::avformat_index_get_entries_count(video_stream);
+			for (int index = 0; index < entry_count; index++)
+			{
+				auto entry = ::avformat_index_get_entry(video_stream, index);
+				if ((entry != nullptr) && (entry->flags & AVINDEX_KEYFRAME))
+				{
+					keyframe_index->Add(entry->timestamp, entry->pos, previous_timestamp);
+					previous_timestamp = entry->timestamp;
+				}
+			}
+
+			if (is_mpegts && (entry_count == 0))
+			{
+				// Learns the keyframes of this playback for the next one, also after seeking with the index,
+				// so the gaps of the index are filled
+				reader->SetKeyframeIndex(video_stream->index, keyframe_index);
+			}
+
+			int64_t target_ts = ::av_rescale_q(_start_time_ms, {1, 1000}, video_stream->time_base);
+			if (video_stream->start_time != AV_NOPTS_VALUE)
+			{
+				target_ts += video_stream->start_time;
+			}
+
+			auto keyframe = keyframe_index->Find(target_ts);
+			int ret = -1;
+
+			if (keyframe.has_value())
+			{
+				if (entry_count > 0)
+				{
+					// The demuxer seeks to the keyframe with its own index
+					ret = ::avformat_seek_file(context.get(), video_stream->index, keyframe->timestamp, keyframe->timestamp, keyframe->timestamp, 0);
+				}
+				else if (is_mpegts && (keyframe->position >= 0))
+				{
+					// A TS packet can be read from anywhere, so the keyframe found in the previous playback can be read directly
+					ret = ::avformat_seek_file(context.get(), video_stream->index, keyframe->position, keyframe->position, keyframe->position, AVSEEK_FLAG_BYTE);
+				}
+			}
+
+			if (ret >= 0)
+			{
+				reader->SetStartPosition(video_stream->index, ::av_rescale_q(keyframe->timestamp, video_stream->time_base, {1, 1000}));
+
+				logtd("Seeked to the keyframe %lld (position: %lld) for the start position %lld ms: %s",
+					  keyframe->timestamp, keyframe->position, _start_time_ms, _item->_file_path.CStr());
+
+				return;
+			}
+		}
+
+		// if stream_index is -1, in AV_TIME_BASE units
+		int64_t seek_target = _start_time_ms * 1000;
+		int64_t seek_min = 0;
+		int64_t seek_max = (context->duration > 0) ? context->duration : std::numeric_limits<int64_t>::max();
+
+		int ret = ::avformat_seek_file(context.get(), -1, seek_min, seek_target, seek_max, 0);
+		if (ret < 0)
+		{
+			logte("Failed to seek to start position %lld, err:%d: %s", _start_time_ms, ret, _item->_file_path.CStr());
+		}
+	}
+}  // namespace pvd
@@ -0,0 +1,65 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/ffmpeg/compat.h>
+
+#include "playout_file_reader.h"
+#include "schedule.h"
+
+namespace pvd
+{
+	// Opens, probes and seeks a file item in the loaders of the PlayoutScheduler, and starts reading it ahead,
+	// so the playout worker can switch to the item without waiting for the file.
+	class PlayoutItemLoader : public std::enable_shared_from_this<PlayoutItemLoader>
+	{
+	public:
+		enum class State : uint8_t
+		{
+			Loading,
+			Loaded,
+			Failed
+		};
+
+		// key: The key of the PlayoutTask to wake up when the item is loaded after GetState() returned Loading
+		PlayoutItemLoader(uint64_t key, const std::shared_ptr<Schedule::Item> &item);
+
+		void Start();
+		// The item being loaded is released when it is loaded
+		void Stop();
+
+		State GetState();
+
+		const std::shared_ptr<Schedule::Item> &GetItem() const;
+		// Valid if the state is Loaded
+		std::shared_ptr<AVFormatContext> GetContext() const;
+		std::shared_ptr<PlayoutFileReader> GetReader() const;
+
+	private:
+		void Load();
+		// Seeks to the start position of the item, and sets up the reader accordingly
+		void Seek(const std::shared_ptr<AVFormatContext> &context, const std::shared_ptr<PlayoutFileReader> &reader);
+
+		const uint64_t _key;
+		const std::shared_ptr<Schedule::Item> _item;
+		// Copied, since the item may be modified in the playout worker while loading
+		const int64_t _start_time_ms;
+
+		mutable std::mutex _mutex;
+
+		std::shared_ptr<AVFormatContext> _context;
+		std::shared_ptr<PlayoutFileReader> _reader;
+
+		bool _stop = false;
+		// GetState() returned Loading, so the task should be woken up when it is loaded
+		bool _waiting = false;
+
+		State _state = State::Loading;
+	};
+}  // namespace pvd
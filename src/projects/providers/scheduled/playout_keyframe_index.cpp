@@ -0,0 +1,135 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "playout_keyframe_index.h"
+
+#include <sys/stat.h>
+
+#include "scheduled_provider_private.h"
+
+namespace pvd
+{
+	std::mutex PlayoutKeyframeIndex::_index_map_mutex;
+	std::map<ov::String, PlayoutKeyframeIndex::Entry> PlayoutKeyframeIndex::_index_map;
+	uint64_t PlayoutKeyframeIndex::_last_used = 0;
+
+	std::shared_ptr<PlayoutKeyframeIndex> PlayoutKeyframeIndex::Get(const ov::String &file_path)
+	{
+		struct stat file_stat;
+		if (::stat(file_path.CStr(), &file_stat) != 0)
+		{
+			return nullptr;
+		}
+
+		std::lock_guard lock_guard(_index_map_mutex);
+
+		auto &entry = _index_map[file_path];
+
+		if ((entry.index == nullptr) ||
+			(entry.modified_time != file_stat.st_mtime) ||
+			(entry.size != file_stat.st_size))
+		{
+			// New or modified file
+			entry.modified_time = file_stat.st_mtime;
+			entry.size = file_stat.st_size;
+			entry.index = std::make_shared<PlayoutKeyframeIndex>();
+		}
+
+		entry.last_used = ++_last_used;
+		auto index = entry.index;
+
+		if (_index_map.size() > PLAYOUT_KEYFRAME_INDEX_MAX_FILES)
+		{
+			// The playbacks of the evicted file keep using its index until they end
+			auto least_recently_used = _index_map.begin();
+
+			for (auto item = _index_map.begin(); item != _index_map.end(); ++item)
+			{
+				if (item->second.last_used < least_recently_used->second.last_used)
+				{
+					least_recently_used = item;
+				}
+			}
+
+			_index_map.erase(least_recently_used);
+		}
+
+		return index;
+	}
+
+	void PlayoutKeyframeIndex::Add(int64_t timestamp, int64_t position, std::optional<int64_t> previous_timestamp)
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		auto &value = _keyframe_map.emplace(timestamp, position).first->second;
+
+		if (value < 0)
+		{
+			value = position;
+		}
+
+		if ((previous_timestamp.has_value() == false) || (previous_timestamp.value() >= timestamp))
+		{
+			return;
+		}
+
+		// Merges [previous_timestamp, timestamp] with the ranges that overlap it
+		int64_t start = previous_timestamp.value();
+		int64_t end = timestamp;
+
+		auto range = _covered_range_map.upper_bound(start);
+
+		if ((range != _covered_range_map.begin()) && (std::prev(range)->second >= start))
+		{
+			range--;
+		}
+
+		while ((range != _covered_range_map.end()) && (range->first <= end))
+		{
+			start = std::min(start, range->first);
+			end = std::max(end, range->second);
+
+			range = _covered_range_map.erase(range);
+		}
+
+		_covered_range_map.emplace(start, end);
+	}
+
+	std::optional<PlayoutKeyframeIndex::Keyframe> PlayoutKeyframeIndex::Find(int64_t timestamp) const
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		auto item = _keyframe_map.upper_bound(timestamp);
+		if (item == _keyframe_map.begin())
+		{
+			return std::nullopt;
+		}
+
+		item--;
+
+		if (item->first == timestamp)
+		{
+			return Keyframe{item->first, item->second};
+		}
+
+		// The range that covers the keyframe must continue past the timestamp,
+		// so there is no unknown keyframe between the keyframe and the timestamp
+		auto range = _covered_range_map.upper_bound(item->first);
+		if ((range == _covered_range_map.begin()) || (std::prev(range)->second <= timestamp))
+		{
+			return std::nullopt;
+		}
+
+		return Keyframe{item->first, item->second};
+	}
+
+	size_t PlayoutKeyframeIndex::GetCount() const
+	{
+		std::lock_guard lock_guard(_mutex);
+		return _keyframe_map.size();
+	}
+}  // namespace pvd
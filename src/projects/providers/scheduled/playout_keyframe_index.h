@@ -0,0 +1,70 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <map>
+#include <optional>
+
+// The maximum number of the files whose keyframes are kept
+#define PLAYOUT_KEYFRAME_INDEX_MAX_FILES 64
+
+namespace pvd
+{
+	// The keyframes of the first video stream of a file, to seek to the keyframe at (or right before) the start position
+	// of an item without searching the file. It is filled from the index of the demuxer if it has one (e.g. MP4),
+	// or from the keyframes read while playing (e.g. MPEG-TS), so the next playback of the file can seek by the byte position.
+	//
+	// The keyframes read while playing may cover only a part of the file (e.g. the playbacks started from a few positions),
+	// so the index also keeps the ranges where every keyframe is known (the keyframes read one after another).
+	// A keyframe is only returned if such a range covers it and continues past the position,
+	// otherwise an unknown keyframe may be closer to the position.
+	class PlayoutKeyframeIndex
+	{
+	public:
+		struct Keyframe
+		{
+			// DTS in the time base of the stream
+			int64_t timestamp;
+			// Byte position in the file (-1 if unknown)
+			int64_t position;
+		};
+
+		// The index is shared by all the playbacks of the file, until the file is modified.
+		// The indices of the least recently used files are evicted over PLAYOUT_KEYFRAME_INDEX_MAX_FILES.
+		static std::shared_ptr<PlayoutKeyframeIndex> Get(const ov::String &file_path);
+
+		// previous_timestamp: The keyframe right before this one (there is no keyframe between them) if known
+		void Add(int64_t timestamp, int64_t position, std::optional<int64_t> previous_timestamp = std::nullopt);
+		// Returns the last keyframe at or before timestamp, if the index is known to have no gap around timestamp
+		std::optional<Keyframe> Find(int64_t timestamp) const;
+
+		size_t GetCount() const;
+
+	private:
+		struct Entry
+		{
+			time_t modified_time;
+			off_t size;
+			// The order of the last Get() for the eviction
+			uint64_t last_used;
+			std::shared_ptr<PlayoutKeyframeIndex> index;
+		};
+
+		static std::mutex _index_map_mutex;
+		static std::map<ov::String, Entry> _index_map;
+		static uint64_t _last_used;
+
+		mutable std::mutex _mutex;
+		// timestamp: position
+		std::map<int64_t, int64_t> _keyframe_map;
+		// The ranges of the timestamps where every keyframe is in _keyframe_map (start: end, both are keyframes)
+		std::map<int64_t, int64_t> _covered_range_map;
+	};
+}  // namespace pvd
@@ -0,0 +1,406 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "playout_scheduler.h"
+
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "scheduled_provider_private.h"
+
+namespace pvd
+{
+	PlayoutScheduler::PlayoutScheduler()
+	{
+		for (int index = 0; index < PLAYOUT_SCHEDULER_WORKER_COUNT; index++)
+		{
+			auto worker = std::make_unique<Worker>();
+
+			worker->timer_fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+			worker->event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+			if ((worker->timer_fd < 0) || (worker->event_fd < 0))
+			{
+				logte("Could not create the timer of the playout worker: %s", ov::Error::CreateErrorFromErrno()->What());
+			}
+
+			worker->thread = std::thread(&PlayoutScheduler::WorkerThread, this, worker.get());
+			worker->thread_id = worker->thread.get_id();
+			::pthread_setname_np(worker->thread.native_handle(), ov::String::FormatString("Playout%d", index).CStr());
+
+			_worker_list.push_back(std::move(worker));
+		}
+
+		for (int index = 0; index < PLAYOUT_SCHEDULER_READER_COUNT; index++)
+		{
+			auto reader = std::make_unique<Reader>();
+
+			reader->thread = std::thread(&PlayoutScheduler::ReaderThread, this, reader.get());
+			::pthread_setname_np(reader->thread.native_handle(), ov::String::FormatString("PlayoutRead%d", index).CStr());
+
+			_reader_list.push_back(std::move(reader));
+		}
+
+		for (int index = 0; index < PLAYOUT_SCHEDULER_LOADER_COUNT; index++)
+		{
+			auto loader = std::make_unique<Reader>();
+
+			loader->thread = std::thread(&PlayoutScheduler::ReaderThread, this, loader.get());
+			::pthread_setname_np(loader->thread.native_handle(), ov::String::FormatString("PlayoutLoad%d", index).CStr());
+
+			_loader_list.push_back(std::move(loader));
+		}
+	}
+
+	PlayoutScheduler::~PlayoutScheduler()
+	{
+		for (auto &worker : _worker_list)
+		{
+			{
+				std::lock_guard lock_guard(worker->mutex);
+				worker->stop = true;
+			}
+
+			Notify(worker.get());
+		}
+
+		for (auto reader_list : {&_reader_list, &_loader_list})
+		{
+			for (auto &reader : *reader_list)
+			{
+				{
+					std::lock_guard lock_guard(reader->mutex);
+					reader->stop = true;
+				}
+
+				reader->condition.notify_one();
+			}
+		}
+
+		for (auto &worker : _worker_list)
+		{
+			if (worker->thread.joinable())
+			{
+				worker->thread.join();
+			}
+
+			OV_SAFE_FUNC(worker->timer_fd, -1, ::close, );
+			OV_SAFE_FUNC(worker->event_fd, -1, ::close, );
+		}
+
+		for (auto reader_list : {&_reader_list, &_loader_list})
+		{
+			for (auto &reader : *reader_list)
+			{
+				if (reader->thread.joinable())
+				{
+					reader->thread.join();
+				}
+			}
+		}
+	}
+
+	PlayoutScheduler::Worker *PlayoutScheduler::GetWorker(uint64_t key) const
+	{
+		return _worker_list[key % _worker_list.size()].get();
+	}
+
+	uint64_t PlayoutScheduler::IssueKey()
+	{
+		// 0 is reserved for Worker::running_key
+		return _last_key.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+	void PlayoutScheduler::Register(uint64_t key, const std::shared_ptr<PlayoutTask> &task)
+	{
+		auto worker = GetWorker(key);
+
+		{
+			std::lock_guard lock_guard(worker->mutex);
+
+			auto &entry = worker->entry_map[key];
+			entry.task = task;
+
+			ScheduleEntry(worker, key, entry, Clock::now());
+		}
+
+		Notify(worker);
+	}
+
+	void PlayoutScheduler::Unregister(uint64_t key)
+	{
+		auto worker = GetWorker(key);
+
+		std::unique_lock lock(worker->mutex);
+
+		worker->entry_map.erase(key);
+
+		// OnPlayout() may release the last reference of the task, and its destructor may unregister itself
+		if (worker->thread_id != std::this_thread::get_id())
+		{
+			worker->idle_condition.wait(lock, [worker, key]() -> bool {
+				return worker->running_key != key;
+			});
+		}
+	}
+
+	void PlayoutScheduler::Wakeup(uint64_t key)
+	{
+		auto worker = GetWorker(key);
+
+		{
+			std::lock_guard lock_guard(worker->mutex);
+
+			auto item = worker->entry_map.find(key);
+			if (item == worker->entry_map.end())
+			{
+				return;
+			}
+
+			if (worker->running_key == key)
+			{
+				// It will be rescheduled when OnPlayout() returns
+				item->second.wakeup_requested = true;
+				return;
+			}
+
+			ScheduleEntry(worker, key, item->second, Clock::now());
+		}
+
+		Notify(worker);
+	}
+
+	void PlayoutScheduler::PostRead(uint64_t key, ReadTask task)
+	{
+		PostTask(_reader_list, key, std::move(task));
+	}
+
+	void PlayoutScheduler::PostLoad(uint64_t key, ReadTask task)
+	{
+		PostTask(_loader_list, key, std::move(task));
+	}
+
+	void PlayoutScheduler::PostTask(const std::vector<std::unique_ptr<Reader>> &reader_list, uint64_t key, ReadTask task)
+	{
+		auto &reader = reader_list[key % reader_list.size()];
+
+		{
+			std::lock_guard lock_guard(reader->mutex);
+
+			if (reader->stop)
+			{
+				return;
+			}
+
+			reader->task_queue.push_back(std::move(task));
+		}
+
+		reader->condition.notify_one();
+	}
+
+	void PlayoutScheduler::ScheduleEntry(Worker *worker, uint64_t key, Entry &entry, Clock::time_point deadline)
+	{
+		entry.generation++;
+		entry.deadline = deadline;
+
+		if (deadline != PlayoutTask::Never)
+		{
+			worker->deadline_heap.push({deadline, key, entry.generation});
+		}
+	}
+
+	void PlayoutScheduler::Notify(Worker *worker)
+	{
+		uint64_t value = 1;
+
+		if (::write(worker->event_fd, &value, sizeof(value)) < 0)
+		{
+			// The counter is already non-zero (EAGAIN), so the worker will wake up anyway
+		}
+	}
+
+	void PlayoutScheduler::ArmTimer(Worker *worker, Clock::time_point deadline)
+	{
+		struct itimerspec timer_spec = {};
+
+		if (deadline != PlayoutTask::Never)
+		{
+			// steady_clock is CLOCK_MONOTONIC
+			auto deadline_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+
+			// Zero disarms the timer
+			deadline_ns = std::max<int64_t>(deadline_ns, 1);
+
+			timer_spec.it_value.tv_sec = deadline_ns / 1000000000LL;
+			timer_spec.it_value.tv_nsec = deadline_ns % 1000000000LL;
+		}
+
+		::timerfd_settime(worker->timer_fd, TFD_TIMER_ABSTIME, &timer_spec, nullptr);
+	}
+
+	void PlayoutScheduler::WorkerThread(Worker *worker)
+	{
+		ov::logger::ThreadHelper thread_helper;
+
+		std::vector<std::pair<uint64_t, std::shared_ptr<PlayoutTask>>> due_task_list;
+
+		while (true)
+		{
+			auto next_deadline = PlayoutTask::Never;
+
+			{
+				std::lock_guard lock_guard(worker->mutex);
+
+				if (worker->stop)
+				{
+					break;
+				}
+
+				auto now = Clock::now();
+				auto &heap = worker->deadline_heap;
+
+				while (heap.empty() == false)
+				{
+					auto top = heap.top();
+					auto item = worker->entry_map.find(top.key);
+
+					if ((item == worker->entry_map.end()) || (item->second.generation != top.generation))
+					{
+						// Unregistered or rescheduled
+						heap.pop();
+						continue;
+					}
+
+					if (top.deadline > now)
+					{
+						next_deadline = top.deadline;
+						break;
+					}
+
+					heap.pop();
+
+					auto task = item->second.task.lock();
+					if (task == nullptr)
+					{
+						worker->entry_map.erase(item);
+						continue;
+					}
+
+					item->second.generation++;
+					item->second.deadline = PlayoutTask::Never;
+					item->second.wakeup_requested = false;
+
+					due_task_list.emplace_back(top.key, std::move(task));
+				}
+			}
+
+			if (due_task_list.empty() == false)
+			{
+				for (auto &[key, task] : due_task_list)
+				{
+					{
+						std::lock_guard lock_guard(worker->mutex);
+
+						if (worker->entry_map.find(key) == worker->entry_map.end())
+						{
+							continue;
+						}
+
+						worker->running_key = key;
+					}
+
+					auto deadline = task->OnPlayout();
+
+					{
+						std::lock_guard lock_guard(worker->mutex);
+
+						worker->running_key = 0;
+
+						auto item = worker->entry_map.find(key);
+						if (item != worker->entry_map.end())
+						{
+							if (item->second.wakeup_requested)
+							{
+								item->second.wakeup_requested = false;
+								deadline = Clock::now();
+							}
+
+							ScheduleEntry(worker, key, item->second, deadline);
+						}
+					}
+
+					worker->idle_condition.notify_all();
+				}
+
+				// The destructor of a task may run here (if it is the last reference)
+				due_task_list.clear();
+
+				continue;
+			}
+
+			ArmTimer(worker, next_deadline);
+
+			struct pollfd poll_fds[2] = {
+				{worker->timer_fd, POLLIN, 0},
+				{worker->event_fd, POLLIN, 0}};
+
+			if (::poll(poll_fds, 2, -1) < 0)
+			{
+				if (errno != EINTR)
+				{
+					logte("Could not wait for the playout deadline: %s", ov::Error::CreateErrorFromErrno()->What());
+				}
+
+				continue;
+			}
+
+			uint64_t value;
+			for (auto &poll_fd : poll_fds)
+			{
+				if (poll_fd.revents & POLLIN)
+				{
+					// Resets the expiration count of the timer, or the counter of the event
+					if (::read(poll_fd.fd, &value, sizeof(value)) < 0)
+					{
+						// EAGAIN: Already read
+					}
+				}
+			}
+		}
+	}
+
+	void PlayoutScheduler::ReaderThread(Reader *reader)
+	{
+		ov::logger::ThreadHelper thread_helper;
+
+		while (true)
+		{
+			ReadTask task;
+
+			{
+				std::unique_lock lock(reader->mutex);
+
+				reader->condition.wait(lock, [reader]() -> bool {
+					return reader->stop || (reader->task_queue.empty() == false);
+				});
+
+				if (reader->stop)
+				{
+					break;
+				}
+
+				task = std::move(reader->task_queue.front());
+				reader->task_queue.pop_front();
+			}
+
+			task();
+		}
+	}
+}  // namespace pvd
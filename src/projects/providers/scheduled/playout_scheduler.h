@@ -0,0 +1,142 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <condition_variable>
+#include <deque>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+
+// The number of threads that emit the packets of the scheduled channels
+#define PLAYOUT_SCHEDULER_WORKER_COUNT 4
+// The number of threads that read the files of the scheduled channels ahead
+#define PLAYOUT_SCHEDULER_READER_COUNT 4
+// The number of threads that open the next items of the scheduled channels
+#define PLAYOUT_SCHEDULER_LOADER_COUNT 2
+
+namespace pvd
+{
+	// A channel driven by the PlayoutScheduler
+	class PlayoutTask
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		// Returned by OnPlayout() to wait until Wakeup() is called
+		static constexpr Clock::time_point Never = Clock::time_point::max();
+
+		virtual ~PlayoutTask() = default;
+
+		// Called at the deadline (or as soon as possible after Wakeup()), and returns the next deadline.
+		// It is always called in the same thread, so it doesn't need to be reentrant, but it must not block.
+		virtual Clock::time_point OnPlayout() = 0;
+	};
+
+	// Drives the scheduled channels with a few threads, instead of a thread per channel.
+	//
+	// Each worker keeps the deadlines of its channels in a heap, and sleeps on a timerfd armed with
+	// the earliest one (an eventfd wakes it up when a channel is registered or woken up),
+	// so the packets are emitted on time regardless of the number of channels.
+	// The channels are sharded by the key, so a channel is always processed in the same thread.
+	//
+	// The blocking I/O of the channels (e.g. av_read_frame()) is done by the readers with PostRead(),
+	// so a slow file delays only its own channel. Opening a file (which may take much longer than reading a packet)
+	// is done by the loaders with PostLoad(), so it doesn't delay the reading of the items being played.
+	class PlayoutScheduler : public ov::Singleton<PlayoutScheduler>
+	{
+	public:
+		using Clock = PlayoutTask::Clock;
+		using ReadTask = std::function<void()>;
+
+		PlayoutScheduler();
+		~PlayoutScheduler() override;
+
+		// Issues a key for a new task. The key must be stored where OnPlayout() reads it before Register() is called,
+		// because OnPlayout() may be called in another thread before Register() returns.
+		uint64_t IssueKey();
+		// OnPlayout() is called as soon as possible
+		void Register(uint64_t key, const std::shared_ptr<PlayoutTask> &task);
+		// Waits for OnPlayout() to return if it is running in another thread
+		void Unregister(uint64_t key);
+
+		// Calls OnPlayout() as soon as possible, even if it is running now
+		void Wakeup(uint64_t key);
+
+		// The read tasks of the same key are run in the order they are posted
+		void PostRead(uint64_t key, ReadTask task);
+		void PostLoad(uint64_t key, ReadTask task);
+
+	private:
+		struct Entry
+		{
+			std::weak_ptr<PlayoutTask> task;
+			Clock::time_point deadline;
+			// Increased whenever the deadline is changed, to skip the stale items in the heap
+			uint64_t generation = 0;
+			bool wakeup_requested = false;
+		};
+
+		struct HeapItem
+		{
+			Clock::time_point deadline;
+			uint64_t key;
+			uint64_t generation;
+
+			bool operator>(const HeapItem &other) const
+			{
+				return deadline > other.deadline;
+			}
+		};
+
+		struct Worker
+		{
+			std::thread thread;
+			std::thread::id thread_id;
+
+			int timer_fd = -1;
+			int event_fd = -1;
+
+			std::mutex mutex;
+			std::condition_variable idle_condition;
+			std::unordered_map<uint64_t, Entry> entry_map;
+			std::priority_queue<HeapItem, std::vector<HeapItem>, std::greater<HeapItem>> deadline_heap;
+			// The key of the task running now (0 if none)
+			uint64_t running_key = 0;
+			bool stop = false;
+		};
+
+		struct Reader
+		{
+			std::thread thread;
+
+			std::mutex mutex;
+			std::condition_variable condition;
+			std::deque<ReadTask> task_queue;
+			bool stop = false;
+		};
+
+		Worker *GetWorker(uint64_t key) const;
+		void PostTask(const std::vector<std::unique_ptr<Reader>> &reader_list, uint64_t key, ReadTask task);
+		// Must be called with worker->mutex locked
+		void ScheduleEntry(Worker *worker, uint64_t key, Entry &entry, Clock::time_point deadline);
+		void Notify(Worker *worker);
+		void ArmTimer(Worker *worker, Clock::time_point deadline);
+
+		void WorkerThread(Worker *worker);
+		void ReaderThread(Reader *reader);
+
+		std::vector<std::unique_ptr<Worker>> _worker_list;
+		std::vector<std::unique_ptr<Reader>> _reader_list;
+		std::vector<std::unique_ptr<Reader>> _loader_list;
+
+		std::atomic<uint64_t> _last_key{0};
+	};
+}  // namespace pvd
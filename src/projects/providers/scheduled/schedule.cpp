@@ -45,6 +45,32 @@ namespace pvd
 			}
 		}
 
+		_format_context = OpenContext();
+		if (_format_context == nullptr)
+		{
+			return nullptr;
+		}
+
+		// Record last modified time
+		if (stat(_file_path.CStr(), &_last_loaded_stat) != 0)
+		{
+			_format_context = nullptr;
+			logte("LoadContext: Failed to get file stat for file %s.", _file_path.CStr());
+			return nullptr;
+		}
+
+		logti("LoadContext: File loaded successfully: %s (%lld ms)", _file_path.CStr(), sw.Elapsed());
+
+		return _format_context;
+	}
+
+	std::shared_ptr<AVFormatContext> Schedule::Item::OpenContext() const
+	{
+		if (_file == false || _file_path.IsEmpty())
+		{
+			return nullptr;
+		}
+
 		int err = 0;
 		AVFormatContext *ctx = nullptr;
 		err = ::avformat_open_input(&ctx, _file_path.CStr(), nullptr, nullptr);
@@ -52,41 +78,29 @@ namespace pvd
 		{
 			char errbuf[AV_ERROR_MAX_STRING_SIZE] = {0};
 			::av_strerror(err, errbuf, sizeof(errbuf));
-			_format_context = nullptr;
-			logte("LoadContext: Failed to open file %s. error (%d, %s)", _file_path.CStr(), err,  errbuf);
+			logte("OpenContext: Failed to open file %s. error (%d, %s)", _file_path.CStr(), err,  errbuf);
 			return nullptr;
 		}
 
 		ov::String file_path_copy = _file_path;
-		_format_context.reset(ctx, [file_path_copy](AVFormatContext *ctx) {
+		std::shared_ptr<AVFormatContext> format_context(ctx, [file_path_copy](AVFormatContext *ctx) {
 			if (ctx)
 			{
-				logti("LoadContext: Closing format context : %s", file_path_copy.CStr());
+				logti("OpenContext: Closing format context : %s", file_path_copy.CStr());
 				::avformat_close_input(&ctx);
 			}
 		});
 
-		err = ::avformat_find_stream_info(_format_context.get(), nullptr);
+		err = ::avformat_find_stream_info(format_context.get(), nullptr);
 		if (err < 0)
 		{
 			char errbuf[AV_ERROR_MAX_STRING_SIZE] = {0};
 			::av_strerror(err, errbuf, sizeof(errbuf));
-			_format_context = nullptr;
-			logte("LoadContext: Failed to find stream info for file %s. error (%d, %s)", _file_path.CStr(), err,  errbuf);
+			logte("OpenContext: Failed to find stream info for file %s. error (%d, %s)", _file_path.CStr(), err,  errbuf);
 			return nullptr;
 		}
 
-		// Record last modified time
-		if (stat(_file_path.CStr(), &_last_loaded_stat) != 0)
-		{
-			_format_context = nullptr;
-			logte("LoadContext: Failed to get file stat for file %s.", _file_path.CStr());
-			return nullptr;
-		}
-
-		logti("LoadContext: File loaded successfully: %s (%lld ms)", _file_path.CStr(), sw.Elapsed());
-
-		return _format_context;
+		return format_context;
 	}
 
 	std::shared_ptr<Schedule::Item> Schedule::Program::GetFirstItemWithPosition()
@@ -172,6 +186,36 @@ namespace pvd
 		return item;
 	}
 
+	std::vector<std::shared_ptr<Schedule::Item>> Schedule::Program::PeekNextItems(size_t count) const
+	{
+		std::vector<std::shared_ptr<Item>> items;
+
+		if (_items.empty())
+		{
+			return items;
+		}
+
+		// Same order as GetNextItem()
+		size_t index = _current_item_index;
+		while (items.size() < count)
+		{
+			if (index >= _items.size())
+			{
+				if (_repeat == false)
+				{
+					break;
+				}
+
+				index = 0;
+			}
+
+			items.push_back(_items[index]);
+			index++;
+		}
+
+		return items;
+	}
+
 	std::shared_ptr<Schedule::Item> Schedule::Program::GetItem(int index)
 	{
 		if (index < 0 || size_t(index) >= _items.size())
@@ -92,6 +92,8 @@ namespace pvd
 
 			// File
 			std::shared_ptr<AVFormatContext> LoadContext();
+			// Opens and probes a new context that is not shared with LoadContext(), so it can be used in another thread
+			std::shared_ptr<AVFormatContext> OpenContext() const;
 		private:
 			std::shared_ptr<AVFormatContext> _format_context;
 			struct stat _last_loaded_stat;
@@ -140,6 +142,8 @@ namespace pvd
 			std::shared_ptr<Item> GetFirstItemWithPosition();
 			std::shared_ptr<Item> GetNextItem();
 			std::shared_ptr<Item> GetItem(int index);
+			// The items that GetNextItem() will return, without advancing
+			std::vector<std::shared_ptr<Item>> PeekNextItems(size_t count) const;
 			bool IsOffAir() const;
 
 			// == operator
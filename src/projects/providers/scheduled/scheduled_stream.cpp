@@ -11,6 +11,7 @@
 #include "schedule_private.h"
 
 #include <base/provider/application.h>
+#include <monitoring/histogram_registry.h>
 
 namespace pvd
 {
@@ -33,28 +34,45 @@ namespace pvd
 
     bool ScheduledStream::Start()
     {
-        // Create Worker
-        _worker_thread_running = true;
-        _worker_thread = std::thread(&ScheduledStream::WorkerThread, this);
-        pthread_setname_np(_worker_thread.native_handle(), "Scheduled");
+        const auto &vhost_app_name = GetApplicationInfo().GetVHostAppName();
+        _histogram_labels = ov::String::FormatString("vhost=\"%s\",app=\"%s\",stream=\"%s\"",
+                                                     mon::HistogramRegistry::EscapeLabelValue(vhost_app_name.GetVHostName()).CStr(),
+                                                     mon::HistogramRegistry::EscapeLabelValue(vhost_app_name.GetAppName()).CStr(),
+                                                     mon::HistogramRegistry::EscapeLabelValue(GetName()).CStr());
+
+        _pacing_error_histogram = mon::HistogramRegistry::GetInstance()->Get(
+            "ome_scheduled_playout_pacing_error_microseconds",
+            "Delay of the packets of the scheduled channels from their deadlines",
+            _histogram_labels);
+        _transition_gap_histogram = mon::HistogramRegistry::GetInstance()->Get(
+            "ome_scheduled_transition_gap_microseconds",
+            "Time from the end of an item of the scheduled channels to the first packet of the next item",
+            _histogram_labels);
+
+        _playout_running = true;
+        // OnPlayout() reads the key, and may run before Register() returns
+        _playout_key = PlayoutScheduler::GetInstance()->IssueKey();
+        PlayoutScheduler::GetInstance()->Register(_playout_key, GetSharedPtrAs<ScheduledStream>());
 
         return Stream::Start();
     }
 
     bool ScheduledStream::Stop()
     {
-        if (_worker_thread_running == false)
+        if (_playout_running.exchange(false) == false)
         {
             return true;
         }
 
-        _worker_thread_running = false;
-        _schedule_updated.SetEvent();
+        // OnPlayout() is not called after this
+        PlayoutScheduler::GetInstance()->Unregister(_playout_key);
 
-        if (_worker_thread.joinable())
-        {
-            _worker_thread.join();
-        }
+        // The channel may be deleted, so its series are not exported anymore
+        mon::HistogramRegistry::GetInstance()->Remove("ome_scheduled_playout_pacing_error_microseconds", _histogram_labels);
+        mon::HistogramRegistry::GetInstance()->Remove("ome_scheduled_transition_gap_microseconds", _histogram_labels);
+
+        FinishPlayback();
+        StopPreloads();
 
         return Stream::Stop();
     }
@@ -73,7 +91,6 @@ namespace pvd
     std::shared_ptr<Schedule> ScheduledStream::GetSchedule() const
     {
         std::shared_lock<std::shared_mutex> lock(_schedule_mutex);
-        _schedule_updated.Reset();
         return _schedule;
     }
 
@@ -89,10 +106,18 @@ namespace pvd
 
     bool ScheduledStream::UpdateSchedule(const std::shared_ptr<Schedule> &schedule)
     {
-        std::lock_guard<std::shared_mutex> lock(_schedule_mutex);
-        _schedule = schedule;
+        {
+            std::lock_guard<std::shared_mutex> lock(_schedule_mutex);
+            _schedule = schedule;
+        }
+
+        _schedule_updated = true;
+
+        if (_playout_running)
+        {
+            PlayoutScheduler::GetInstance()->Wakeup(_playout_key);
+        }
 
-        _schedule_updated.SetEvent();
         return true;
     }
 
@@ -242,301 +267,550 @@ namespace pvd
 		return true;
 	}
 
-    void ScheduledStream::WorkerThread()
+    ScheduledStream::Clock::time_point ScheduledStream::OnPlayout()
     {
-		ov::logger::ThreadHelper thread_helper;
-
-        while (_worker_thread_running)
+        if (_playout_running == false)
         {
-            // Schedule
-            std::unique_lock<std::shared_mutex> guard(_current_mutex);
-            _current_schedule = GetSchedule();
-            _current_program = nullptr;
-            _current_item = nullptr;
-            _current_item_position_ms = 0;
-            guard.unlock();
+            return Never;
+        }
 
-            if (_current_schedule == nullptr)
+        // Bounded, so a channel that keeps changing its state (e.g. no playable item) doesn't hold the worker
+        for (int step = 0; step < kScheduledMaxPacketsPerPlayout; step++)
+        {
+            if (_playback != nullptr)
             {
-                _realtime_clock.Pause();
-                // Wait for schedule update
-                _schedule_updated.Wait();
+                auto next_deadline = Never;
+                auto result = _playback->item->_file ? ContinueFilePlayback(next_deadline) : ContinueStreamPlayback(next_deadline);
+
+                if (result.has_value() == false)
+                {
+                    return next_deadline;
+                }
+
+                bool fallback_item = _playback->fallback_item;
+                _transition_start = Clock::now();
+                FinishPlayback();
+                OnPlaybackFinished(fallback_item, result.value());
+
                 continue;
             }
 
-            // Programs
-            guard.lock();
-            _current_program = _current_schedule->GetCurrentProgram();
-            _fallback_program = _current_schedule->GetFallbackProgram();
-            guard.unlock();
-            if (_current_program == nullptr)
+            auto deadline = RunSchedule();
+            if (deadline.has_value())
             {
-                PlayFallbackOrWait();
-                continue;
+                return deadline.value();
             }
-			else
-			{
-				SetDurationToAllItems(_current_program);
-			}
+        }
 
-            logti("Scheduled Channel %s/%s: Start %s program", GetApplicationName(), GetName().CStr(), _current_program->_name.CStr());
+        return Clock::now();
+    }
 
-            // Items
-			bool first_item = true;
-            while (_worker_thread_running)
-            {
-                guard.lock();
-                _current_item = nullptr;
-                guard.unlock();
-                
-                if (CheckCurrentProgramChanged() == true)
-                {
-                    logti("Scheduled Channel %s/%s: Program changed", GetApplicationName(), GetName().CStr());
-                    break;
-                }
+    std::optional<ScheduledStream::Clock::time_point> ScheduledStream::RunSchedule()
+    {
+        switch (_playout_state)
+        {
+            case PlayoutState::SelectProgram:
+                return SelectProgram();
 
-                guard.lock();
-				if (first_item == true)
-				{
-					_current_item = _current_program->GetFirstItemWithPosition();
-				}
-                else
-				{
-					_current_item = _current_program->GetNextItem();
-				}
-                guard.unlock();
+            case PlayoutState::SelectItem:
+                return SelectItem();
 
-                if (_current_item == nullptr)
-                {
-                    logti("Scheduled Channel %s/%s: Program ended", GetApplicationName(), GetName().CStr());
-                    break;
-                }
+            case PlayoutState::RetryItem:
+                StartItem(_current_item, false);
+                return std::nullopt;
 
-				first_item = false;
-				bool exit_loop = false;
-                while (_worker_thread_running)
-                {
-                    auto result = PlayItem(_current_item);
-                    if (result == PlaybackResult::ERROR)
-                    {
-                        if (_current_item->_fallback_on_err == true)
-                        {
-							auto fallback_result = PlayFallbackOrWait();
-                            if (fallback_result == PlaybackResult::FAILBACK)
-                            {
-                                continue;
-                            }
-							else if (CheckCurrentFallbackProgramChanged() == true)
-							{
-								// Fallback program changed, should reset to _fallback_program
-								exit_loop = true;
-							}
-                        }
-                    }
+            case PlayoutState::Fallback:
+                return RunFallback();
+        }
 
-					break;
-                }
+        return std::nullopt;
+    }
 
-				if (exit_loop == true)
-				{
-					break;
-				}
-            }
+    std::optional<ScheduledStream::Clock::time_point> ScheduledStream::SelectProgram()
+    {
+        _schedule_updated = false;
+
+        // The first item of a program starts from the position by the current time, which is not preloaded
+        StopPreloads();
+
+        // Schedule
+        std::unique_lock<std::shared_mutex> guard(_current_mutex);
+        _current_schedule = GetSchedule();
+        _current_program = nullptr;
+        _current_item = nullptr;
+        _current_item_position_ms = 0;
+        guard.unlock();
+
+        if (_current_schedule == nullptr)
+        {
+            _realtime_clock.Pause();
+            // Wait for schedule update
+            return Never;
         }
+
+        // Programs
+        guard.lock();
+        _current_program = _current_schedule->GetCurrentProgram();
+        _fallback_program = _current_schedule->GetFallbackProgram();
+        guard.unlock();
+        if (_current_program == nullptr)
+        {
+            EnterFallback(false);
+            return std::nullopt;
+        }
+
+        SetDurationToAllItems(_current_program);
+
+        logti("Scheduled Channel %s/%s: Start %s program", GetApplicationName(), GetName().CStr(), _current_program->_name.CStr());
+
+        _first_item = true;
+        _playout_state = PlayoutState::SelectItem;
+
+        return std::nullopt;
+    }
+
+    std::optional<ScheduledStream::Clock::time_point> ScheduledStream::SelectItem()
+    {
+        std::unique_lock<std::shared_mutex> guard(_current_mutex);
+        _current_item = nullptr;
+        guard.unlock();
+
+        if (CheckCurrentProgramChanged() == true)
+        {
+            logti("Scheduled Channel %s/%s: Program changed", GetApplicationName(), GetName().CStr());
+            _playout_state = PlayoutState::SelectProgram;
+            return std::nullopt;
+        }
+
+        guard.lock();
+        if (_first_item == true)
+        {
+            _current_item = _current_program->GetFirstItemWithPosition();
+        }
+        else
+        {
+            _current_item = _current_program->GetNextItem();
+        }
+        guard.unlock();
+
+        if (_current_item == nullptr)
+        {
+            logti("Scheduled Channel %s/%s: Program ended", GetApplicationName(), GetName().CStr());
+            _playout_state = PlayoutState::SelectProgram;
+            return std::nullopt;
+        }
+
+        _first_item = false;
+
+        StartItem(_current_item, false);
+
+        return std::nullopt;
     }
 
-    ScheduledStream::PlaybackResult ScheduledStream::PlayFallbackOrWait()
+    void ScheduledStream::EnterFallback(bool retry_item)
     {
         logti("Scheduled Channel %s/%s: Start fallback program", GetApplicationName(), GetName().CStr());
 
-        PlaybackResult result = PlaybackResult::PLAY_NEXT_ITEM;
+        _fallback_retry_item = retry_item;
+        _fallback_first_item = true;
+        _fallback_result = PlaybackResult::PLAY_NEXT_ITEM;
+        _wait_until = Clock::time_point::min();
 
-        // Fallback
-		bool fisrt = true;
-        while (_worker_thread_running)
+        _playout_state = PlayoutState::Fallback;
+    }
+
+    void ScheduledStream::ExitFallback(PlaybackResult result)
+    {
+        if (_fallback_retry_item == false)
         {
-            if (CheckCurrentProgramChanged() == true)
-            {
-                logti("Scheduled Channel %s/%s: Program changed", GetApplicationName(), GetName().CStr());
-                break;
-            }
+            // There was no current program
+            _playout_state = PlayoutState::SelectProgram;
+        }
+        else if (result == PlaybackResult::FAILBACK)
+        {
+            _playout_state = PlayoutState::RetryItem;
+        }
+        else if (CheckCurrentFallbackProgramChanged() == true)
+        {
+            // Fallback program changed, should reset to _fallback_program
+            _playout_state = PlayoutState::SelectProgram;
+        }
+        else
+        {
+            _playout_state = PlayoutState::SelectItem;
+        }
+    }
 
-            if (CheckCurrentFallbackProgramChanged() == true)
+    std::optional<ScheduledStream::Clock::time_point> ScheduledStream::RunFallback()
+    {
+        if ((Clock::now() < _wait_until) && (_schedule_updated.exchange(false) == false))
+        {
+            return _wait_until;
+        }
+
+        _wait_until = Clock::time_point::min();
+
+        if (CheckCurrentProgramChanged() == true)
+        {
+            logti("Scheduled Channel %s/%s: Program changed", GetApplicationName(), GetName().CStr());
+            ExitFallback(_fallback_result);
+            return std::nullopt;
+        }
+
+        if (CheckCurrentFallbackProgramChanged() == true)
+        {
+            logti("Scheduled Channel %s/%s: Fallback program changed", GetApplicationName(), GetName().CStr());
+            ExitFallback(_fallback_result);
+            return std::nullopt;
+        }
+
+        if (_fallback_program == nullptr || _fallback_program->_items.empty() == true)
+        {
+            if (CheckCurrentItemAvailable(true) == true)
             {
-                logti("Scheduled Channel %s/%s: Fallback program changed", GetApplicationName(), GetName().CStr());
-                break;
+                ExitFallback(PlaybackResult::FAILBACK);
+                return std::nullopt;
             }
 
-            if (_fallback_program == nullptr || _fallback_program->_items.empty() == true)
-            {
-                if (CheckCurrentItemAvailable(true) == true)
-                {
-                    return PlaybackResult::FAILBACK;
-                }
+            _realtime_clock.Pause();
+            _wait_until = Clock::now() + std::chrono::milliseconds(1000);
 
-                _realtime_clock.Pause();
-                _schedule_updated.Wait(1000);
+            return _wait_until;
+        }
 
-                continue;
-            }
+        std::shared_ptr<Schedule::Item> item = nullptr;
+        if (_fallback_first_item == true)
+        {
+            item = _fallback_program->GetItem(0);
+            _fallback_first_item = false;
+        }
+        else
+        {
+            item = _fallback_program->GetNextItem();
+        }
 
-			std::shared_ptr<Schedule::Item> item = nullptr;
-			if (fisrt == true)
-			{
-				item = _fallback_program->GetItem(0);
-				fisrt = false;
-			}
-			else
-			{
-				item = _fallback_program->GetNextItem();
-			}
+        StartItem(item, true);
+
+        return std::nullopt;
+    }
+
+    void ScheduledStream::StartItem(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    {
+        if (StartPlayback(item, fallback_item) == false)
+        {
+            OnPlaybackFinished(fallback_item, PlaybackResult::ERROR);
+        }
+    }
 
-            result = PlayItem(item, true);
-            if (result == PlaybackResult::FAILBACK)
+    void ScheduledStream::OnPlaybackFinished(bool fallback_item, PlaybackResult result)
+    {
+        if (fallback_item == false)
+        {
+            if ((result == PlaybackResult::ERROR) && (_current_item->_fallback_on_err == true))
             {
-                break;
+                EnterFallback(true);
+                return;
             }
-            else if (result == PlaybackResult::PLAY_NEXT_ITEM)
+
+            _playout_state = PlayoutState::SelectItem;
+            return;
+        }
+
+        _fallback_result = result;
+
+        if (result == PlaybackResult::FAILBACK)
+        {
+            ExitFallback(result);
+        }
+        else if (result == PlaybackResult::PLAY_NEXT_ITEM)
+        {
+            // Next fallback item
+        }
+        else if (result == PlaybackResult::PLAY_NEXT_PROGRAM)
+        {
+            ExitFallback(result);
+        }
+        else if (result == PlaybackResult::ERROR)
+        {
+            logte("Scheduled Channel %s/%s: Playback error in fallback program. Try to play next item", GetApplicationName(), GetName().CStr());
+
+            if (CheckCurrentItemAvailable(true) == true)
             {
-                // Next fallback item
+                ExitFallback(PlaybackResult::FAILBACK);
+                return;
             }
-            else if (result == PlaybackResult::PLAY_NEXT_PROGRAM)
+
+            _realtime_clock.Pause();
+            _wait_until = Clock::now() + std::chrono::milliseconds(250);
+        }
+        else
+        {
+            logtc("Scheduled Channel %s/%s: Unknown playback result %d", GetApplicationName(), GetName().CStr(), static_cast<int>(result));
+            ExitFallback(result);
+        }
+    }
+
+    bool ScheduledStream::StartPlayback(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    {
+        if (item == nullptr)
+        {
+            return false;
+        }
+
+        auto playback = std::make_unique<Playback>();
+        playback->item = item;
+        playback->fallback_item = fallback_item;
+
+        if (item->_file == true)
+        {
+            logti("Scheduled Channel : %s/%s: Play file %s", GetApplicationName(), GetName().CStr(), item->_file_path.CStr());
+
+            // The file is opened (or has been opened while playing the previous item) by the loader,
+            // and the playback starts when it is loaded
+            playback->loader = TakePreload(item);
+        }
+        else
+        {
+            logti("Scheduled Channel : %s/%s: Play stream %s", GetApplicationName(), GetName().CStr(), item->_url.CStr());
+
+            playback->stream_tap = PrepareStreamPlayback(item);
+            if (playback->stream_tap == nullptr)
             {
-                break;
+                logte("Scheduled Channel : %s/%s: Failed to prepare stream playback. Try to play next item", GetApplicationName(), GetName().CStr());
+                return false;
             }
-            else if (result == PlaybackResult::ERROR)
+
+            playback->pop_clock.Start();
+        }
+
+        if (_realtime_clock.IsStart() == false)
+        {
+            _realtime_clock.Start();
+        }
+
+        if (_realtime_clock.IsPaused() == true)
+        {
+            _realtime_clock.Resume();
+        }
+
+        _playback = std::move(playback);
+
+        UpdatePreloads(fallback_item ? _fallback_program : _current_program);
+
+        return true;
+    }
+
+    void ScheduledStream::UpdatePreloads(const std::shared_ptr<Schedule::Program> &program)
+    {
+        std::vector<std::shared_ptr<PlayoutItemLoader>> preload_list;
+
+        if (program != nullptr)
+        {
+            for (const auto &item : program->PeekNextItems(kScheduledPreloadItemCount))
             {
-				logte("Scheduled Channel %s/%s: Playback error in fallback program. Try to play next item", GetApplicationName(), GetName().CStr());
+                if ((item == nullptr) || (item->_file == false))
+                {
+                    continue;
+                }
+
+                // Reuse the loader of the item if it is already loading (the same item may appear more than once)
+                auto loader_it = std::find_if(_preload_list.begin(), _preload_list.end(), [&item](const auto &loader) {
+                    return loader->GetItem() == item;
+                });
 
-				if (CheckCurrentItemAvailable(true) == true)
+                if (loader_it != _preload_list.end())
                 {
-                    return PlaybackResult::FAILBACK;
+                    preload_list.push_back(std::move(*loader_it));
+                    _preload_list.erase(loader_it);
+                    continue;
                 }
 
-                _realtime_clock.Pause();
-                _schedule_updated.Wait(250);
+                auto loader = std::make_shared<PlayoutItemLoader>(_playout_key, item);
+                loader->Start();
 
-                continue;
-			}
-			else
-			{
-				logtc("Scheduled Channel %s/%s: Unknown playback result %d", GetApplicationName(), GetName().CStr(), static_cast<int>(result));
-				break;
+                logtd("Scheduled Channel : %s/%s: Preload file %s", GetApplicationName(), GetName().CStr(), item->_file_path.CStr());
+
+                preload_list.push_back(std::move(loader));
             }
         }
 
-        return result;
+        // Not played next anymore (e.g. the program is changed)
+        StopPreloads();
+
+        _preload_list = std::move(preload_list);
     }
 
-    ScheduledStream::PlaybackResult ScheduledStream::PlayItem(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    std::shared_ptr<PlayoutItemLoader> ScheduledStream::TakePreload(const std::shared_ptr<Schedule::Item> &item)
     {
-        if (item == nullptr)
+        auto loader_it = std::find_if(_preload_list.begin(), _preload_list.end(), [&item](const auto &loader) {
+            return loader->GetItem() == item;
+        });
+
+        if (loader_it != _preload_list.end())
         {
-            return PlaybackResult::ERROR;
+            auto loader = std::move(*loader_it);
+            _preload_list.erase(loader_it);
+
+            return loader;
         }
 
-        if (item->_file == true)
+        auto loader = std::make_shared<PlayoutItemLoader>(_playout_key, item);
+        loader->Start();
+
+        return loader;
+    }
+
+    void ScheduledStream::StopPreloads()
+    {
+        for (auto &loader : _preload_list)
         {
-            return PlayFile(item, fallback_item);
+            loader->Stop();
         }
-        
-        return PlayStream(item, fallback_item);
+
+        _preload_list.clear();
     }
 
-    ScheduledStream::PlaybackResult ScheduledStream::PlayFile(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    void ScheduledStream::ObserveTransitionGap()
     {
-        logti("Scheduled Channel : %s/%s: Play file %s", GetApplicationName(), GetName().CStr(), item->_file_path.CStr());
+        if (_transition_start == Clock::time_point::min())
+        {
+            return;
+        }
 
-        ScheduledStream::PlaybackResult result = PlaybackResult::PLAY_NEXT_ITEM;
+        auto gap_us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _transition_start).count();
+        _transition_start = Clock::time_point::min();
 
-		auto context = item->LoadContext();
-		if (context == nullptr)
-		{
-			logte("Scheduled Channel : %s/%s: Format context is null. Try to play next item", GetApplicationName(), GetName().CStr());
-			return PlaybackResult::ERROR;
-		}
+        _transition_gap_histogram->Observe(gap_us);
+
+        logtd("Scheduled Channel : %s/%s: Transition gap %lld us", GetApplicationName(), GetName().CStr(), gap_us);
+    }
 
-		if (PrepareFilePlayback(item) == false)
+    void ScheduledStream::FinishPlayback()
+    {
+        if (_playback == nullptr)
         {
-            logte("Scheduled Channel : %s/%s: Failed to prepare file playback. Try to play next item", GetApplicationName(), GetName().CStr());
-            return PlaybackResult::ERROR;
+            return;
         }
 
-
-        if (_realtime_clock.IsStart() == false)
+        if (_playback->loader != nullptr)
         {
-            _realtime_clock.Start();
+            // Stops the reader too
+            _playback->loader->Stop();
         }
 
-        if (_realtime_clock.IsPaused() == true)
+        _current_item_position_ms = 0;
+
+        if (_playback->stream_tap != nullptr)
         {
-            _realtime_clock.Resume();
+            _playback->stream_tap->SetReadyCallback(nullptr);
+            ocst::Orchestrator::GetInstance()->UnmirrorStream(_playback->stream_tap);
         }
 
-        // Play
-        AVPacket packet = { 0 };
-        std::map<int, bool> track_first_packet_map;
-        std::map<int, int64_t> track_single_file_dts_offset_map;
-        std::map<int, bool> end_of_track_map;
+        _playback.reset();
 
-        bool is_mpegts { std::strncmp(context->iformat->name, "mpegts", 6) == 0 };
+        logti("Scheduled Channel : %s/%s: Playback stopped", GetApplicationName(), GetName().CStr());
+    }
+
+    std::optional<ScheduledStream::PlaybackResult> ScheduledStream::ContinueFilePlayback(Clock::time_point &next_deadline)
+    {
+        auto &playback = *_playback;
+        const auto &item = playback.item;
+        const auto &context = playback.context;
 
-        while (_worker_thread_running)
+        for (int count = 0; count < kScheduledMaxPacketsPerPlayout; count++)
         {
             if (CheckCurrentProgramChanged() == true)
             {
-                result = PlaybackResult::PLAY_NEXT_PROGRAM;
-                break;
+                return PlaybackResult::PLAY_NEXT_PROGRAM;
             }
 
-            if (fallback_item)
+            if (playback.fallback_item)
             {
                 if (CheckCurrentItemAvailable() == true)
                 {
-                    result = PlaybackResult::FAILBACK;
-                    break;
+                    return PlaybackResult::FAILBACK;
                 }
             }
 
-            int32_t ret = ::av_read_frame(context.get(), &packet);
-            if (ret == AVERROR(EAGAIN))
+            if (playback.reader == nullptr)
             {
-                logtw("Scheduled Channel : %s/%s: Failed to read frame. Error (%d, %s)", GetApplicationName(), GetName().CStr(), ret, "EAGAIN");
-                continue;
+                auto state = playback.loader->GetState();
+
+                if (state == PlayoutItemLoader::State::Loading)
+                {
+                    // The loader wakes this up when the item is loaded
+                    next_deadline = Clock::now() + std::chrono::milliseconds(kScheduledReaderWaitIntervalMs);
+                    return std::nullopt;
+                }
+
+                if ((state == PlayoutItemLoader::State::Failed) || (PrepareFilePlayback(item, playback.loader->GetContext()) == false))
+                {
+                    logte("Scheduled Channel : %s/%s: Failed to prepare file playback. Try to play next item", GetApplicationName(), GetName().CStr());
+                    return PlaybackResult::ERROR;
+                }
+
+                playback.context = playback.loader->GetContext();
+                playback.is_mpegts = (std::strncmp(playback.context->iformat->name, "mpegts", 6) == 0);
+                playback.reader = playback.loader->GetReader();
             }
-            else if (ret == AVERROR_EOF || ::avio_feof(context->pb))
+
+            if (playback.deadline != Never)
             {
-                // End of file
-                logti("Scheduled Channel : %s/%s: End of file. Try to play next item", GetApplicationName(), GetName().CStr());
-                result = PlaybackResult::PLAY_NEXT_ITEM;
-                break;
+                auto now = Clock::now();
+                if (now < playback.deadline)
+                {
+                    // Woken up early (e.g. the schedule is updated)
+                    next_deadline = playback.deadline;
+                    return std::nullopt;
+                }
+
+                _pacing_error_histogram->Observe(std::chrono::duration_cast<std::chrono::microseconds>(now - playback.deadline).count());
+                playback.deadline = Never;
             }
-            else if (ret < 0)
+
+            auto av_packet = playback.reader->Pop();
+            if (av_packet == nullptr)
             {
-                char errbuf[AV_ERROR_MAX_STRING_SIZE] = { 0 };
+                int ret = 0;
+                auto state = playback.reader->GetState(&ret);
+
+                if (state == PlayoutFileReader::State::EndOfFile)
+                {
+                    // End of file
+                    logti("Scheduled Channel : %s/%s: End of file. Try to play next item", GetApplicationName(), GetName().CStr());
+                    return PlaybackResult::PLAY_NEXT_ITEM;
+                }
+                else if (state == PlayoutFileReader::State::Error)
+                {
+                    char errbuf[AV_ERROR_MAX_STRING_SIZE] = { 0 };
 
-                ::av_strerror(ret, errbuf, sizeof(errbuf));
+                    ::av_strerror(ret, errbuf, sizeof(errbuf));
 
-                logte("%s/%s: Failed to read frame. Error (%d, %s). Try to play next item", GetApplicationName(), GetName().CStr(), ret, errbuf);
+                    logte("%s/%s: Failed to read frame. Error (%d, %s). Try to play next item", GetApplicationName(), GetName().CStr(), ret, errbuf);
 
-                result = PlaybackResult::PLAY_NEXT_ITEM;
-                break;
+                    return PlaybackResult::PLAY_NEXT_ITEM;
+                }
+
+                // The reader wakes this up when the packet is read
+                next_deadline = Clock::now() + std::chrono::milliseconds(kScheduledReaderWaitIntervalMs);
+                return std::nullopt;
             }
 
-            auto track_id = FindTrackIdByOriginId(packet.stream_index);
+            auto packet = av_packet.get();
+
+            auto track_id = FindTrackIdByOriginId(packet->stream_index);
             if (track_id < 0)
             {
-                logtd("Scheduled Channel : %s/%s: Failed to find track %d", GetApplicationName(), GetName().CStr(), packet.stream_index);
-                ::av_packet_unref(&packet);
+                logtd("Scheduled Channel : %s/%s: Failed to find track %d", GetApplicationName(), GetName().CStr(), packet->stream_index);
                 continue;
             }
 
+            auto &end_of_track_map = playback.end_of_track_map;
             if (end_of_track_map.find(track_id) != end_of_track_map.end())
             {
                 // End of track
                 if (end_of_track_map.at(track_id) == true)
                 {
-                    ::av_packet_unref(&packet);
                     continue;
                 }
             }
@@ -549,7 +823,6 @@ namespace pvd
             if (track == nullptr)
             {
                 logtw("Scheduled Channel : %s/%s: Failed to find track %d", GetApplicationName(), GetName().CStr(), track_id);
-                ::av_packet_unref(&packet);
                 continue;
             }
 
@@ -558,15 +831,15 @@ namespace pvd
 			switch (track->GetCodecId())
 			{
 				case cmn::MediaCodecId::H264:
-					bitstream_format = (is_mpegts) ? cmn::BitstreamFormat::H264_ANNEXB : cmn::BitstreamFormat::H264_AVCC;
+					bitstream_format = (playback.is_mpegts) ? cmn::BitstreamFormat::H264_ANNEXB : cmn::BitstreamFormat::H264_AVCC;
 					packet_type = cmn::PacketType::NALU;
 					break;
 				case cmn::MediaCodecId::H265:
-					bitstream_format = (is_mpegts) ? cmn::BitstreamFormat::H265_ANNEXB : cmn::BitstreamFormat::HVCC;
+					bitstream_format = (playback.is_mpegts) ? cmn::BitstreamFormat::H265_ANNEXB : cmn::BitstreamFormat::HVCC;
 					packet_type = cmn::PacketType::NALU;
 					break;
 				case cmn::MediaCodecId::Aac:
-					bitstream_format = (is_mpegts) ? cmn::BitstreamFormat::AAC_ADTS : cmn::BitstreamFormat::AAC_RAW;
+					bitstream_format = (playback.is_mpegts) ? cmn::BitstreamFormat::AAC_ADTS : cmn::BitstreamFormat::AAC_RAW;
 					packet_type = cmn::PacketType::RAW;
 					break;
 				case cmn::MediaCodecId::Opus:
@@ -579,37 +852,31 @@ namespace pvd
                     break;
 				default:
                     logtw("Scheduled Channel : %s/%s: Unsupported codec %s", GetApplicationName(), GetName().CStr(), cmn::GetCodecIdString(track->GetCodecId()));
-					::av_packet_unref(&packet);
 					continue;
 			}
 
-			auto media_packet = ffmpeg::compat::ToMediaPacket(GetMsid(), track->GetId(), &packet, track->GetMediaType(), bitstream_format, packet_type);
+			auto media_packet = ffmpeg::compat::ToMediaPacket(GetMsid(), track->GetId(), packet, track->GetMediaType(), bitstream_format, packet_type);
 
             // Convert to fixed time base
-            auto origin_tb = context->streams[packet.stream_index]->time_base;
+            auto origin_tb = context->streams[packet->stream_index]->time_base;
 
-            ::av_packet_unref(&packet);
+            av_packet.reset();
 
             auto pts = media_packet->GetPts();
             auto dts = media_packet->GetDts();
             auto duration = media_packet->GetDuration();
-			
-            // origin timebase to track timebase
-            // pts = static_cast<double>(pts) * (static_cast<double>(origin_tb.num) / static_cast<double>(origin_tb.den) * track->GetTimeBase().GetTimescale());
-            // dts = static_cast<double>(dts) * (static_cast<double>(origin_tb.num) / static_cast<double>(origin_tb.den) * track->GetTimeBase().GetTimescale());
-            // duration = static_cast<double>(duration) * (static_cast<double>(origin_tb.num) / static_cast<double>(origin_tb.den) * track->GetTimeBase().GetTimescale());
 
 			pts = Rescale(pts, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
 			dts = Rescale(dts, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
 			duration = Rescale(duration, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
 
-            if (track_first_packet_map.find(track_id) == track_first_packet_map.end())
+            if (playback.track_first_packet_map.find(track_id) == playback.track_first_packet_map.end())
             {
-                track_first_packet_map[track_id] = true;
-                track_single_file_dts_offset_map[track_id] = dts;
+                playback.track_first_packet_map[track_id] = true;
+                playback.track_single_file_dts_offset_map[track_id] = dts;
             }
-            auto single_file_dts = dts - track_single_file_dts_offset_map[track_id];
-           
+            auto single_file_dts = dts - playback.track_single_file_dts_offset_map[track_id];
+
             AdjustTimestampByBase(track_id, pts, dts, std::numeric_limits<int64_t>::max(), duration);
 			logtd("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %lld, pts %lld, dts %lld, duration %lld, tb %f", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, duration, track->GetTimeBase().GetExpr());
 
@@ -637,6 +904,7 @@ namespace pvd
             logtd("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %lld, pts %lld, dts %lld, duration %lld, tb %f, dts_ms %f, dts_gap %lld", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, duration, track->GetTimeBase().GetExpr(), time_ms, dts_gap);
 
             SendFrame(media_packet);
+            ObserveTransitionGap();
 
             _last_packet_map[track_id] = media_packet;
 
@@ -671,25 +939,23 @@ namespace pvd
                 {
                     // End of item
                     logti("Scheduled Channel : %s/%s: End of item (Current Pos : %.0f ms Duration : %lld ms). Try to play next item", GetApplicationName(), GetName().CStr(), single_file_duration_ms, item->_duration_ms);
-                    result = PlaybackResult::PLAY_NEXT_ITEM;
-                    break;
+                    return PlaybackResult::PLAY_NEXT_ITEM;
                 }
             }
-            
+
+            // The next packet is read when the realtime clock reaches the DTS of this packet
             int64_t elapsed = _realtime_clock.ElapsedUs();
             if (elapsed < global_zero_based_dts)
             {
-                int64_t wait_time = global_zero_based_dts - elapsed;
-                // logti("Scheduled Channel : %s/%s: Track(%d) Current(%lld) DTS(%lld) Wait(%lld)", GetApplicationName(), GetName().CStr(), track_id, elapsed, global_zero_based_dts, wait_time);
-                std::this_thread::sleep_for(std::chrono::microseconds(wait_time));
+                playback.deadline = Clock::now() + std::chrono::microseconds(global_zero_based_dts - elapsed);
+                next_deadline = playback.deadline;
+                return std::nullopt;
             }
         }
 
-        _current_item_position_ms = 0;
-
-        logti("Scheduled Channel : %s/%s: Playback stopped", GetApplicationName(), GetName().CStr());
-
-        return result;
+        // Catching up, let the other channels run in between
+        next_deadline = Clock::now();
+        return std::nullopt;
     }
 
     bool ScheduledStream::CheckFileItemAvailable(const std::shared_ptr<Schedule::Item> &item)
@@ -766,9 +1032,9 @@ namespace pvd
 		return duration_ms;
 	}
 
-    bool ScheduledStream::PrepareFilePlayback(const std::shared_ptr<Schedule::Item> &item)
+    bool ScheduledStream::PrepareFilePlayback(const std::shared_ptr<Schedule::Item> &item, const std::shared_ptr<AVFormatContext> &context)
     {
-		if (item == nullptr || item->LoadContext() == nullptr)
+		if (item == nullptr || context == nullptr)
 		{
 			logte("%s/%s: Format context is null for file %s", GetApplicationName(), GetName().CStr(), item->_file_path.CStr());
 			return false;
@@ -780,14 +1046,14 @@ namespace pvd
 		uint32_t audio_index = 0;
         int64_t total_duration_ms = 0;
         _origin_id_track_id_map.clear();
-        for (uint32_t track_id = 0; track_id < item->LoadContext()->nb_streams; track_id++)
+        for (uint32_t track_id = 0; track_id < context->nb_streams; track_id++)
         {
             if (video_track_needed == false && audio_track_needed == false)
             {
                 break;
             }
 
-            auto stream = item->LoadContext()->streams[track_id];
+            auto stream = context->streams[track_id];
             if (stream == nullptr)
             {
                 continue;
@@ -887,22 +1153,7 @@ namespace pvd
             item->_duration_ms = total_duration_ms;
         }
 
-        // Seek to start position
-        if (item->_start_time_ms >= 0)
-        {
-			// if stream_index is -1, in AV_TIME_BASE units
-			// #define AV_TIME_BASE 1000000
-            int64_t seek_target = item->_start_time_ms * 1000; // Convert to microseconds
-            int64_t seek_min = 0;
-            int64_t seek_max = total_duration_ms * 1000;
-
-            int seek_ret = ::avformat_seek_file(item->LoadContext().get(), -1, seek_min, seek_target, seek_max, 0);
-            if (seek_ret < 0)
-            {
-                logte("%s/%s: Failed to seek to start position %d, err:%d", GetApplicationName(), GetName().CStr(), item->_start_time_ms, seek_ret);
-            }
-        }
-
+        // PlayoutItemLoader has already seeked to the start position
 		logti("Scheduled Channel : %s/%s: File %s prepared. Start time %lld ms, Duration %lld ms",
 			GetApplicationName(), GetName().CStr(), item->_file_path.CStr(), item->_start_time_ms, item->_duration_ms);
 
@@ -915,76 +1166,53 @@ namespace pvd
         return true;
     }
 
-    ScheduledStream::PlaybackResult ScheduledStream::PlayStream(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    std::optional<ScheduledStream::PlaybackResult> ScheduledStream::ContinueStreamPlayback(Clock::time_point &next_deadline)
     {
-        logti("Scheduled Channel : %s/%s: Play stream %s", GetApplicationName(), GetName().CStr(), item->_url.CStr());
-
-        ScheduledStream::PlaybackResult result = PlaybackResult::PLAY_NEXT_ITEM;
+        auto &playback = *_playback;
+        const auto &item = playback.item;
+        const auto &stream_tap = playback.stream_tap;
 
-        auto stream_tap = PrepareStreamPlayback(item);
-        if (stream_tap == nullptr)
-        {
-            logte("Scheduled Channel : %s/%s: Failed to prepare stream playback. Try to play next item", GetApplicationName(), GetName().CStr());
-            return PlaybackResult::ERROR;
-        }
-
-        if (_realtime_clock.IsStart() == false)
-        {
-            _realtime_clock.Start();
-        }
-
-        if (_realtime_clock.IsPaused() == true)
-        {
-            _realtime_clock.Resume();
-        }
-
-        std::map<int, bool> track_first_packet_map;
-        std::map<int, int64_t> track_single_file_dts_offset_map;
-        std::map<int, bool> end_of_track_map;
-
-		// bool sent_keyframe = false;
-
-        // Play
-        while (_worker_thread_running)
+        for (int count = 0; count < kScheduledMaxPacketsPerPlayout; count++)
         {
             if (CheckCurrentProgramChanged() == true)
             {
-                result = PlaybackResult::PLAY_NEXT_PROGRAM;
-                break;
+                return PlaybackResult::PLAY_NEXT_PROGRAM;
             }
 
-            if (fallback_item)
+            if (playback.fallback_item)
             {
                 if (CheckCurrentItemAvailable() == true)
                 {
-                    result = PlaybackResult::FAILBACK;
-                    break;
+                    return PlaybackResult::FAILBACK;
                 }
             }
-			
-            auto media_packet = stream_tap->Pop(_channel_info._error_tolerance_duration_ms);
+
+            auto media_packet = stream_tap->Pop();
             if (media_packet == nullptr)
             {
-                if (CheckCurrentProgramChanged() == true)
+                auto elapsed_ms = playback.pop_clock.Elapsed();
+                if ((stream_tap->GetState() == MediaRouterStreamTap::State::Tapped) &&
+                    (elapsed_ms < _channel_info._error_tolerance_duration_ms))
                 {
-                    result = PlaybackResult::PLAY_NEXT_PROGRAM;
-                    break;
+                    // The tap wakes this up when a packet is pushed
+                    next_deadline = Clock::now() + std::chrono::milliseconds(_channel_info._error_tolerance_duration_ms - elapsed_ms);
+                    return std::nullopt;
+                }
+
+                if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
+                {
+                    logtw("Scheduled Channel : %s/%s: Failed to pop packet until %d ms. Try to play next item", GetApplicationName(), GetName().CStr(), _channel_info._error_tolerance_duration_ms);
                 }
                 else
                 {
-					if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
-					{
-                    	logtw("Scheduled Channel : %s/%s: Failed to pop packet until %d ms. Try to play next item", GetApplicationName(), GetName().CStr(), _channel_info._error_tolerance_duration_ms);
-					}
-					else
-					{
-						logtw("Scheduled Channel : %s/%s: Stream tap state is %d. Try to play next item", GetApplicationName(), GetName().CStr(), static_cast<int>(stream_tap->GetState()));
-					}
-                    result = PlaybackResult::ERROR;
-                    break;
+                    logtw("Scheduled Channel : %s/%s: Stream tap state is %d. Try to play next item", GetApplicationName(), GetName().CStr(), static_cast<int>(stream_tap->GetState()));
                 }
+
+                return PlaybackResult::ERROR;
             }
-			
+
+            playback.pop_clock.Restart();
+
 			auto origin_track_id = media_packet->GetTrackId();
             auto track_id = FindTrackIdByOriginId(origin_track_id);
             if (track_id < 0)
@@ -993,6 +1221,7 @@ namespace pvd
                 continue;
             }
 
+            auto &end_of_track_map = playback.end_of_track_map;
             if (end_of_track_map.find(track_id) != end_of_track_map.end())
             {
                 // End of track
@@ -1006,27 +1235,6 @@ namespace pvd
                 end_of_track_map[track_id] = false;
             }
 
-            // Transcoder will make bogus frame if it can't be decoded
-			// if (GetRepresentationType() == StreamRepresentationType::Relay && sent_keyframe == false)
-            // {
-			// 	if (media_packet->GetMediaType() == cmn::MediaType::Video)
-			// 	{
-			// 		if (media_packet->GetFlag() != MediaPacketFlag::Key)
-			// 		{
-			// 			// Skip until key frame
-			// 			continue;
-			// 		}
-			// 		else
-			// 		{
-			// 			sent_keyframe = true;
-			// 		}
-			// 	}
-			// 	else 
-			// 	{
-			// 		continue; // Skip until key frame
-			// 	}
-			// }
-
             auto track = GetTrack(track_id);
             if (track == nullptr)
             {
@@ -1041,11 +1249,6 @@ namespace pvd
             auto dts = media_packet->GetDts();
             auto duration = media_packet->GetDuration();
 
-            // origin timebase to track timebase
-            //pts = (((double)pts * (double)origin_tb.GetNum()) / (double)origin_tb.GetDen()) * track->GetTimeBase().GetTimescale();
-            //dts = (((double)dts * (double)origin_tb.GetNum()) / (double)origin_tb.GetDen()) * track->GetTimeBase().GetTimescale();
-			//duration = static_cast<double>(duration) * (static_cast<double>(origin_tb.GetNum()) / static_cast<double>(origin_tb.GetDen()) * track->GetTimeBase().GetTimescale());
-			
 			// origin timebase to track timebase
 			pts = Rescale(pts, track->GetTimeBase().GetDen() * origin_tb.GetNum(), origin_tb.GetDen() * track->GetTimeBase().GetNum());
 			dts = Rescale(dts, track->GetTimeBase().GetDen() * origin_tb.GetNum(), origin_tb.GetDen() * track->GetTimeBase().GetNum());
@@ -1053,12 +1256,12 @@ namespace pvd
 
 			logtd("Scheduled Channel : %s/%s: Track %d, origin dts : %lld, pts %lld, dts %lld, duration %lld, tb %f", GetApplicationName(), GetName().CStr(), track_id, dts, pts, dts, duration, track->GetTimeBase().GetExpr());
 
-            if (track_first_packet_map.find(track_id) == track_first_packet_map.end())
+            if (playback.track_first_packet_map.find(track_id) == playback.track_first_packet_map.end())
             {
-                track_first_packet_map[track_id] = true;
-                track_single_file_dts_offset_map[track_id] = dts;
+                playback.track_first_packet_map[track_id] = true;
+                playback.track_single_file_dts_offset_map[track_id] = dts;
             }
-            auto single_file_dts = dts - track_single_file_dts_offset_map[track_id];
+            auto single_file_dts = dts - playback.track_single_file_dts_offset_map[track_id];
 
             AdjustTimestampByBase(track_id, pts, dts, std::numeric_limits<int64_t>::max(), duration);
 
@@ -1078,6 +1281,7 @@ namespace pvd
             logtd("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %lld, pts %lld, dts %lld, tb %f, dts_ms %f", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, track->GetTimeBase().GetExpr(), time_ms);
 
             SendFrame(media_packet);
+            ObserveTransitionGap();
 
             // dts to real time (ms)
             auto single_file_dts_ms = static_cast<double>(single_file_dts) * track->GetTimeBase().GetExpr() * static_cast<double>(1000);
@@ -1109,19 +1313,14 @@ namespace pvd
                 {
                     // End of item
                     logti("Scheduled Channel : %s/%s: End of item (Current Pos : %.0f ms Duration : %lld ms). Try to play next item", GetApplicationName(), GetName().CStr(), single_file_dts_ms, item->_duration_ms);
-                    result = PlaybackResult::PLAY_NEXT_ITEM;
-                    break;
+                    return PlaybackResult::PLAY_NEXT_ITEM;
                 }
             }
         }
 
-        _current_item_position_ms = 0;
-
-        ocst::Orchestrator::GetInstance()->UnmirrorStream(stream_tap);
-
-        logti("Scheduled Channel : %s/%s: Playback stopped", GetApplicationName(), GetName().CStr());
-
-        return result;
+        // More packets may be buffered in the tap
+        next_deadline = Clock::now();
+        return std::nullopt;
     }
 
     bool ScheduledStream::CheckStreamItemAvailable(const std::shared_ptr<Schedule::Item> &item)
@@ -1210,6 +1409,11 @@ namespace pvd
 
         auto vhost_app_name = info::VHostAppName(stream_url->Host(), stream_url->App());
 
+        // Called in the thread of MediaRouter, and cleared in FinishPlayback()
+        stream_tap->SetReadyCallback([playout_key = _playout_key]() {
+            PlayoutScheduler::GetInstance()->Wakeup(playout_key);
+        });
+
         auto result = ocst::Orchestrator::GetInstance()->MirrorStream(stream_tap, vhost_app_name, stream_url->Stream(), MediaRouterInterface::MirrorPosition::Inbound);
         if (result != CommonErrorCode::SUCCESS)
         {
@@ -13,6 +13,11 @@
 #include <mediarouter/mediarouter_stream_tap.h>
 #include <base/provider/stream.h>
 
+#include <base/ovlibrary/histogram.h>
+
+#include "playout_file_reader.h"
+#include "playout_item_loader.h"
+#include "playout_scheduler.h"
 #include "schedule.h"
 
 namespace pvd
@@ -25,7 +30,16 @@ namespace pvd
     constexpr int kScheduledVideoTimebase = 90000;
 	constexpr int kScheduledAudioTimebase = 90000;
 
-    class ScheduledStream : public Stream
+    // The maximum number of packets sent at once (e.g. catching up after a stall), before yielding to the other channels
+    constexpr int kScheduledMaxPacketsPerPlayout = 64;
+    // How often the state is checked while waiting for the file reader
+    constexpr int kScheduledReaderWaitIntervalMs = 100;
+    // The number of the next file items opened (and read ahead) while playing an item
+    constexpr size_t kScheduledPreloadItemCount = 2;
+
+    // The channel is driven by the PlayoutScheduler: OnPlayout() resumes the schedule from where it was,
+    // sends the packets that are due, and returns when it should be called again.
+    class ScheduledStream : public Stream, public PlayoutTask
     {
     public:
         static std::shared_ptr<ScheduledStream> Create(const std::shared_ptr<Application> &application, const info::Stream &stream_info, const std::shared_ptr<Schedule> &schedule);
@@ -43,9 +57,10 @@ namespace pvd
         // Get current program
         bool GetCurrentProgram(std::shared_ptr<Schedule::Program> &curr_program, std::shared_ptr<Schedule::Item> &curr_item, int64_t &curr_item_pos) const;
 
-    private:
-        void WorkerThread();
+        // PlayoutTask
+        Clock::time_point OnPlayout() override;
 
+    private:
         enum class PlaybackResult
         {
             PLAY_NEXT_ITEM,
@@ -54,27 +69,70 @@ namespace pvd
             FAILBACK
         };
 
-        // If there is no current program
-        //      ==> Continue playing until the current program changes
-        // If there is no current item
-        //      ==> Continue playing until the current program changes (in cases where there is no item, this might occur later in the case of non-repeat programs)
-        // If the current item encounters an error
-        //      ==> Continue playing until the item returns to a normal state, or until the duration of the item ends, or until the current program changes
-
-        // If there is an error in the fallback
-        //     ==> Keep attempting
-        // If the fallback ends (program change, item change, item duration ends)
-        //     ==> return true
-        // If there is no fallback (not configured)
-        //     ==> return false
-        PlaybackResult PlayFallbackOrWait();
+        // Where the channel is in the schedule
+        enum class PlayoutState
+        {
+            // Waits for a schedule, and selects the current program (or plays the fallback program if there is none)
+            SelectProgram,
+            // Selects the next item of the current program
+            SelectItem,
+            // Plays the current item again, after it becomes available while playing the fallback program
+            RetryItem,
+            // Plays the items of the fallback program
+            Fallback
+        };
 
-        PlaybackResult PlayItem(const std::shared_ptr<Schedule::Item> &item, bool fallback_item = false);
+        // The item being played
+        struct Playback
+        {
+            std::shared_ptr<Schedule::Item> item;
+            bool fallback_item = false;
+
+            // File
+            std::shared_ptr<PlayoutItemLoader> loader;
+            // Set when the loader is finished
+            std::shared_ptr<AVFormatContext> context;
+            std::shared_ptr<PlayoutFileReader> reader;
+            bool is_mpegts = false;
+            // When the next packet should be sent
+            Clock::time_point deadline = PlayoutTask::Never;
+
+            // Stream
+            std::shared_ptr<MediaRouterStreamTap> stream_tap;
+            // The time since the last packet is popped
+            ov::StopWatch pop_clock;
+
+            std::map<int, bool> track_first_packet_map;
+            std::map<int, int64_t> track_single_file_dts_offset_map;
+            std::map<int, bool> end_of_track_map;
+        };
 
-        PlaybackResult PlayFile(const std::shared_ptr<Schedule::Item> &item, bool fallback_item);
-        bool PrepareFilePlayback(const std::shared_ptr<Schedule::Item> &item);
-        
-        PlaybackResult PlayStream(const std::shared_ptr<Schedule::Item> &item, bool fallback_item);
+        // Advances the state by a step. Returns when OnPlayout() should be called again if it needs to wait,
+        // or std::nullopt to continue (e.g. an item has started).
+        std::optional<Clock::time_point> RunSchedule();
+        std::optional<Clock::time_point> SelectProgram();
+        std::optional<Clock::time_point> SelectItem();
+        std::optional<Clock::time_point> RunFallback();
+
+        void EnterFallback(bool retry_item);
+        void ExitFallback(PlaybackResult result);
+
+        void StartItem(const std::shared_ptr<Schedule::Item> &item, bool fallback_item);
+        bool StartPlayback(const std::shared_ptr<Schedule::Item> &item, bool fallback_item);
+        // Returns the result if the playback is finished, or sets next_deadline
+        std::optional<PlaybackResult> ContinueFilePlayback(Clock::time_point &next_deadline);
+        std::optional<PlaybackResult> ContinueStreamPlayback(Clock::time_point &next_deadline);
+        void FinishPlayback();
+        void OnPlaybackFinished(bool fallback_item, PlaybackResult result);
+        void ObserveTransitionGap();
+
+        // Keeps loading the next file items of the program
+        void UpdatePreloads(const std::shared_ptr<Schedule::Program> &program);
+        // Returns the loader of the item (loaded or being loaded), or starts loading it
+        std::shared_ptr<PlayoutItemLoader> TakePreload(const std::shared_ptr<Schedule::Item> &item);
+        void StopPreloads();
+
+        bool PrepareFilePlayback(const std::shared_ptr<Schedule::Item> &item, const std::shared_ptr<AVFormatContext> &context);
         std::shared_ptr<MediaRouterStreamTap> PrepareStreamPlayback(const std::shared_ptr<Schedule::Item> &item);
         
         std::shared_ptr<Schedule> GetSchedule() const;
@@ -93,10 +151,37 @@ namespace pvd
         std::shared_ptr<Schedule> _schedule;
         mutable std::shared_mutex _schedule_mutex;
 
-        std::thread _worker_thread;
-        bool _worker_thread_running = false;
+        uint64_t _playout_key = 0;
+        std::atomic<bool> _playout_running{false};
 
-        mutable ov::Event _schedule_updated;
+        std::atomic<bool> _schedule_updated{false};
+
+        // If there is no current program
+        //      ==> Play the fallback program until the current program changes
+        // If the current item encounters an error (and _fallback_on_err is set)
+        //      ==> Play the fallback program until the item returns to a normal state, or until the current program changes
+        // If there is an error in the fallback
+        //     ==> Keep attempting
+        PlayoutState _playout_state = PlayoutState::SelectProgram;
+        bool _first_item = true;
+        // Whether to play the current item again when the fallback program is finished
+        bool _fallback_retry_item = false;
+        bool _fallback_first_item = true;
+        PlaybackResult _fallback_result = PlaybackResult::PLAY_NEXT_ITEM;
+        // Waiting in the current state (until the schedule is updated)
+        Clock::time_point _wait_until = Clock::time_point::min();
+
+        std::unique_ptr<Playback> _playback;
+        // The next file items, in the order they will be played
+        std::vector<std::shared_ptr<PlayoutItemLoader>> _preload_list;
+
+        // The labels of the histograms of the channel in the HistogramRegistry
+        ov::String _histogram_labels;
+        // The delay of the packets from their deadlines
+        std::shared_ptr<ov::Histogram> _pacing_error_histogram;
+        // The time from the end of an item to the first packet of the next item
+        std::shared_ptr<ov::Histogram> _transition_gap_histogram;
+        Clock::time_point _transition_start = Clock::time_point::min();
 
         // Current
         const Schedule::Stream _channel_info;
@@ -0,0 +1,185 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "file_fmp4_writer.h"
+
+#include "file_private.h"
+
+// The duration of a fragment of the recording file
+#define FILE_FMP4_CHUNK_DURATION_MS 2000.0
+#define FILE_FMP4_SEGMENT_DURATION_MS 6000
+// The fragments are written as they are made, so the storage keeps only a few segments
+#define FILE_FMP4_MAX_SEGMENTS 2
+
+namespace pub
+{
+	FileFmp4Writer::FileFmp4Writer(const std::shared_ptr<FileOutput> &output, const ov::String &stream_tag)
+		: _output(output),
+		  _stream_tag(stream_tag)
+	{
+	}
+
+	FileFmp4Writer::~FileFmp4Writer()
+	{
+		logtd("FileFmp4Writer has been terminated finally");
+	}
+
+	void FileFmp4Writer::SetTimestampMode(ffmpeg::Writer::TimestampMode mode)
+	{
+		_timestamp_mode = mode;
+	}
+
+	bool FileFmp4Writer::AddTrack(const std::shared_ptr<MediaTrack> &media_track)
+	{
+		if (_track != nullptr)
+		{
+			logtw("The fMP4 writer records a single track. track(%d) is ignored", media_track->GetId());
+			return false;
+		}
+
+		_track = media_track;
+
+		return true;
+	}
+
+	bool FileFmp4Writer::Start()
+	{
+		if (_track == nullptr)
+		{
+			logte("There is no track to record. path(%s)", _output->GetPath().CStr());
+			return false;
+		}
+
+		bmff::FMP4Storage::Config storage_config;
+		storage_config.max_segments = FILE_FMP4_MAX_SEGMENTS;
+		storage_config.segment_duration_ms = FILE_FMP4_SEGMENT_DURATION_MS;
+
+		bmff::FMP4Packager::Config packager_config;
+		packager_config.chunk_duration_ms = FILE_FMP4_CHUNK_DURATION_MS;
+		packager_config.segment_duration_ms = FILE_FMP4_SEGMENT_DURATION_MS;
+
+		_storage = std::make_shared<bmff::FMP4Storage>(bmff::FMp4StorageObserver::GetSharedPtr(), _track, storage_config, _stream_tag);
+		_packager = std::make_shared<bmff::FMP4Packager>(_storage, _track, nullptr, packager_config);
+
+		_start_timestamp.reset();
+		_written_bytes = 0;
+		_write_failed = false;
+
+		// The initialization segment is written in OnFMp4StorageInitialized()
+		if ((_packager->CreateInitializationSegment() == false) || _write_failed)
+		{
+			logte("Could not create the initialization segment. track(%d), path(%s)", _track->GetId(), _output->GetPath().CStr());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FileFmp4Writer::Stop()
+	{
+		bool result = true;
+
+		if (_packager != nullptr)
+		{
+			result = _packager->Flush() && (_write_failed == false);
+		}
+
+		// The storage refers to this as the observer
+		_packager = nullptr;
+		_storage = nullptr;
+
+		return result;
+	}
+
+	bool FileFmp4Writer::SendPacket(const std::shared_ptr<MediaPacket> &packet, uint64_t *sent_bytes)
+	{
+		if ((_packager == nullptr) || (packet == nullptr))
+		{
+			return false;
+		}
+
+		if (packet->GetTrackId() != _track->GetId())
+		{
+			return true;
+		}
+
+		if (_start_timestamp.has_value() == false)
+		{
+			_start_timestamp = (_timestamp_mode == ffmpeg::Writer::TIMESTAMP_STARTZERO_MODE) ? packet->GetDts() : 0LL;
+		}
+
+		auto sample = packet;
+
+		if (_start_timestamp.value() != 0LL)
+		{
+			sample = packet->ClonePacket();
+			sample->SetPts(packet->GetPts() - _start_timestamp.value());
+			sample->SetDts(packet->GetDts() - _start_timestamp.value());
+		}
+
+		if (sample->GetDts() < 0)
+		{
+			logtw("To avoid negative timestamps, the packet is dropped. track:%d, pts:%lld, dts:%lld", _track->GetId(), sample->GetPts(), sample->GetDts());
+			return true;
+		}
+
+		auto written_bytes = _written_bytes;
+
+		// The fragments are written in OnMediaChunkUpdated()
+		if ((_packager->AppendSample(sample) == false) || _write_failed)
+		{
+			logte("Could not append the sample. track(%d), path(%s)", _track->GetId(), _output->GetPath().CStr());
+			return false;
+		}
+
+		if (sent_bytes != nullptr)
+		{
+			*sent_bytes = _written_bytes - written_bytes;
+		}
+
+		return true;
+	}
+
+	void FileFmp4Writer::OnFMp4StorageInitialized(const int32_t &track_id)
+	{
+		WriteData(_storage->GetInitializationSection());
+	}
+
+	void FileFmp4Writer::OnMediaSegmentCreated(const int32_t &track_id, const uint32_t &segment_number)
+	{
+	}
+
+	void FileFmp4Writer::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number, bool last_chunk)
+	{
+		auto chunk = _storage->GetPartialSegment(segment_number, chunk_number);
+		if (chunk == nullptr)
+		{
+			logte("Could not find the fragment. track(%d), segment(%u), chunk(%u)", track_id, segment_number, chunk_number);
+			_write_failed = true;
+			return;
+		}
+
+		WriteData(chunk->GetData());
+	}
+
+	void FileFmp4Writer::OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number)
+	{
+	}
+
+	bool FileFmp4Writer::WriteData(const std::shared_ptr<const ov::Data> &data)
+	{
+		if ((data == nullptr) || (_output->Write(data->GetData(), data->GetLength()) == false))
+		{
+			_write_failed = true;
+			return false;
+		}
+
+		_written_bytes += data->GetLength();
+
+		return true;
+	}
+}  // namespace pub
@@ -0,0 +1,64 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <modules/containers/bmff/fmp4_packager/fmp4_packager.h>
+#include <modules/ffmpeg/writer.h>
+
+#include "file_output.h"
+
+namespace pub
+{
+	// Records a track to a fragmented MP4 file with the in-tree packager, without libavformat.
+	//
+	// The packager makes a fragment per track (as the renditions of LLHLS), so a file has a single track.
+	// The initialization segment and the fragments are appended to the output as they are made.
+	class FileFmp4Writer : public bmff::FMp4StorageObserver
+	{
+	public:
+		FileFmp4Writer(const std::shared_ptr<FileOutput> &output, const ov::String &stream_tag);
+		~FileFmp4Writer() override;
+
+		void SetTimestampMode(ffmpeg::Writer::TimestampMode mode);
+
+		// Only one track can be added
+		bool AddTrack(const std::shared_ptr<MediaTrack> &media_track);
+
+		bool Start();
+		// Writes the remaining samples
+		bool Stop();
+
+		// The packets of the other tracks are ignored
+		bool SendPacket(const std::shared_ptr<MediaPacket> &packet, uint64_t *sent_bytes = nullptr);
+
+		// FMp4StorageObserver
+		void OnFMp4StorageInitialized(const int32_t &track_id) override;
+		void OnMediaSegmentCreated(const int32_t &track_id, const uint32_t &segment_number) override;
+		void OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number, bool last_chunk) override;
+		void OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number) override;
+
+	private:
+		bool WriteData(const std::shared_ptr<const ov::Data> &data);
+
+		std::shared_ptr<FileOutput> _output;
+		ov::String _stream_tag;
+
+		ffmpeg::Writer::TimestampMode _timestamp_mode = ffmpeg::Writer::TIMESTAMP_STARTZERO_MODE;
+		// Subtracted from the timestamps of the packets
+		std::optional<int64_t> _start_timestamp;
+
+		std::shared_ptr<MediaTrack> _track;
+		std::shared_ptr<bmff::FMP4Storage> _storage;
+		std::shared_ptr<bmff::FMP4Packager> _packager;
+
+		uint64_t _written_bytes = 0;
+		bool _write_failed = false;
+	};
+}  // namespace pub
@@ -0,0 +1,177 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "file_output.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "file_private.h"
+
+namespace pub
+{
+	FileOutput::FileOutput(const std::shared_ptr<ov::Histogram> &write_duration_histogram)
+		: _write_duration_histogram(write_duration_histogram)
+	{
+	}
+
+	FileOutput::~FileOutput()
+	{
+		Close();
+	}
+
+	bool FileOutput::Open(const ov::String &path)
+	{
+		Close();
+
+		void *buffer = nullptr;
+		if (::posix_memalign(&buffer, FILE_OUTPUT_BUFFER_ALIGNMENT, FILE_OUTPUT_BUFFER_SIZE) != 0)
+		{
+			logte("Could not allocate the write buffer. path(%s)", path.CStr());
+			return false;
+		}
+
+		_buffer.reset(static_cast<uint8_t *>(buffer));
+		_buffer_length = 0;
+		_position = 0;
+
+		_fd = ::open(path.CStr(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if (_fd < 0)
+		{
+			logte("Could not open the file. path(%s), error(%s)", path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		_path = path;
+
+		return true;
+	}
+
+	bool FileOutput::Close()
+	{
+		if (_fd < 0)
+		{
+			return true;
+		}
+
+		bool result = Flush();
+
+		if (::close(_fd) != 0)
+		{
+			logte("Could not close the file. path(%s), error(%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			result = false;
+		}
+
+		_fd = -1;
+		_buffer.reset();
+
+		return result;
+	}
+
+	const ov::String &FileOutput::GetPath() const
+	{
+		return _path;
+	}
+
+	bool FileOutput::Write(const void *data, size_t length)
+	{
+		if (_fd < 0)
+		{
+			return false;
+		}
+
+		auto current = static_cast<const uint8_t *>(data);
+
+		while (length > 0)
+		{
+			auto copy_length = std::min(length, FILE_OUTPUT_BUFFER_SIZE - _buffer_length);
+
+			::memcpy(_buffer.get() + _buffer_length, current, copy_length);
+
+			_buffer_length += copy_length;
+			current += copy_length;
+			length -= copy_length;
+
+			if ((_buffer_length == FILE_OUTPUT_BUFFER_SIZE) && (Flush() == false))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	int64_t FileOutput::Seek(int64_t offset, int whence)
+	{
+		if ((_fd < 0) || (Flush() == false))
+		{
+			return -1;
+		}
+
+		auto position = ::lseek(_fd, offset, whence);
+		if (position < 0)
+		{
+			logte("Could not seek the file. path(%s), error(%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return -1;
+		}
+
+		_position = position;
+
+		return position;
+	}
+
+	int64_t FileOutput::GetSize()
+	{
+		if ((_fd < 0) || (Flush() == false))
+		{
+			return -1;
+		}
+
+		struct stat file_stat;
+		if (::fstat(_fd, &file_stat) != 0)
+		{
+			return -1;
+		}
+
+		return file_stat.st_size;
+	}
+
+	bool FileOutput::Flush()
+	{
+		size_t written = 0;
+
+		auto start = std::chrono::steady_clock::now();
+
+		while (written < _buffer_length)
+		{
+			auto result = ::write(_fd, _buffer.get() + written, _buffer_length - written);
+			if (result < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				logte("Could not write the file. path(%s), error(%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+				return false;
+			}
+
+			written += result;
+		}
+
+		if ((_buffer_length > 0) && (_write_duration_histogram != nullptr))
+		{
+			_write_duration_histogram->Observe(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+		}
+
+		_position += _buffer_length;
+		_buffer_length = 0;
+
+		return true;
+	}
+}  // namespace pub
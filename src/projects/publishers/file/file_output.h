@@ -0,0 +1,56 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/histogram.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+// The size of the write buffer of a recording file. The file is written in units of this size.
+#define FILE_OUTPUT_BUFFER_SIZE (1024 * 1024)
+// The alignment of the write buffer (the page size of most of the file systems)
+#define FILE_OUTPUT_BUFFER_ALIGNMENT 4096
+
+namespace pub
+{
+	// A recording file that collects the small writes of the muxer, and writes them to the disk with large aligned writes.
+	//
+	// It is used in the file I/O worker threads, so it is not thread-safe.
+	class FileOutput
+	{
+	public:
+		// write_duration_histogram: Observes the duration of each write to the disk in microseconds (nullable)
+		FileOutput(const std::shared_ptr<ov::Histogram> &write_duration_histogram);
+		~FileOutput();
+
+		bool Open(const ov::String &path);
+		bool Close();
+
+		const ov::String &GetPath() const;
+
+		bool Write(const void *data, size_t length);
+		// whence: SEEK_SET, SEEK_CUR or SEEK_END. Returns the new position, or -1 on failure
+		int64_t Seek(int64_t offset, int whence);
+		// Returns the size of the file including the buffered data, or -1 on failure
+		int64_t GetSize();
+
+	private:
+		// Writes the buffered data to the disk
+		bool Flush();
+
+		std::shared_ptr<ov::Histogram> _write_duration_histogram;
+
+		ov::String _path;
+		int _fd = -1;
+
+		std::unique_ptr<uint8_t, decltype(&::free)> _buffer{nullptr, &::free};
+		size_t _buffer_length = 0;
+
+		// The position of the file where the buffer starts
+		int64_t _position = 0;
+	};
+}  // namespace pub
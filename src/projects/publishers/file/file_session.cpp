@@ -9,15 +9,30 @@
 #include <config/config.h>
 #include <modules/ffmpeg/compat.h>
 #include <modules/ffmpeg/writer.h>
+#include <monitoring/histogram_registry.h>
 
+#include <future>
 #include <regex>
 
 #include "file_export.h"
 #include "file_private.h"
 #include "file_macro.h"
 
+// The number of threads that write the recording files
+#define FILE_IO_WORKER_COUNT 4
+
 namespace pub
 {
+	// Writes the recording files in dedicated threads, so a slow disk (or a network file system)
+	// doesn't stall the stream workers and the other sessions of the stream.
+	// The queued writes are completed before the threads are stopped.
+	static ov::ShardedWorkerPool &GetFileIoWorkerPool()
+	{
+		static ov::ShardedWorkerPool worker_pool("FileIO", FILE_IO_WORKER_COUNT, true);
+
+		return worker_pool;
+	}
+
 	std::shared_ptr<FileSession> FileSession::Create(const std::shared_ptr<pub::Application> &application,
 													 const std::shared_ptr<pub::Stream> &stream,
 													 uint32_t session_id)
@@ -34,12 +49,15 @@ namespace pub
 		: pub::Session(session_info, application, stream),
 		  _writer(nullptr)
 	{
+		_io_key = GetFileIoWorkerPool().IssueKey();
+
 		MonitorInstance->OnSessionConnected(*stream, PublisherType::File);
 	}
 
 	FileSession::~FileSession()
 	{
 		logtd("FileSession(%d) has been terminated finally", GetId());
+		RemoveHistograms();
 		MonitorInstance->OnSessionDisconnected(*GetStream(), PublisherType::File);
 	}
 
@@ -47,6 +65,35 @@ namespace pub
 	{
 		_is_splitting.store(false);
 
+		auto record = GetRecord();
+		if (record != nullptr)
+		{
+			const auto &vhost_app_name = GetStream()->GetApplicationInfo().GetVHostAppName();
+			_histogram_labels = ov::String::FormatString("vhost=\"%s\",app=\"%s\",stream=\"%s\",record=\"%s\"",
+												   mon::HistogramRegistry::EscapeLabelValue(vhost_app_name.GetVHostName()).CStr(),
+												   mon::HistogramRegistry::EscapeLabelValue(vhost_app_name.GetAppName()).CStr(),
+												   mon::HistogramRegistry::EscapeLabelValue(GetStream()->GetName()).CStr(),
+												   mon::HistogramRegistry::EscapeLabelValue(record->GetId()).CStr());
+
+			_write_duration_histogram = mon::HistogramRegistry::GetInstance()->Get(
+				"ome_file_record_write_duration_microseconds",
+				"Duration of the writes of the recording files to the disk",
+				_histogram_labels);
+			_write_latency_histogram = mon::HistogramRegistry::GetInstance()->Get(
+				"ome_file_record_write_latency_microseconds",
+				"Time from when a packet is queued for the recording to when it is written",
+				_histogram_labels);
+			_backlog_histogram = mon::HistogramRegistry::GetInstance()->Get(
+				"ome_file_record_backlog_bytes",
+				"Size of the packets waiting to be written when a packet is queued for the recording",
+				_histogram_labels);
+		}
+
+		{
+			std::lock_guard lock_guard(_packet_queue_mutex);
+			_dropping = false;
+		}
+
 		if (StartRecord() == false)
 		{
 			logte("Failed to start recording. id(%d)", GetId());
@@ -61,7 +108,21 @@ namespace pub
 
 	bool FileSession::Stop()
 	{
-		if (StopRecord() == false)
+		// The queued packets are written, and the file is closed in the I/O thread
+		std::promise<bool> stopped;
+		auto stopped_future = stopped.get_future();
+
+		auto self = GetSharedPtrAs<FileSession>();
+		bool posted = GetFileIoWorkerPool().Post(_io_key, [self, &stopped]() {
+			self->WritePackets();
+			stopped.set_value(self->StopRecord());
+		});
+
+		bool result = posted ? stopped_future.get() : StopRecord();
+
+		RemoveHistograms();
+
+		if (result == false)
 		{
 			logte("Failed to stop recording. id(%d)", GetId());
 
@@ -73,6 +134,22 @@ namespace pub
 		return Session::Stop();
 	}
 
+	void FileSession::RemoveHistograms()
+	{
+		if (_histogram_labels.IsEmpty())
+		{
+			return;
+		}
+
+		auto histogram_registry = mon::HistogramRegistry::GetInstance();
+
+		histogram_registry->Remove("ome_file_record_write_duration_microseconds", _histogram_labels);
+		histogram_registry->Remove("ome_file_record_write_latency_microseconds", _histogram_labels);
+		histogram_registry->Remove("ome_file_record_backlog_bytes", _histogram_labels);
+
+		_histogram_labels.Clear();
+	}
+
 	bool FileSession::Split()
 	{
 		if (StopRecord() == false)
@@ -123,8 +200,9 @@ namespace pub
 			return false;
 		}
 
-		auto writer = CreateWriter();
-		if (writer == nullptr)
+		// The file is written in the I/O thread through the output
+		auto output = CreateOutput(ov::PathManager::Combine(GetRootPath(), record->GetTmpPath()));
+		if (output == nullptr)
 		{
 			SetState(SessionState::Error);
 			record->SetState(info::Record::RecordState::Error);
@@ -132,7 +210,49 @@ namespace pub
 			return false;
 		}
 
-		if (writer->SetUrl(ov::PathManager::Combine(GetRootPath(), record->GetTmpPath()), output_format) == false)
+		// The mode to specify the initial value of the timestamp stored in the file to zero,
+		// or keep it at the same value as the source timestamp
+		auto timestamp_mode = ffmpeg::Writer::TIMESTAMP_STARTZERO_MODE;
+		if (record->GetSegmentationRule() == "continuity")
+		{
+			timestamp_mode = ffmpeg::Writer::TIMESTAMP_PASSTHROUGH_MODE;
+		}
+
+		if (IsFmp4Muxer(output_format))
+		{
+			auto fmp4_writer = CreateFmp4Writer();
+
+			fmp4_writer->SetTimestampMode(timestamp_mode);
+
+			for (auto &[track_id, track] : GetStream()->GetTracks())
+			{
+				if ((IsSelectedTrack(track) == false) || (ffmpeg::compat::IsSupportCodec(output_format, track->GetCodecId()) == false))
+				{
+					continue;
+				}
+
+				SelectDefaultTrack(track);
+
+				fmp4_writer->AddTrack(track);
+			}
+
+			logtd("Create temporary file(%s) with the fMP4 muxer and default track id(%d)", output->GetPath().CStr(), _default_track);
+
+			if (fmp4_writer->Start() == false)
+			{
+				SetState(SessionState::Error);
+				record->SetState(info::Record::RecordState::Error);
+
+				return false;
+			}
+
+			logtd("Recording Started. %s", record->GetInfoString().CStr());
+
+			return true;
+		}
+
+		auto writer = CreateWriter();
+		if (writer == nullptr)
 		{
 			SetState(SessionState::Error);
 			record->SetState(info::Record::RecordState::Error);
@@ -140,17 +260,25 @@ namespace pub
 			return false;
 		}
 
-		// The mode to specify the initial value of the timestamp stored in the file to zero,
-		// or keep it at the same value as the source timestamp
-		if (record->GetSegmentationRule() == "continuity")
+		if (writer->SetUrl(output->GetPath(), output_format) == false)
 		{
-			writer->SetTimestampMode(ffmpeg::Writer::TIMESTAMP_PASSTHROUGH_MODE);
-		}
-		else if (record->GetSegmentationRule() == "discontinuity")
-		{
-			writer->SetTimestampMode(ffmpeg::Writer::TIMESTAMP_STARTZERO_MODE);
+			SetState(SessionState::Error);
+			record->SetState(info::Record::RecordState::Error);
+
+			return false;
 		}
 
+		writer->SetOutputCallback(
+			[output](const uint8_t *data, int size) -> int {
+				return output->Write(data, size) ? size : AVERROR(EIO);
+			},
+			[output](int64_t offset, int whence) -> int64_t {
+				auto position = (whence == AVSEEK_SIZE) ? output->GetSize() : output->Seek(offset, whence);
+				return (position >= 0) ? position : AVERROR(EIO);
+			});
+
+		writer->SetTimestampMode(timestamp_mode);
+
 		for (auto &[track_id, track] : GetStream()->GetTracks())
 		{
 			if(IsSelectedTrack(track) == false)
@@ -233,10 +361,16 @@ namespace pub
 
 	bool FileSession::StopRecord()
 	{
-		auto writer = GetWriter();
-		if (writer != nullptr)
+		auto output = GetOutput();
+		if (output != nullptr)
 		{
-			writer->Stop();
+			ov::String tmp_output_path = output->GetPath();
+
+			// The rest of the file is written before it is moved
+			if (DestoryWriter() == false)
+			{
+				logte("Could not complete the file. path: %s", tmp_output_path.CStr());
+			}
 
 			// If current state is in the middle of a split recording, do not change the session state.
 			if(_is_splitting.load() == false)
@@ -281,8 +415,6 @@ namespace pub
 				}
 
 				// Moves temporary files to a user-defined path.
-				ov::String tmp_output_path = writer->GetUrl();
-
 				if (rename(tmp_output_path.CStr(), output_path.CStr()) != 0)
 				{
 					logte("Failed to move file. from: %s to: %s", tmp_output_path.CStr(), output_path.CStr());
@@ -309,8 +441,6 @@ namespace pub
 								
 				record->IncreaseSequence();
 			}
-
-			DestoryWriter();
 		}
 
 		return true;
@@ -340,6 +470,108 @@ namespace pub
 			return;
 		}
 
+		{
+			std::lock_guard lock_guard(_packet_queue_mutex);
+
+			auto packet_length = session_packet->GetDataLength();
+			bool is_keyframe = (session_packet->GetTrackId() == _default_track) &&
+							   ((session_packet->GetMediaType() == cmn::MediaType::Audio) ||
+								(session_packet->GetMediaType() == cmn::MediaType::Video && session_packet->GetFlag() == MediaPacketFlag::Key));
+
+			if ((_queued_bytes + packet_length) > FILE_SESSION_MAX_QUEUED_BYTES)
+			{
+				if (_dropping == false)
+				{
+					logtw("The recording can't keep up with the stream, so the packets are dropped until the next keyframe. id(%d), queued(%zu bytes)", GetId(), _queued_bytes);
+					_dropping = true;
+				}
+			}
+			else if (_dropping && is_keyframe)
+			{
+				logtw("The recording is resumed at a keyframe. id(%d), dropped(%llu packets)", GetId(), _dropped_packet_count);
+				_dropping = false;
+				_dropped_packet_count = 0;
+			}
+
+			if (_dropping)
+			{
+				_dropped_packet_count++;
+				return;
+			}
+
+			_packet_queue.push_back({session_packet, std::chrono::steady_clock::now()});
+			_queued_bytes += packet_length;
+
+			if (_backlog_histogram != nullptr)
+			{
+				_backlog_histogram->Observe(_queued_bytes);
+			}
+		}
+
+		ScheduleWrite();
+	}
+
+	void FileSession::ScheduleWrite()
+	{
+		{
+			std::lock_guard lock_guard(_packet_queue_mutex);
+
+			if (_write_scheduled)
+			{
+				return;
+			}
+
+			_write_scheduled = true;
+		}
+
+		auto self = GetSharedPtrAs<FileSession>();
+
+		if (GetFileIoWorkerPool().Post(_io_key, [self]() { self->WritePackets(); }) == false)
+		{
+			std::lock_guard lock_guard(_packet_queue_mutex);
+			_write_scheduled = false;
+		}
+	}
+
+	void FileSession::WritePackets()
+	{
+		while (true)
+		{
+			std::deque<QueuedPacket> packet_queue;
+
+			{
+				std::lock_guard lock_guard(_packet_queue_mutex);
+
+				if (_packet_queue.empty())
+				{
+					_write_scheduled = false;
+					return;
+				}
+
+				packet_queue.swap(_packet_queue);
+			}
+
+			for (auto &queued_packet : packet_queue)
+			{
+				// The packets queued before the session is stopped by an error are discarded
+				if (GetState() == SessionState::Started)
+				{
+					WritePacket(queued_packet.packet);
+
+					if (_write_latency_histogram != nullptr)
+					{
+						_write_latency_histogram->Observe(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - queued_packet.queued_time).count());
+					}
+				}
+
+				std::lock_guard lock_guard(_packet_queue_mutex);
+				_queued_bytes -= queued_packet.packet->GetDataLength();
+			}
+		}
+	}
+
+	void FileSession::WritePacket(const std::shared_ptr<MediaPacket> &session_packet)
+	{
 		auto record = GetRecord();
 		if (!record)
 		{
@@ -402,11 +634,12 @@ namespace pub
 		}
 
 		auto writer = GetWriter();
-		if (writer != nullptr)
+		auto fmp4_writer = GetFmp4Writer();
+		if ((writer != nullptr) || (fmp4_writer != nullptr))
 		{
 			uint64_t sent_bytes = 0;
 
-			bool ret = writer->SendPacket(session_packet, &sent_bytes);
+			bool ret = (fmp4_writer != nullptr) ? fmp4_writer->SendPacket(session_packet, &sent_bytes) : writer->SendPacket(session_packet, &sent_bytes);
 			if (ret == false)
 			{
 				SetState(SessionState::Error);
@@ -520,15 +753,60 @@ namespace pub
 		return result;
 	}
 
-	std::shared_ptr<ffmpeg::Writer> FileSession::CreateWriter()
+	bool FileSession::IsFmp4Muxer(const ov::String &output_format)
 	{
-		std::lock_guard<std::shared_mutex> lock(_writer_mutex);
-		if (_writer != nullptr)
+		auto app_config = std::static_pointer_cast<info::Application>(GetApplication())->GetConfig();
+		auto file_config = app_config.GetPublishers().GetFilePublisher();
+
+		if (file_config.GetMuxer().LowerCaseString() != "fmp4")
 		{
-			_writer->Stop();
-			_writer = nullptr;
+			return false;
+		}
+
+		if (output_format != "mp4")
+		{
+			logtw("The fMP4 muxer records only the mp4 files, so the %s file is recorded with FFmpeg. id(%d)", output_format.CStr(), GetId());
+			return false;
+		}
+
+		size_t track_count = 0;
+		for (auto &[track_id, track] : GetStream()->GetTracks())
+		{
+			if (IsSelectedTrack(track) && ffmpeg::compat::IsSupportCodec(output_format, track->GetCodecId()))
+			{
+				track_count++;
+			}
 		}
 
+		if (track_count != 1)
+		{
+			logtw("The fMP4 muxer records a single track, so the %zu tracks are recorded with FFmpeg. Select a track with TrackIds or VariantNames. id(%d)", track_count, GetId());
+			return false;
+		}
+
+		return true;
+	}
+
+	std::shared_ptr<FileOutput> FileSession::CreateOutput(const ov::String &path)
+	{
+		DestoryWriter();
+
+		auto output = std::make_shared<FileOutput>(_write_duration_histogram);
+		if (output->Open(path) == false)
+		{
+			return nullptr;
+		}
+
+		std::lock_guard<std::shared_mutex> lock(_writer_mutex);
+		_output = output;
+
+		return _output;
+	}
+
+	std::shared_ptr<ffmpeg::Writer> FileSession::CreateWriter()
+	{
+		std::lock_guard<std::shared_mutex> lock(_writer_mutex);
+
 		_writer = ffmpeg::Writer::Create();
 		if (_writer == nullptr)
 		{
@@ -538,14 +816,41 @@ namespace pub
 		return _writer;
 	}
 
-	void FileSession::DestoryWriter()
+	std::shared_ptr<FileFmp4Writer> FileSession::CreateFmp4Writer()
 	{
 		std::lock_guard<std::shared_mutex> lock(_writer_mutex);
+
+		_fmp4_writer = std::make_shared<FileFmp4Writer>(_output, GetStream()->GetUri());
+
+		return _fmp4_writer;
+	}
+
+	bool FileSession::DestoryWriter()
+	{
+		std::lock_guard<std::shared_mutex> lock(_writer_mutex);
+
+		bool result = true;
+
+		// The writers write the rest of the file to the output
 		if (_writer != nullptr)
 		{
 			_writer->Stop();
 			_writer = nullptr;
 		}
+
+		if (_fmp4_writer != nullptr)
+		{
+			result = _fmp4_writer->Stop();
+			_fmp4_writer = nullptr;
+		}
+
+		if (_output != nullptr)
+		{
+			result = _output->Close() && result;
+			_output = nullptr;
+		}
+
+		return result;
 	}
 
 	std::shared_ptr<ffmpeg::Writer> FileSession::GetWriter()
@@ -554,4 +859,16 @@ namespace pub
 		return _writer;
 	}
 
+	std::shared_ptr<FileFmp4Writer> FileSession::GetFmp4Writer()
+	{
+		std::shared_lock<std::shared_mutex> lock(_writer_mutex);
+		return _fmp4_writer;
+	}
+
+	std::shared_ptr<FileOutput> FileSession::GetOutput()
+	{
+		std::shared_lock<std::shared_mutex> lock(_writer_mutex);
+		return _output;
+	}
+
 }  // namespace pub
@@ -1,10 +1,17 @@
 #pragma once
 
 #include <base/info/media_track.h>
+#include <base/ovlibrary/histogram.h>
 #include <base/publisher/session.h>
 #include <modules/ffmpeg/writer.h>
 
 #include "base/info/record.h"
+#include "file_fmp4_writer.h"
+#include "file_output.h"
+
+// The maximum size of the packets waiting to be written by the I/O thread.
+// When the disk can't keep up, the packets are dropped until the next keyframe.
+#define FILE_SESSION_MAX_QUEUED_BYTES (64 * 1024 * 1024)
 
 namespace pub
 {
@@ -40,15 +47,57 @@ namespace pub
 
 		bool IsSelectedTrack(const std::shared_ptr<MediaTrack> &track);
 		void SelectDefaultTrack(const std::shared_ptr<MediaTrack> &track);
+		// Whether the fMP4 muxer is configured, and can record the selected tracks
+		bool IsFmp4Muxer(const ov::String &output_format);
+
+		// Posts WritePackets() to the I/O thread if it is not posted yet
+		void ScheduleWrite();
+		// Runs in the I/O thread
+		void WritePackets();
+		void WritePacket(const std::shared_ptr<MediaPacket> &session_packet);
 
+		// Stops exporting the histograms of the recording
+		void RemoveHistograms();
+
+		std::shared_ptr<FileOutput> CreateOutput(const ov::String &path);
 		std::shared_ptr<ffmpeg::Writer> CreateWriter();
+		std::shared_ptr<FileFmp4Writer> CreateFmp4Writer();
 		std::shared_ptr<ffmpeg::Writer> GetWriter();
-		void DestoryWriter();
+		std::shared_ptr<FileFmp4Writer> GetFmp4Writer();
+		std::shared_ptr<FileOutput> GetOutput();
+		// Stops the writer and closes the file. Returns false if the file could not be completed
+		bool DestoryWriter();
 
 	private:
+		// One of them is used for a file
 		std::shared_ptr<ffmpeg::Writer> _writer;
+		std::shared_ptr<FileFmp4Writer> _fmp4_writer;
+		std::shared_ptr<FileOutput> _output;
 		std::shared_mutex _writer_mutex;
 
+		// The key of the session in the file I/O worker pool
+		uint64_t _io_key = 0;
+
+		struct QueuedPacket
+		{
+			std::shared_ptr<MediaPacket> packet;
+			std::chrono::steady_clock::time_point queued_time;
+		};
+
+		std::deque<QueuedPacket> _packet_queue;
+		size_t _queued_bytes = 0;
+		bool _write_scheduled = false;
+		// The queue was full, so the packets are dropped until the next keyframe
+		bool _dropping = false;
+		uint64_t _dropped_packet_count = 0;
+		std::mutex _packet_queue_mutex;
+
+		std::shared_ptr<ov::Histogram> _write_duration_histogram;
+		std::shared_ptr<ov::Histogram> _write_latency_histogram;
+		std::shared_ptr<ov::Histogram> _backlog_histogram;
+		// The labels of the histograms above in the HistogramRegistry (empty if they are not registered)
+		ov::String _histogram_labels;
+
 		std::shared_ptr<info::Record> _record;
 		std::shared_mutex _record_mutex;
 
@@ -171,8 +171,72 @@ bool LLHlsChunklist::RemoveSegmentInfo(uint32_t segment_sequence)
 
 void LLHlsChunklist::UpdateCacheForDefaultChunklist()
 {
-	// no query string, no skip, no legacy, all segments
-	ov::String chunklist = MakeChunklist("", false, false, true);
+	ov::String chunklist;
+	std::shared_ptr<ov::Data> chunklist_gzip;
+
+	if (_end_list == true)
+	{
+		// VoD chunklist is made only once, so there is nothing to reuse
+		// no query string, no skip, no legacy, all segments
+		chunklist = MakeChunklist("", false, false, true);
+		chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+	}
+	else
+	{
+		std::lock_guard<std::mutex> prefix_lock(_default_chunklist_prefix_guard);
+		std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
+
+		auto last_segment = GetLastSegmentInfoForChunklist();
+		if (last_segment == nullptr)
+		{
+			return;
+		}
+
+		auto first_segment = _segments.begin()->second;
+
+		// The header changes only when the first segment is removed
+		auto header = MakeChunklistHeader("", false, first_segment->GetSequence());
+		if ((header != _default_chunklist_prefix_header) ||
+			(_default_chunklist_prefix_last_sequence < first_segment->GetSequence() - 1))
+		{
+			_default_chunklist_prefix_header = header;
+			_default_chunklist_prefix = header;
+			_default_chunklist_prefix_gzip.Reset();
+			_default_chunklist_prefix_gzip.Append(header.CStr(), header.GetLength());
+			_default_chunklist_prefix_last_sequence = first_segment->GetSequence() - 1;
+		}
+
+		ov::String tail(4096);
+		bool is_prefix_closed = false;
+
+		for (auto it = _segments.upper_bound(_default_chunklist_prefix_last_sequence); it != _segments.end(); ++it)
+		{
+			auto &segment = it->second;
+			auto segment_string = MakeChunklistSegment(segment, last_segment, "", false);
+
+			// Partial segments are only shown for the last 4 segments (see MakeChunklistSegment()),
+			// so a completed segment older than them no longer changes
+			if ((is_prefix_closed == false) &&
+				segment->IsCompleted() &&
+				(segment->GetSequence() <= last_segment->GetSequence() - 3))
+			{
+				_default_chunklist_prefix.Append(segment_string);
+				_default_chunklist_prefix_gzip.Append(segment_string.CStr(), segment_string.GetLength());
+				_default_chunklist_prefix_last_sequence = segment->GetSequence();
+				continue;
+			}
+
+			is_prefix_closed = true;
+			tail.Append(segment_string);
+		}
+		segment_lock.unlock();
+
+		tail.Append(MakeRenditionReports("", false));
+
+		chunklist = _default_chunklist_prefix + tail;
+		chunklist_gzip = _default_chunklist_prefix_gzip.Finish(tail.CStr(), tail.GetLength());
+	}
+
 	{
 		// lock 
 		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
@@ -182,7 +246,7 @@ void LLHlsChunklist::UpdateCacheForDefaultChunklist()
 	{
 		// lock 
 		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		_cached_default_chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+		_cached_default_chunklist_gzip = chunklist_gzip;
 	}
 }
 
@@ -289,78 +353,246 @@ ov::String LLHlsChunklist::MakeExtXKey() const
 	return xkey;
 }
 
-ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod, uint32_t vod_start_segment_number) const
+std::shared_ptr<LLHlsChunklist::SegmentInfo> LLHlsChunklist::GetLastSegmentInfoForChunklist() const
 {
-	std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
-	uint8_t version = 6;
-	if (_segments.size() == 0)
+	if (_segments.empty())
 	{
-		return "";
+		return nullptr;
 	}
 
-	if (_end_list == true)
-	{
-		vod = true;
-	}
+	auto last_segment = _segments.rbegin()->second;
 
-	if (vod == true)
+	// skip empty segment info 
+	if (last_segment != nullptr && last_segment->GetPartialSegmentsCount() == 0)
 	{
-		// VoD doesn't need Low-Latency HLS
-		legacy = true;
+		if (_segments.size() > 1)
+		{
+			last_segment = std::prev(_segments.end(), 2)->second;
+		}
 	}
 
-	// TODO(Getroot) : Implement _HLS_skip=YES (skip = true)
+	return last_segment;
+}
 
-	ov::String playlist(20480);
+ov::String LLHlsChunklist::MakeChunklistHeader(const ov::String &query_string, bool legacy, int64_t media_sequence) const
+{
+	uint8_t version = 6;
 
-	playlist.AppendFormat("#EXTM3U\n");
-
-	// debug info
-	// playlist.AppendFormat("#// query_string(%s) skip(%s) legacy(%s) rewind(%s) vod(%s) vod_start_segment_number(%u)\n", 
-	//  					query_string.CStr(), skip ? "YES" : "NO", legacy ? "YES" : "NO", rewind ? "YES" : "NO", vod ? "YES" : "NO", vod_start_segment_number);
+	ov::String header(1024);
 
+	header.AppendFormat("#EXTM3U\n");
 
 	if (legacy == true)
 	{
 		version = 6;
 	}
-	playlist.AppendFormat("#EXT-X-VERSION:%d\n", version);
+	header.AppendFormat("#EXT-X-VERSION:%d\n", version);
 	// Note that in protocol version 6, the semantics of the EXT-
 	// X-TARGETDURATION tag changed slightly.  In protocol version 5 and
 	// earlier it indicated the maximum segment duration; in protocol
 	// version 6 and later it indicates the the maximum segment duration
 	// rounded to the nearest integer number of seconds.
 	auto target_duration = static_cast<uint32_t>(std::round(_target_duration));
-	playlist.AppendFormat("#EXT-X-TARGETDURATION:%u\n", target_duration);
+	header.AppendFormat("#EXT-X-TARGETDURATION:%u\n", target_duration);
 
 	// Low Latency Mode
 	if (legacy == false)
 	{
 		// X-SERVER-CONTROL
-		playlist.AppendFormat("#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=%f\n", _part_hold_back);
-		playlist.AppendFormat("#EXT-X-PART-INF:PART-TARGET=%lf\n", _part_target_duration);
+		header.AppendFormat("#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=%f\n", _part_hold_back);
+		header.AppendFormat("#EXT-X-PART-INF:PART-TARGET=%lf\n", _part_target_duration);
 	}
 	else
 	{
 		// X-PLAYLIST-TYPE
-		// playlist.AppendFormat("#EXT-X-SERVER-CONTROL:HOLD-BACK=%u\n", target_duration * 3);
+		// header.AppendFormat("#EXT-X-SERVER-CONTROL:HOLD-BACK=%u\n", target_duration * 3);
 	}
 
-	std::shared_ptr<LLHlsChunklist::SegmentInfo> first_segment = nullptr;
-	auto last_segment = _segments.rbegin()->second;
-	if (last_segment == nullptr)
+	header.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", static_cast<uint32_t>(media_sequence));
+
+	if (_map_uri.IsEmpty() == false)
+	{
+		header.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
+		if (query_string.IsEmpty() == false)
+		{
+			header.AppendFormat("?%s", query_string.CStr());
+		}
+		header.AppendFormat("\"\n");
+	}
+
+	// CENC
+	if (_cenc_property.scheme != bmff::CencProtectScheme::None)
+	{
+		header.AppendFormat("%s\n", MakeExtXKey().CStr());
+	}
+
+	return header;
+}
+
+ov::String LLHlsChunklist::MakeChunklistSegment(const std::shared_ptr<SegmentInfo> &segment, const std::shared_ptr<SegmentInfo> &last_segment, const ov::String &query_string, bool legacy) const
+{
+	if (segment->GetPartialSegmentsCount() == 0)
 	{
-		// no segment info
 		return "";
 	}
 
-	// skip empty segment info 
-	if (last_segment->GetPartialSegmentsCount() == 0)
+	if (legacy == true && segment->IsCompleted() == false)
 	{
-		if (_segments.size() > 1)
+		return "";
+	}
+
+	ov::String segment_string(1024);
+
+	std::chrono::system_clock::time_point tp{std::chrono::milliseconds{segment->GetStartTime()}};
+	segment_string.AppendFormat("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
+
+	logtd("MakeChunklist[Track : %s/%s]: segment(%d) duration(%.2f) url(%s) start_time(%lld) date_time(%s)",
+		_track->GetPublicName().CStr(), _track->GetVariantName().CStr(),
+		segment->GetSequence(), segment->GetDuration(), segment->GetUrl().CStr(), segment->GetStartTime(), 
+		ov::Converter::ToISO8601String(tp).CStr());
+
+	// Low Latency Mode
+	if (legacy == false)
+	{
+		// Output partial segments info
+		// Only output partial segments for the last 4 segments.
+		if (segment->GetSequence() > last_segment->GetSequence() - 3)
 		{
-			last_segment = std::prev(_segments.end(), 2)->second;
+			for (auto &partial_segment : segment->GetPartialSegments())
+			{
+				segment_string.AppendFormat("#EXT-X-PART:DURATION=%lf,URI=\"%s",
+									partial_segment->GetDuration(), partial_segment->GetUrl().CStr());
+				if (query_string.IsEmpty() == false)
+				{
+					segment_string.AppendFormat("?%s", query_string.CStr());
+				}
+				segment_string.AppendFormat("\"");
+				if (partial_segment->IsIndependent() == true)
+				{
+					segment_string.AppendFormat(",INDEPENDENT=YES");
+				}
+
+				segment_string.Append("\n");
+
+				//If it is the last one, output PRELOAD-HINT
+				if (_preload_hint_enabled == true &&
+					segment->GetSequence() == last_segment->GetSequence() &&
+					partial_segment == segment->GetPartialSegments().back())
+				{
+					segment_string.AppendFormat("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"%s", partial_segment->GetNextUrl().CStr());
+					if (query_string.IsEmpty() == false)
+					{
+						segment_string.AppendFormat("?%s", query_string.CStr());
+					}
+					segment_string.AppendFormat("\"\n");
+				}
+			}
+		}
+	}
+
+	// Don't print Completed segment info if it is the last segment
+	// It will be printed when the next segment is created.
+	if ((legacy == true && segment->IsCompleted()) || 
+		(legacy == false && segment->IsCompleted() && segment->GetSequence() != last_segment->GetSequence()))
+	{
+		segment_string.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
+		segment_string.AppendFormat("%s", segment->GetUrl().CStr());
+		if (query_string.IsEmpty() == false)
+		{
+			segment_string.AppendFormat("?%s", query_string.CStr());
 		}
+		segment_string.Append("\n");
+	}
+
+	return segment_string;
+}
+
+ov::String LLHlsChunklist::MakeRenditionReports(const ov::String &query_string, bool legacy) const
+{
+	ov::String reports;
+
+	// Output #EXT-X-RENDITION-REPORT
+	// lock
+	std::shared_lock<std::shared_mutex> rendition_lock(_renditions_guard);
+	for (const auto &[track_id, rendition] : _renditions)
+	{
+		// Skip mine 
+		if (track_id == static_cast<int32_t>(_track->GetId()))
+		{
+			continue;
+		}
+		// Skip another media type
+		if (rendition->GetTrack()->GetMediaType() != _track->GetMediaType())
+		{
+			continue;
+		}
+
+		reports.AppendFormat("#EXT-X-RENDITION-REPORT:URI=\"%s", rendition->GetUrl().CStr());
+		if (query_string.IsEmpty() == false)
+		{
+			reports.AppendFormat("?%s", query_string.CStr());
+		}
+		reports.AppendFormat("\"");
+
+		// LAST-MSN, LAST-PART
+		int64_t last_msn, last_part;
+		rendition->GetLastSequenceNumber(last_msn, last_part);
+
+		if (legacy == true && last_msn > 0)
+		{
+			// https://datatracker.ietf.org/doc/html/draft-pantos-hls-rfc8216bis#section-4.4.5.4
+			// If the Rendition contains Partial Segments then this value is the Media Sequence Number of the last Partial Segment. 
+
+			// In legacy, the completed msn is reported.
+			last_msn -= 1;
+		}
+
+		reports.AppendFormat(",LAST-MSN=%llu", last_msn);
+
+		if (legacy == false)
+		{
+			reports.AppendFormat(",LAST-PART=%llu", last_part);
+		}
+		
+		reports.AppendFormat("\n");
+	}
+
+	return reports;
+}
+
+ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod, uint32_t vod_start_segment_number) const
+{
+	std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
+	if (_segments.size() == 0)
+	{
+		return "";
+	}
+
+	if (_end_list == true)
+	{
+		vod = true;
+	}
+
+	if (vod == true)
+	{
+		// VoD doesn't need Low-Latency HLS
+		legacy = true;
+	}
+
+	// TODO(Getroot) : Implement _HLS_skip=YES (skip = true)
+
+	ov::String playlist(20480);
+
+	// debug info
+	// playlist.AppendFormat("#// query_string(%s) skip(%s) legacy(%s) rewind(%s) vod(%s) vod_start_segment_number(%u)\n", 
+	//  					query_string.CStr(), skip ? "YES" : "NO", legacy ? "YES" : "NO", rewind ? "YES" : "NO", vod ? "YES" : "NO", vod_start_segment_number);
+
+	std::shared_ptr<LLHlsChunklist::SegmentInfo> first_segment = nullptr;
+	auto last_segment = GetLastSegmentInfoForChunklist();
+	if (last_segment == nullptr)
+	{
+		// no segment info
+		return "";
 	}
 
 	if (rewind == true)
@@ -401,23 +633,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		first_segment = it->second;
 	}
 
-	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", vod == false ? first_segment->GetSequence() : 0);
-
-	if (_map_uri.IsEmpty() == false)
-	{
-		playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
-		if (query_string.IsEmpty() == false)
-		{
-			playlist.AppendFormat("?%s", query_string.CStr());
-		}
-		playlist.AppendFormat("\"\n");
-	}
-
-	// CENC
-	if (_cenc_property.scheme != bmff::CencProtectScheme::None)
-	{
-		playlist.AppendFormat("%s\n", MakeExtXKey().CStr());
-	}
+	playlist.Append(MakeChunklistHeader(query_string, legacy, vod == false ? first_segment->GetSequence() : 0));
 
 	if (vod == true)
 	{
@@ -444,137 +660,21 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 	for (auto it = _segments.find(first_segment->GetSequence()) ; it != _segments.end(); it ++)
 	{
 		auto number = it->first;
-		auto segment = it->second;
 
 		if (vod == true && number < vod_start_segment_number)
 		{
 			continue;
 		}
 
-		if (segment->GetPartialSegmentsCount() == 0)
-		{
-			continue;
-		}
-
-		if (legacy == true && segment->IsCompleted() == false)
-		{
-			continue;
-		}
-
-		std::chrono::system_clock::time_point tp{std::chrono::milliseconds{segment->GetStartTime()}};
-		playlist.AppendFormat("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
-
-		logtd("MakeChunklist[Track : %s/%s]: segment(%d) duration(%.2f) url(%s) start_time(%lld) date_time(%s)",
-			_track->GetPublicName().CStr(), _track->GetVariantName().CStr(),
-			segment->GetSequence(), segment->GetDuration(), segment->GetUrl().CStr(), segment->GetStartTime(), 
-			ov::Converter::ToISO8601String(tp).CStr());
-
-		// Low Latency Mode
-		if (legacy == false)
-		{
-			// Output partial segments info
-			// Only output partial segments for the last 4 segments.
-			if (segment->GetSequence() > last_segment->GetSequence() - 3)
-			{
-				for (auto &partial_segment : segment->GetPartialSegments())
-				{
-					playlist.AppendFormat("#EXT-X-PART:DURATION=%lf,URI=\"%s",
-										partial_segment->GetDuration(), partial_segment->GetUrl().CStr());
-					if (query_string.IsEmpty() == false)
-					{
-						playlist.AppendFormat("?%s", query_string.CStr());
-					}
-					playlist.AppendFormat("\"");
-					if (partial_segment->IsIndependent() == true)
-					{
-						playlist.AppendFormat(",INDEPENDENT=YES");
-					}
-
-					playlist.Append("\n");
-
-					//If it is the last one, output PRELOAD-HINT
-					if (_preload_hint_enabled == true &&
-						segment->GetSequence() == last_segment->GetSequence() &&
-						partial_segment == segment->GetPartialSegments().back())
-					{
-						playlist.AppendFormat("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"%s", partial_segment->GetNextUrl().CStr());
-						if (query_string.IsEmpty() == false)
-						{
-							playlist.AppendFormat("?%s", query_string.CStr());
-						}
-						playlist.AppendFormat("\"\n");
-					}
-				}
-			}
-		}
-
-		// Don't print Completed segment info if it is the last segment
-		// It will be printed when the next segment is created.
-		if ((legacy == true && segment->IsCompleted()) || 
-			(legacy == false && segment->IsCompleted() && segment->GetSequence() != last_segment->GetSequence()))
-		{
-			playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
-			playlist.AppendFormat("%s", segment->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
-			playlist.Append("\n");
-		}
+		playlist.Append(MakeChunklistSegment(it->second, last_segment, query_string, legacy));
 	}
 	segment_lock.unlock();
 
-#if 1
 	// only for live and low-latency mode
 	if (vod == false && legacy == false)
 	{
-		// Output #EXT-X-RENDITION-REPORT
-		// lock
-		std::shared_lock<std::shared_mutex> rendition_lock(_renditions_guard);
-		for (const auto &[track_id, rendition] : _renditions)
-		{
-			// Skip mine 
-			if (track_id == static_cast<int32_t>(_track->GetId()))
-			{
-				continue;
-			}
-			// Skip another media type
-			if (rendition->GetTrack()->GetMediaType() != _track->GetMediaType())
-			{
-				continue;
-			}
-
-			playlist.AppendFormat("#EXT-X-RENDITION-REPORT:URI=\"%s", rendition->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
-			playlist.AppendFormat("\"");
-
-			// LAST-MSN, LAST-PART
-			int64_t last_msn, last_part;
-			rendition->GetLastSequenceNumber(last_msn, last_part);
-
-			if (legacy == true && last_msn > 0)
-			{
-				// https://datatracker.ietf.org/doc/html/draft-pantos-hls-rfc8216bis#section-4.4.5.4
-				// If the Rendition contains Partial Segments then this value is the Media Sequence Number of the last Partial Segment. 
-
-				// In legacy, the completed msn is reported.
-				last_msn -= 1;
-			}
-
-			playlist.AppendFormat(",LAST-MSN=%llu", last_msn);
-
-			if (legacy == false)
-			{
-				playlist.AppendFormat(",LAST-PART=%llu", last_part);
-			}
-			
-			playlist.AppendFormat("\n");
-		}
+		playlist.Append(MakeRenditionReports(query_string, legacy));
 	}
-#endif
 
 	if (vod == true)
 	{
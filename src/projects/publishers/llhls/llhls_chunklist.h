@@ -12,6 +12,7 @@
 #include <base/info/media_track.h>
 #include <base/mediarouter/media_buffer.h>
 #include <base/modules/marker/marker_box.h>
+#include <base/ovlibrary/zip.h>
 
 #include "modules/containers/bmff/cenc.h"
 
@@ -253,6 +254,13 @@ private:
 
 	ov::String MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod = false, uint32_t vod_start_segment_number = 0) const;
 
+	// The following functions must be called with _segments_guard locked
+	std::shared_ptr<SegmentInfo> GetLastSegmentInfoForChunklist() const;
+	ov::String MakeChunklistHeader(const ov::String &query_string, bool legacy, int64_t media_sequence) const;
+	ov::String MakeChunklistSegment(const std::shared_ptr<SegmentInfo> &segment, const std::shared_ptr<SegmentInfo> &last_segment, const ov::String &query_string, bool legacy) const;
+
+	ov::String MakeRenditionReports(const ov::String &query_string, bool legacy) const;
+
 	ov::String MakeExtXKey() const;
 
 	ov::String MakeMarkers(const std::vector<std::shared_ptr<Marker>> &markers) const;
@@ -293,6 +301,16 @@ private:
 	std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
 	mutable std::shared_mutex _cached_default_chunklist_gzip_guard;
 
+	// The default chunklist is rendered incrementally. Completed segments that no longer show
+	// partial segments never change until they are removed, so they are rendered (and compressed)
+	// only once into the prefix, and only the tail is rendered whenever a partial segment is appended.
+	ov::String _default_chunklist_prefix_header;
+	ov::String _default_chunklist_prefix;
+	ov::GzipStream _default_chunklist_prefix_gzip;
+	// The last segment sequence rendered into the prefix
+	int64_t _default_chunklist_prefix_last_sequence = -1;
+	std::mutex _default_chunklist_prefix_guard;
+
 	bmff::CencProperty _cenc_property;
 
 	bool _end_list = false;
@@ -795,6 +795,11 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 
 void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange)
 {
+	// Includes the time that the blocking playlist/part requests were held
+	static auto request_duration_histogram = mon::HistogramRegistry::GetInstance()->Get(
+		"ome_llhls_request_duration_microseconds",
+		"Time from receiving an LL-HLS request to sending its response");
+
 	auto response = exchange->GetResponse();
 	auto sent_size = response->Response();
 
@@ -803,6 +808,9 @@ void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &
 		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::LLHls, sent_size);
 	}
 
+	auto request_duration = std::chrono::system_clock::now() - exchange->GetRequest()->GetCreateTime();
+	request_duration_histogram->Observe(std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(request_duration).count(), 0));
+
 	logtd("\n%s", exchange->GetDebugInfo().CStr());
 
 	// Terminate the HTTP/2 stream
@@ -241,7 +241,15 @@ void OvtPublisher::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
 		}
 		else if (app.UpperCaseString() == "PLAY")
 		{
-			HandlePlayRequest(remote, request_id, url);
+			// Edges that support larger payloads announce "maxPayloadSize"
+			size_t max_payload_size = OVT_DEFAULT_MAX_PAYLOAD_SIZE;
+			Json::Value &json_max_payload_size = object.GetJsonValue()["maxPayloadSize"];
+			if (json_max_payload_size.isUInt())
+			{
+				max_payload_size = std::clamp<size_t>(json_max_payload_size.asUInt(), OVT_DEFAULT_MAX_PAYLOAD_SIZE, OVT_MAX_PAYLOAD_SIZE_LIMIT);
+			}
+
+			HandlePlayRequest(remote, request_id, url, max_payload_size);
 		}
 		else if (app.UpperCaseString() == "STOP")
 		{
@@ -331,7 +339,7 @@ void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remo
 	ResponseResult(remote, 0, "describe", request_id, 200, "ok", description);
 }
 
-void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
+void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url, size_t max_payload_size)
 {
 	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(url->Host(), url->App());
 
@@ -354,7 +362,7 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 	}
 
 	// Session ID is remote socket's ID
-	auto session = OvtSession::Create(app, stream, remote->GetNativeHandle(), remote);
+	auto session = OvtSession::Create(app, stream, remote->GetNativeHandle(), remote, max_payload_size);
 	if (session == nullptr)
 	{
 		ov::String msg;
@@ -365,7 +373,10 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 
 	LinkRemoteWithStream(remote->GetNativeHandle(), stream);
 
-	ResponseResult(remote, session->GetId(), "play", request_id, 200, "ok");
+	Json::Value contents;
+	contents["maxPayloadSize"] = static_cast<uint32_t>(max_payload_size);
+
+	ResponseResult(remote, session->GetId(), "play", request_id, 200, "ok", contents);
 
 	stream->AddSession(session);
 }
@@ -4,15 +4,17 @@
 #include <modules/ovt_packetizer/ovt_packet.h>
 #include <monitoring/monitoring.h>
 #include "ovt_session.h"
+#include "ovt_shared_packet.h"
 #include "ovt_private.h"
 
 std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Application> &application,
 										  	   const std::shared_ptr<pub::Stream> &stream,
 										  	   uint32_t session_id,
-										  	   const std::shared_ptr<ov::Socket> &connector)
+										  	   const std::shared_ptr<ov::Socket> &connector,
+										  	   size_t max_payload_size)
 {
 	auto session_info = info::Session(*std::static_pointer_cast<info::Stream>(stream), session_id);
-	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector);
+	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector, max_payload_size);
 	if(!session->Start())
 	{
 		return nullptr;
@@ -23,11 +25,13 @@ std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Applic
 OvtSession::OvtSession(const info::Session &session_info,
 		   const std::shared_ptr<pub::Application> &application,
 		   const std::shared_ptr<pub::Stream> &stream,
-		   const std::shared_ptr<ov::Socket> &connector)
+		   const std::shared_ptr<ov::Socket> &connector,
+		   size_t max_payload_size)
    : pub::Session(session_info, application, stream)
 {
 	_connector = connector;
 	_sent_ready = false;
+	_max_payload_size = max_payload_size;
 
 	MonitorInstance->OnSessionConnected(*GetStream(), PublisherType::Ovt);
 }
@@ -56,11 +60,11 @@ bool OvtSession::Stop()
 
 void OvtSession::SendOutgoingData(const std::any &packet)
 {
-	std::shared_ptr<OvtPacket> session_packet;
+	std::shared_ptr<const OvtSharedPacket> session_packet;
 
 	try 
 	{
-        session_packet = std::any_cast<std::shared_ptr<OvtPacket>>(packet);
+        session_packet = std::any_cast<std::shared_ptr<const OvtSharedPacket>>(packet);
 		if(session_packet == nullptr)
 		{
 			return;
@@ -83,11 +87,17 @@ void OvtSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// Set OVT Session ID into packet
-	auto copy_packet = std::make_shared<OvtPacket>(*session_packet);
-	copy_packet->SetSessionId(GetId());
+	// The stream packetizes with OVT_MAX_PAYLOAD_SIZE_LIMIT, so edges that don't support large payloads get the fragmented one.
+	// Both are shared with other sessions, and the session only keeps its send offset (in the socket).
+	const auto &data_list = (session_packet->PayloadLength() > _max_payload_size)
+								? session_packet->GetFragmentedDataList()
+								: session_packet->GetDataList();
 
-	_connector->Send(copy_packet->GetData());
+	if (_connector->SendVector(data_list) == false)
+	{
+		// Wait for the next marker so as not to send a partial media packet after recovery
+		_sent_ready = false;
+	}
 }
 
 const std::shared_ptr<ov::Socket> OvtSession::GetConnector()
@@ -3,6 +3,7 @@
 #include <base/info/media_track.h>
 #include <base/ovsocket/socket.h>
 #include <base/publisher/session.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
 
 class OvtSession : public pub::Session
 {
@@ -10,12 +11,14 @@ public:
 	static std::shared_ptr<OvtSession> Create(const std::shared_ptr<pub::Application> &application,
 											  const std::shared_ptr<pub::Stream> &stream,
 											  uint32_t ovt_session_id,
-											  const std::shared_ptr<ov::Socket> &connector);
+											  const std::shared_ptr<ov::Socket> &connector,
+											  size_t max_payload_size);
 
 	OvtSession(const info::Session &session_info,
 			const std::shared_ptr<pub::Application> &application,
 			const std::shared_ptr<pub::Stream> &stream,
-			const std::shared_ptr<ov::Socket> &connector);
+			const std::shared_ptr<ov::Socket> &connector,
+			size_t max_payload_size);
 	~OvtSession() override;
 
 	bool Start() override;
@@ -29,4 +32,6 @@ public:
 private:
 	std::shared_ptr<ov::Socket>		_connector;
 	bool 							_sent_ready;
+	// Negotiated with "maxPayloadSize" of the PLAY request
+	size_t							_max_payload_size;
 };
@@ -0,0 +1,48 @@
+#include "ovt_shared_packet.h"
+
+#include "ovt_private.h"
+
+OvtSharedPacket::OvtSharedPacket(const std::shared_ptr<OvtPacket> &packet)
+	: _packet(packet)
+{
+	_data_list = _packet->GetDataList();
+}
+
+bool OvtSharedPacket::Marker() const
+{
+	return _packet->Marker();
+}
+
+uint16_t OvtSharedPacket::PayloadLength() const
+{
+	return _packet->PayloadLength();
+}
+
+size_t OvtSharedPacket::GetDataLength() const
+{
+	return _packet->GetDataLength();
+}
+
+const std::vector<std::shared_ptr<const ov::Data>> &OvtSharedPacket::GetDataList() const
+{
+	return _data_list;
+}
+
+const std::vector<std::shared_ptr<const ov::Data>> &OvtSharedPacket::GetFragmentedDataList() const
+{
+	if (_packet->PayloadLength() <= OVT_DEFAULT_MAX_PAYLOAD_SIZE)
+	{
+		return _data_list;
+	}
+
+	// Sessions on different StreamWorkers can request it at the same time
+	std::call_once(_fragment_flag, [this]() {
+		for (const auto &fragment : _packet->Fragment(OVT_DEFAULT_MAX_PAYLOAD_SIZE))
+		{
+			auto data_list = fragment->GetDataList();
+			_fragmented_data_list.insert(_fragmented_data_list.end(), data_list.begin(), data_list.end());
+		}
+	});
+
+	return _fragmented_data_list;
+}
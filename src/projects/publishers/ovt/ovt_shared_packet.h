@@ -0,0 +1,32 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
+
+#include <mutex>
+
+// Serialized OVT packet that OvtStream produces once per packet and shares with all OvtSessions.
+// Sessions only reference the data (their own send offsets are kept in ov::Socket), so it must not be modified after broadcasting.
+class OvtSharedPacket
+{
+public:
+	explicit OvtSharedPacket(const std::shared_ptr<OvtPacket> &packet);
+
+	bool Marker() const;
+	uint16_t PayloadLength() const;
+	size_t GetDataLength() const;
+
+	// Returns [Header, Payload...] of the packet
+	const std::vector<std::shared_ptr<const ov::Data>> &GetDataList() const;
+
+	// Returns the packet split into packets whose payload is not larger than OVT_DEFAULT_MAX_PAYLOAD_SIZE,
+	// for sessions that did not negotiate a larger payload size. It is produced only once on the first call.
+	const std::vector<std::shared_ptr<const ov::Data>> &GetFragmentedDataList() const;
+
+private:
+	std::shared_ptr<OvtPacket> _packet;
+	std::vector<std::shared_ptr<const ov::Data>> _data_list;
+
+	mutable std::once_flag _fragment_flag;
+	mutable std::vector<std::shared_ptr<const ov::Data>> _fragmented_data_list;
+};
@@ -3,6 +3,7 @@
 #include "ovt_private.h"
 #include "ovt_stream.h"
 #include "ovt_session.h"
+#include "ovt_shared_packet.h"
 #include "base/publisher/application.h"
 #include "base/publisher/stream.h"
 
@@ -55,6 +56,8 @@ bool OvtStream::Start()
 
 	logtd("OvtStream(%d) has been started", GetId());
 	_packetizer = std::make_shared<OvtPacketizer>(OvtPacketizerInterface::GetSharedPtr());
+	// Packets are split again by sessions that have negotiated a smaller payload size
+	_packetizer->SetMaxPayloadSize(OVT_MAX_PAYLOAD_SIZE_LIMIT);
 
 	return Stream::Start();
 }
@@ -223,8 +226,9 @@ void OvtStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
 
 bool OvtStream::OnOvtPacketized(std::shared_ptr<OvtPacket> &packet)
 {
-	// Broadcasting
-	auto stream_packet = std::make_any<std::shared_ptr<OvtPacket>>(packet);
+	// Broadcasting - The packet is serialized once here and shared by all sessions
+	auto shared_packet = std::make_shared<const OvtSharedPacket>(packet);
+	auto stream_packet = std::make_any<std::shared_ptr<const OvtSharedPacket>>(shared_packet);
 	BroadcastPacket(stream_packet);
 	
 	
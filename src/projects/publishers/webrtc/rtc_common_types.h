@@ -11,6 +11,12 @@
 #include <base/common_types.h>
 
 #define MAX_RTP_RECORDS 1500
+// Interval between the frames sent from the GOP cache (1 ms in 90 kHz)
+#define GOP_CACHE_FRAME_INTERVAL 90
+// Interval between the checks whether to change the rendition
+#define AUTO_ABR_CHECK_INTERVAL_MS 1000
+// The rendition is checked sooner when the estimator detects the overuse (the queue of the bottleneck is growing)
+#define AUTO_ABR_OVERUSE_CHECK_INTERVAL_MS 300
 
 // https://tools.ietf.org/html/rfc5761#section-4
 // - payload type values in the range 64-95 MUST NOT be used
@@ -0,0 +1,194 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtc_pacer.h"
+
+#include "rtc_private.h"
+
+// The number of threads that release the paced packets
+#define RTC_PACER_WORKER_COUNT 4
+
+namespace
+{
+	// A pacer is ticked only while its queue is not empty, so the sessions that send within their budget
+	// (most of them, most of the time) cost nothing here
+	ov::ShardedWorkerPool &GetPacerWorkerPool()
+	{
+		static ov::ShardedWorkerPool worker_pool("RtcPacer", RTC_PACER_WORKER_COUNT, false);
+
+		return worker_pool;
+	}
+
+	void Tick(uint64_t worker_key, const std::weak_ptr<RtcPacer> &weak_pacer)
+	{
+		auto pacer = weak_pacer.lock();
+
+		if ((pacer != nullptr) && pacer->Process())
+		{
+			GetPacerWorkerPool().PostDelayed(
+				worker_key, [worker_key, weak_pacer]() {
+					Tick(worker_key, weak_pacer);
+				},
+				std::chrono::milliseconds(RTC_PACER_INTERVAL_MS));
+		}
+	}
+}  // namespace
+
+RtcPacer::RtcPacer(SendCallback send_callback)
+	: _send_callback(std::move(send_callback)),
+	  _worker_key(GetPacerWorkerPool().IssueKey())
+{
+}
+
+void RtcPacer::SetPacingBitrate(uint64_t bitrate)
+{
+	_pacing_bitrate.store(static_cast<uint64_t>(bitrate * RTC_PACER_PACING_FACTOR), std::memory_order_relaxed);
+}
+
+uint64_t RtcPacer::GetPacingBitrate() const
+{
+	return _pacing_bitrate.load(std::memory_order_relaxed);
+}
+
+void RtcPacer::RefillBudget(const std::chrono::steady_clock::time_point &now)
+{
+	auto bytes_per_ms = static_cast<double>(GetPacingBitrate()) / 8.0 / 1000.0;
+
+	if (_last_refill_time.has_value())
+	{
+		auto elapsed_ms = std::chrono::duration<double, std::milli>(now - _last_refill_time.value()).count();
+
+		_budget_bytes = std::min(_budget_bytes + (bytes_per_ms * elapsed_ms), bytes_per_ms * RTC_PACER_MAX_BUDGET_MS);
+	}
+	else
+	{
+		_budget_bytes = bytes_per_ms * RTC_PACER_MAX_BUDGET_MS;
+	}
+
+	_last_refill_time = now;
+}
+
+void RtcPacer::Enqueue(const std::vector<Packet> &packet_list)
+{
+	bool need_to_schedule = false;
+
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		if (_stopped)
+		{
+			return;
+		}
+
+		auto now = std::chrono::steady_clock::now();
+		auto pacing_enabled = (GetPacingBitrate() > 0);
+
+		RefillBudget(now);
+
+		std::vector<Packet> send_list;
+		send_list.reserve(packet_list.size());
+
+		for (const auto &packet : packet_list)
+		{
+			auto is_audio = (packet.rtp_packet->IsVideoPacket() == false);
+
+			if ((pacing_enabled == false) || is_audio || (_queue.empty() && (_budget_bytes > 0.0)))
+			{
+				_budget_bytes -= packet.rtp_packet->GetDataLength();
+				send_list.push_back(packet);
+			}
+			else
+			{
+				_queue.push_back({packet, now});
+			}
+		}
+
+		if (send_list.empty() == false)
+		{
+			_send_callback(send_list);
+		}
+
+		if ((_queue.empty() == false) && (_scheduled == false))
+		{
+			_scheduled = true;
+			need_to_schedule = true;
+		}
+	}
+
+	if (need_to_schedule)
+	{
+		auto worker_key = _worker_key;
+
+		GetPacerWorkerPool().Post(worker_key, [worker_key, weak_pacer = std::weak_ptr<RtcPacer>(shared_from_this())]() {
+			Tick(worker_key, weak_pacer);
+		});
+	}
+}
+
+bool RtcPacer::Process()
+{
+	std::lock_guard lock_guard(_mutex);
+
+	if (_stopped)
+	{
+		_scheduled = false;
+		return false;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+	auto pacing_enabled = (GetPacingBitrate() > 0);
+
+	RefillBudget(now);
+
+	std::vector<Packet> send_list;
+
+	if ((_queue.empty() == false) && ((now - _queue.front().enqueued_time) > std::chrono::milliseconds(RTC_PACER_MAX_QUEUE_TIME_MS)))
+	{
+		logtw("The packets have been queued for too long (%zu packets, pacing bitrate: %" PRIu64 " bps), drain the queue", _queue.size(), GetPacingBitrate());
+
+		// Don't keep the queue growing when the estimate is far below the bitrate of the stream
+		pacing_enabled = false;
+	}
+
+	while ((_queue.empty() == false) && ((pacing_enabled == false) || (_budget_bytes > 0.0)))
+	{
+		auto &packet = _queue.front().packet;
+
+		_budget_bytes -= packet.rtp_packet->GetDataLength();
+		send_list.push_back(std::move(packet));
+
+		_queue.pop_front();
+	}
+
+	if (send_list.empty() == false)
+	{
+		_send_callback(send_list);
+	}
+
+	if (_queue.empty())
+	{
+		_scheduled = false;
+		return false;
+	}
+
+	return true;
+}
+
+void RtcPacer::Stop()
+{
+	std::lock_guard lock_guard(_mutex);
+
+	_stopped = true;
+	_queue.clear();
+}
+
+size_t RtcPacer::GetQueueSize() const
+{
+	std::lock_guard lock_guard(_mutex);
+
+	return _queue.size();
+}
@@ -0,0 +1,88 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/rtp_rtcp/rtp_packet.h>
+
+#include <deque>
+
+// The packets are released at (estimated bitrate * RTC_PACER_PACING_FACTOR), so the pacer can catch up
+// with the bursts (keyframes) quickly while not overshooting the bottleneck by far
+#define RTC_PACER_PACING_FACTOR 2.5
+// The unused budget is accumulated up to this time, which allows a small burst after an idle period
+#define RTC_PACER_MAX_BUDGET_MS 40
+// If a packet waits longer than this, the queue is drained at once (the estimate is too low to be useful)
+#define RTC_PACER_MAX_QUEUE_TIME_MS 2000
+// The interval of releasing the queued packets
+#define RTC_PACER_INTERVAL_MS 5
+
+// A leaky bucket that spreads the RTP packets of a session over time according to the estimated bandwidth,
+// instead of sending a whole keyframe in a single burst that overflows the queue of the bottleneck.
+//
+// - The packets are sent immediately as long as the budget allows and nothing is queued,
+//   so the pacer adds no delay to a session that isn't constrained.
+// - The audio packets are never delayed, but they consume the budget.
+// - The packets over the budget are queued, and released every RTC_PACER_INTERVAL_MS by a worker of a pool
+//   shared by the pacers (the pacer is always processed by the same worker).
+//
+// The send callback is called with the lock of the pacer held, so the packets are sent in order,
+// and the callback is never called after Stop() returns.
+class RtcPacer : public std::enable_shared_from_this<RtcPacer>
+{
+public:
+	struct Packet
+	{
+		std::shared_ptr<RtpPacket> rtp_packet;
+		// The sequence number of the packet in the stream (for NACK)
+		uint16_t origin_sequence_number = 0;
+	};
+
+	using SendCallback = std::function<void(const std::vector<Packet> &packet_list)>;
+
+	explicit RtcPacer(SendCallback send_callback);
+
+	// 0 disables pacing (every packet is sent immediately)
+	void SetPacingBitrate(uint64_t bitrate);
+	uint64_t GetPacingBitrate() const;
+
+	// The packets of a frame should be enqueued at once
+	void Enqueue(const std::vector<Packet> &packet_list);
+
+	// Called by the worker every RTC_PACER_INTERVAL_MS, returns false when there is no more packet to release
+	bool Process();
+
+	void Stop();
+
+	size_t GetQueueSize() const;
+
+private:
+	struct QueuedPacket
+	{
+		Packet packet;
+		std::chrono::steady_clock::time_point enqueued_time;
+	};
+
+	// Must be called with _mutex held
+	void RefillBudget(const std::chrono::steady_clock::time_point &now);
+
+	const SendCallback _send_callback;
+	const uint64_t _worker_key;
+
+	mutable std::mutex _mutex;
+	bool _stopped = false;
+	// Whether the pacer is being processed by the worker
+	bool _scheduled = false;
+
+	std::atomic<uint64_t> _pacing_bitrate{0};
+	// It becomes negative when a packet larger than the remaining budget is sent
+	double _budget_bytes = 0.0;
+	std::optional<std::chrono::steady_clock::time_point> _last_refill_time;
+
+	std::deque<QueuedPacket> _queue;
+};
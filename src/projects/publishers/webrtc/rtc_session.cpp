@@ -162,6 +162,12 @@ bool RtcSession::Start()
 	_current_rendition = _playlist->GetFirstRendition();
 	RecordAutoSelectedRendition(_current_rendition, true);
 
+	// The estimator probes upward from the bitrate of the first rendition
+	if (_current_rendition->GetBitrates() > 0)
+	{
+		_bandwidth_estimator.SetStartBitrate(_current_rendition->GetBitrates());
+	}
+
 	auto current_video_track = _current_rendition->GetVideoTrack();
 	auto current_audio_track = _current_rendition->GetAudioTrack();
 
@@ -190,9 +196,17 @@ bool RtcSession::Start()
 	RegisterNextNode(nullptr);
 	ov::Node::Start();
 
+	// Pacing is disabled until the first estimate
+	_pacer = std::make_shared<RtcPacer>([this](const std::vector<RtcPacer::Packet> &packet_list) {
+		SendPacedPackets(packet_list);
+	});
+
 	_abr_test_watch.Start();
 	_bitrate_estimate_watch.Start();
 
+	// Resolved once, since the bytes are counted for every packet
+	_metrics_handle = MonitorInstance->GetStreamMetricsHandle(*GetStream());
+
 	return Session::Start();
 }
 
@@ -208,6 +222,12 @@ bool RtcSession::Stop()
 		return true;
 	}
 
+	// No packet is released from the pacer after this
+	if (_pacer != nullptr)
+	{
+		_pacer->Stop();
+	}
+
 	if (_rtp_rtcp != nullptr)
 	{
 		_rtp_rtcp->Stop();
@@ -502,12 +522,12 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	std::shared_ptr<RtpPacket> session_packet;
+	std::shared_ptr<const RtcStream::RtpPacketList> session_packet_list;
 
 	try
 	{
-		session_packet = std::any_cast<std::shared_ptr<RtpPacket>>(packet);
-		if (session_packet == nullptr)
+		session_packet_list = std::any_cast<std::shared_ptr<const RtcStream::RtpPacketList>>(packet);
+		if (session_packet_list == nullptr)
 		{
 			return;
 		}
@@ -518,15 +538,126 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// Check the packet is selected.
-	if (IsSelectedPacket(session_packet) == false)
+	// The cached GOP is sent once the packets can be encrypted (DTLS handshake completed)
+	if ((_gop_cache_sent == false) && _srtp_transport->IsTransmittable())
+	{
+		_gop_cache_sent = true;
+		SendGopCache();
+	}
+
+	std::vector<RtcPacer::Packet> send_list;
+	send_list.reserve(session_packet_list->size());
+
+	for (const auto &session_packet : *session_packet_list)
+	{
+		// Check the packet is selected.
+		if (IsSelectedPacket(session_packet) == false)
+		{
+			continue;
+		}
+
+		if (IsSentByGopCache(session_packet))
+		{
+			continue;
+		}
+
+		send_list.push_back(MakeSessionPacket(session_packet));
+	}
+
+	// The packets are sent to the rtp_rtcp when the pacer releases them
+	_pacer->Enqueue(send_list);
+}
+
+void RtcSession::SendGopCache()
+{
+	std::shared_lock<std::shared_mutex> change_lock(_change_rendition_lock);
+	auto current_rendition = _current_rendition;
+	change_lock.unlock();
+
+	auto video_track = (current_rendition != nullptr) ? current_rendition->GetVideoTrack() : nullptr;
+	if (video_track == nullptr)
 	{
 		return;
 	}
 
+	// Same rule as IsSelectedPacket(): RED packets are sent if RED is enabled
+	auto payload_type = _red_enabled ? static_cast<uint8_t>(FixedRtcPayloadType::RED_PAYLOAD_TYPE) : _video_payload_type;
+
+	auto packet_list = std::static_pointer_cast<RtcStream>(GetStream())->GetGopCachePackets(video_track->GetId(), payload_type);
+	if (packet_list.empty())
+	{
+		return;
+	}
+
+	// Fast-forward: the cached frames are rebased to be GOP_CACHE_FRAME_INTERVAL apart and to end at the timestamp
+	// of the last cached frame, so the player decodes them at once and continues with the live packets seamlessly.
+	size_t frame_count = 1;
+	for (size_t index = 1; index < packet_list.size(); index++)
+	{
+		if (packet_list[index]->Timestamp() != packet_list[index - 1]->Timestamp())
+		{
+			frame_count++;
+		}
+	}
+
+	auto last_timestamp = packet_list.back()->Timestamp();
+	size_t frame_index = 0;
+
+	std::vector<RtcPacer::Packet> send_list;
+
+	for (size_t index = 0; index < packet_list.size(); index++)
+	{
+		if ((index > 0) && (packet_list[index]->Timestamp() != packet_list[index - 1]->Timestamp()))
+		{
+			// Send the previous frame
+			_pacer->Enqueue(send_list);
+			send_list.clear();
+
+			frame_index++;
+		}
+
+		send_list.push_back(MakeSessionPacket(packet_list[index], last_timestamp - static_cast<uint32_t>((frame_count - 1 - frame_index) * GOP_CACHE_FRAME_INTERVAL)));
+	}
+
+	_pacer->Enqueue(send_list);
+
+	_gop_cache_track_id = video_track->GetId();
+	_gop_cache_payload_type = payload_type;
+	_gop_cache_last_sequence_number = packet_list.back()->SequenceNumber();
+
+	logtd("Sent the cached GOP to the session(%u): %zu frames, %zu packets", GetId(), frame_count, packet_list.size());
+}
+
+bool RtcSession::IsSentByGopCache(const std::shared_ptr<const RtpPacket> &rtp_packet)
+{
+	if ((_gop_cache_last_sequence_number.has_value() == false) ||
+		(rtp_packet->GetTrackId() != _gop_cache_track_id) ||
+		(rtp_packet->PayloadType() != _gop_cache_payload_type))
+	{
+		return false;
+	}
+
+	// The packets that were cached before the session was primed are still in the queue of the stream
+	if (static_cast<int16_t>(rtp_packet->SequenceNumber() - _gop_cache_last_sequence_number.value()) <= 0)
+	{
+		return true;
+	}
+
+	_gop_cache_last_sequence_number.reset();
+
+	return false;
+}
+
+RtcPacer::Packet RtcSession::MakeSessionPacket(const std::shared_ptr<const RtpPacket> &session_packet, std::optional<uint32_t> rebased_timestamp)
+{
 	// RTP Session must be copied and sent because data is altered due to SRTP.
 	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
 
+	if (rebased_timestamp.has_value())
+	{
+		copy_packet->SetTimestamp(rebased_timestamp.value());
+	}
+
 	if (copy_packet->IsVideoPacket())
 	{
 		copy_packet->SetSequenceNumber(_video_rtp_sequence_number++);
@@ -536,23 +667,45 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		copy_packet->SetSequenceNumber(_audio_rtp_sequence_number++);
 	}
 
-	// Set transport-wide sequence number
-	SetTransportWideSequenceNumber(copy_packet, _wide_sequence_number);
-	SetAbsSendTime(copy_packet, ov::Clock::NowMSec());
+	return {copy_packet, session_packet->SequenceNumber()};
+}
 
-	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
+void RtcSession::SendPacedPackets(const std::vector<RtcPacer::Packet> &packet_list)
+{
+	std::vector<std::shared_ptr<RtpPacket>> send_list;
+	send_list.reserve(packet_list.size());
+
+	size_t sent_bytes = 0;
+	auto now_ms = ov::Clock::NowMSec();
 
-	// Packet loss simulation codes
-	// if (ov::Random::GenerateUInt32(1, 33) != 10)
+	for (const auto &packet : packet_list)
 	{
-		_rtp_rtcp->SendRtpPacket(copy_packet);
-	}
+		auto &rtp_packet = packet.rtp_packet;
+
+		// Set transport-wide sequence number
+		SetTransportWideSequenceNumber(rtp_packet, _wide_sequence_number);
+		SetAbsSendTime(rtp_packet, now_ms);
 
-	RecordRtpSent(copy_packet, session_packet->SequenceNumber(), _wide_sequence_number);
+		RecordRtpSent(rtp_packet, packet.origin_sequence_number, _wide_sequence_number);
 
-	_wide_sequence_number++;
+		_wide_sequence_number++;
+
+		sent_bytes += rtp_packet->GetDataLength();
+		send_list.push_back(rtp_packet);
+	}
 
-	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, copy_packet->GetDataLength());
+	if (_metrics_handle != nullptr)
+	{
+		_metrics_handle->IncreaseBytesOut(PublisherType::Webrtc, sent_bytes);
+	}
+	else
+	{
+		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, sent_bytes);
+	}
+
+	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
+	// The packets of a frame are protected with SRTP in a batch
+	_rtp_rtcp->SendRtpPackets(send_list);
 }
 
 bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number)
@@ -588,65 +741,63 @@ bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, ui
 
 bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number)
 {
+	static_assert((RTC_SENT_LOG_SIZE & (RTC_SENT_LOG_SIZE - 1)) == 0, "RTC_SENT_LOG_SIZE must be a power of two");
+
 	if (rtp_packet == nullptr)
 	{
 		return false;
 	}
 
-	auto sent_log					  = std::make_shared<RtpSentLog>();
-	sent_log->_sequence_number		  = rtp_packet->SequenceNumber();
-	sent_log->_wide_sequence_number	  = wide_sequence_number;
-	sent_log->_track_id				  = rtp_packet->GetTrackId();
-	sent_log->_payload_type			  = rtp_packet->PayloadType();
-	sent_log->_origin_sequence_number = origin_sequence_number;
-	sent_log->_timestamp			  = rtp_packet->Timestamp();
-	sent_log->_marker				  = rtp_packet->Marker();
-	sent_log->_ssrc					  = rtp_packet->Ssrc();
+	RtpSentLog sent_log;
+	sent_log._valid					 = true;
+	sent_log._sequence_number		 = rtp_packet->SequenceNumber();
+	sent_log._wide_sequence_number	 = wide_sequence_number;
+	sent_log._track_id				 = rtp_packet->GetTrackId();
+	sent_log._payload_type			 = rtp_packet->PayloadType();
+	sent_log._origin_sequence_number = origin_sequence_number;
+	sent_log._timestamp				 = rtp_packet->Timestamp();
+	sent_log._marker				 = rtp_packet->Marker();
+	sent_log._ssrc					 = rtp_packet->Ssrc();
 
-	sent_log->_sent_bytes			  = rtp_packet->GetDataLength();
-	sent_log->_sent_time			  = std::chrono::system_clock::now();
+	sent_log._sent_bytes			 = rtp_packet->GetDataLength();
+	sent_log._sent_time				 = std::chrono::system_clock::now();
 
-	auto video_rtp_key				  = sent_log->_sequence_number % MAX_RTP_RECORDS;
-	auto wide_rtp_key				  = sent_log->_wide_sequence_number % MAX_RTP_RECORDS;
-
-	std::lock_guard<std::shared_mutex> lock(_rtp_record_map_lock);
+	std::lock_guard lock_guard(_rtp_sent_log_lock);
 
 	if (rtp_packet->IsVideoPacket())
 	{
-		_video_rtp_sent_record_map[video_rtp_key] = sent_log;
+		_video_rtp_sent_log_ring[sent_log._sequence_number & (RTC_SENT_LOG_SIZE - 1)] = sent_log;
 	}
-	_wide_rtp_sent_record_map[wide_rtp_key] = sent_log;
+	_wide_rtp_sent_log_ring[wide_sequence_number & (RTC_SENT_LOG_SIZE - 1)] = sent_log;
 
 	return true;
 }
 
-std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByVideoSeqNo(uint16_t sequence_number)
+std::optional<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByVideoSeqNo(uint16_t sequence_number)
 {
-	std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
+	std::lock_guard lock_guard(_rtp_sent_log_lock);
 
-	auto key = sequence_number % MAX_RTP_RECORDS;
-	auto it	 = _video_rtp_sent_record_map.find(key);
-	if (it == _video_rtp_sent_record_map.end())
+	const auto &sent_log = _video_rtp_sent_log_ring[sequence_number & (RTC_SENT_LOG_SIZE - 1)];
+	if ((sent_log._valid == false) || (sent_log._sequence_number != sequence_number))
 	{
-		return nullptr;
+		return std::nullopt;
 	}
 
-	return it->second;
+	return sent_log;
 }
 
 // Get RTP Sent Log from RTP History
-std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number)
+std::optional<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number)
 {
-	std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
+	std::lock_guard lock_guard(_rtp_sent_log_lock);
 
-	auto key = wide_sequence_number % MAX_RTP_RECORDS;
-	auto it	 = _wide_rtp_sent_record_map.find(key);
-	if (it == _wide_rtp_sent_record_map.end())
+	const auto &sent_log = _wide_rtp_sent_log_ring[wide_sequence_number & (RTC_SENT_LOG_SIZE - 1)];
+	if ((sent_log._valid == false) || (sent_log._wide_sequence_number != wide_sequence_number))
 	{
-		return nullptr;
+		return std::nullopt;
 	}
 
-	return it->second;
+	return sent_log;
 }
 
 void RtcSession::OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
@@ -724,28 +875,39 @@ bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
+	static auto nack_service_time_histogram = mon::HistogramRegistry::GetInstance()->Get(
+		"ome_webrtc_nack_service_time_microseconds",
+		"Time taken to retransmit the packets requested by a NACK");
+
+	auto start_time = std::chrono::steady_clock::now();
+
 	// Retransmission
 	for (size_t i = 0; i < nack->GetLostIdCount(); i++)
 	{
 		auto seq_no	  = nack->GetLostId(i);
 		auto sent_log = TraceRtpSentByVideoSeqNo(seq_no);
-		if (sent_log == nullptr)
+		if (sent_log.has_value() == false)
 		{
 			continue;
 		}
 
 		logtd("RTX requested(%d) - TrackID(%u) PayloadType(%d) OriginSeqNo(%u)", seq_no, sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
 
+		// A new packet is built for each request, so it can be modified without copying
 		auto rtx_packet = stream->GetRtxRtpPacket(sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
 		if (rtx_packet != nullptr)
 		{
-			auto copy_rtx_packet = std::make_shared<RtxRtpPacket>(*rtx_packet);
-			copy_rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
-			copy_rtx_packet->SetOriginalSequenceNumber(sent_log->_sequence_number);
-			return _rtp_rtcp->SendRtpPacket(copy_rtx_packet);
+			rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
+			rtx_packet->SetOriginalSequenceNumber(sent_log->_sequence_number);
+			// The timestamp may have been rebased when the packet was sent from the GOP cache
+			rtx_packet->SetTimestamp(sent_log->_timestamp);
+
+			_rtp_rtcp->SendRtpPacket(rtx_packet);
 		}
 	}
 
+	nack_service_time_histogram->Observe(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count());
+
 	return true;
 }
 
@@ -759,76 +921,69 @@ bool RtcSession::ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
-	uint64_t sent_bytes	  = 0;
-	int64_t sent_duration = 0;
-
-	// For debug
-	// logtd("TransportCC - SenderSsrc(%u) MediaSsrc(%u) PacketStatusCount(%u)", transport_cc->GetSenderSsrc(), transport_cc->GetMediaSsrc(), transport_cc->GetPacketStatusCount());
-
-	// for (size_t i = 0; i < transport_cc->GetPacketStatusCount(); i++)
-	// {
-	// 	auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-	// 	auto sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-	// 	if (sent_log == nullptr)
-	// 	{
-	// 		logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-	// 		continue;
-	// 	}
-
-	// 	logtd("%s", sent_log->ToString().CStr());
-	// }
+	// The arrival times are in the clock of the receiver, only their differences are used.
+	// The reference time is in multiples of 64 ms, and the received deltas are in 250 us.
+	int64_t arrival_time_us = static_cast<int64_t>(transport_cc->GetReferenceTime()) * 64000;
 
-	// return true;
+	std::vector<SendSideBandwidthEstimator::PacketResult> packet_result_list;
+	packet_result_list.reserve(transport_cc->GetPacketStatusCount());
 
-	for (size_t i = 1; i < transport_cc->GetPacketStatusCount(); i++)
+	for (size_t i = 0; i < transport_cc->GetPacketStatusCount(); i++)
 	{
 		auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-		auto sent_log	   = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-		if (sent_log == nullptr)
+		if (packet_status == nullptr)
 		{
-			logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
 			continue;
 		}
-		auto prev_sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number - 1);
-		if (prev_sent_log == nullptr)
+
+		if (packet_status->_received)
+		{
+			arrival_time_us += static_cast<int64_t>(packet_status->_received_delta) * 250;
+		}
+
+		auto sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
+		// The record may have been overwritten by a newer packet
+		if (sent_log.has_value() == false)
 		{
-			logtd("TransportCC - No prev sent log found for seqno(%u)", packet_status->_wide_sequence_number - 1);
+			logtd("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
 			continue;
 		}
 
-		// Calc delta of sent_log and prev_sent_log
-		int32_t sent_delta_time = (std::chrono::duration_cast<std::chrono::microseconds>(sent_log->_sent_time - prev_sent_log->_sent_time).count()) / 250;
+		SendSideBandwidthEstimator::PacketResult packet_result;
+		packet_result.send_time_us = std::chrono::duration_cast<std::chrono::microseconds>(sent_log->_sent_time.time_since_epoch()).count();
+		packet_result.size = sent_log->_sent_bytes;
 
-		auto duration			= packet_status->_received_delta - sent_delta_time;
-		if (duration <= 0)
+		if (packet_status->_received)
 		{
-			//duration = 1;
+			packet_result.arrival_time_us = arrival_time_us;
 		}
 
-		sent_bytes += sent_log->_sent_bytes;
-		sent_duration += duration;
-
-		logtd("WideSeqNo(%u) Refer(%u) RecvDelta(%u) SentDelta(%u) SentBytes(%u) Duration(%d)", packet_status->_wide_sequence_number, transport_cc->GetReferenceTime(), packet_status->_received_delta, sent_delta_time, sent_log->_sent_bytes, duration);
+		packet_result_list.push_back(packet_result);
 	}
 
-	if (sent_bytes > 0)
+	if (packet_result_list.empty())
 	{
-		double sent_seconds = static_cast<double>(sent_duration) / 4000.0;
+		return true;
+	}
 
-		_total_sent_seconds += sent_seconds;
-		_total_sent_bytes += sent_bytes;
-		_estimated_bitrates = static_cast<double>((_total_sent_bytes * 8)) / _total_sent_seconds;
+	auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
-		if (_bitrate_estimate_watch.IsElapsed(1000) == true)
-		{
-			_bitrate_estimate_watch.Update();
-			ChangeRenditionIfNeeded();
+	_bandwidth_estimator.OnTransportFeedback(packet_result_list, now_us);
+
+	_previous_estimated_bitrate = _estimated_bitrates;
+	_estimated_bitrates = _bandwidth_estimator.GetTargetBitrate();
 
-			logtd("Estimated Bandwidth(%f) TotalSentBytes(%u) TotalSentSeconds(%f)", static_cast<double>(_total_sent_bytes * 8) / _total_sent_seconds, _total_sent_bytes, _total_sent_seconds);
+	_pacer->SetPacingBitrate(_bandwidth_estimator.GetTargetBitrate());
 
-			_total_sent_seconds = 0;
-			_total_sent_bytes	= 0;
-		}
+	// Switch to a lower rendition sooner on the overuse, so the keyframes of the current rendition don't keep being lost
+	auto overusing = (_bandwidth_estimator.GetBandwidthUsage() == SendSideBandwidthEstimator::BandwidthUsage::Overusing);
+
+	if (_bitrate_estimate_watch.IsElapsed(overusing ? AUTO_ABR_OVERUSE_CHECK_INTERVAL_MS : AUTO_ABR_CHECK_INTERVAL_MS) == true)
+	{
+		_bitrate_estimate_watch.Update();
+		ChangeRenditionIfNeeded();
+
+		logtd("Estimated Bandwidth - %s", _bandwidth_estimator.ToString().CStr());
 	}
 
 	return true;
@@ -840,10 +995,18 @@ bool RtcSession::ProcessRemb(const std::shared_ptr<RtcpInfo> &rtcp_info)
 
 	logtd("REMB Estimated Bandwidth(%lld)", remb->GetBitrateBps());
 
+	// The estimate from the transport-cc feedback is preferred if both are negotiated
+	if (_bandwidth_estimator.HasEstimate())
+	{
+		return true;
+	}
+
 	_previous_estimated_bitrate = _estimated_bitrates;
 	_estimated_bitrates			= remb->GetBitrateBps();
 
-	if (_bitrate_estimate_watch.IsElapsed(1000) == true)
+	_pacer->SetPacingBitrate(remb->GetBitrateBps());
+
+	if (_bitrate_estimate_watch.IsElapsed(AUTO_ABR_CHECK_INTERVAL_MS) == true)
 	{
 		_bitrate_estimate_watch.Update();
 		ChangeRenditionIfNeeded();
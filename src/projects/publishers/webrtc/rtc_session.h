@@ -10,6 +10,8 @@
 #include <modules/http/server/web_socket/web_socket_session.h>
 #include <monitoring/monitoring.h>
 
+#include <array>
+#include <optional>
 #include <unordered_set>
 
 #include "base/info/media_track.h"
@@ -18,9 +20,14 @@
 #include "modules/ice/ice_port.h"
 #include "modules/rtp_rtcp/rtp_packetizer_interface.h"
 #include "modules/rtp_rtcp/rtp_rtcp.h"
+#include "modules/rtp_rtcp/send_side_bandwidth_estimator.h"
 #include "modules/sdp/session_description.h"
+#include "rtc_pacer.h"
 #include "rtc_playlist.h"
 
+// The number of the sent RTP packets kept for NACK and transport-cc (must be a power of two)
+#define RTC_SENT_LOG_SIZE 2048
+
 /*	Node Connection
  * [  RTP_RTCP ]
  * [SRTP] [SCTP]				
@@ -106,6 +113,17 @@ private:
 
 	uint8_t GetOriginPayloadTypeFromRedRtpPacket(const std::shared_ptr<const RedRtpPacket> &red_rtp_packet);
 
+	// Copies the packet of the stream, and sets the sequence number of this session
+	RtcPacer::Packet MakeSessionPacket(const std::shared_ptr<const RtpPacket> &session_packet, std::optional<uint32_t> rebased_timestamp = std::nullopt);
+	// Called by the pacer when the packets are released.
+	// The transport-wide sequence number and the send time are set here, so the feedback reflects the time actually sent.
+	void SendPacedPackets(const std::vector<RtcPacer::Packet> &packet_list);
+
+	// Send the cached GOP of the current rendition so that the player can start without waiting for a keyframe
+	void SendGopCache();
+	// Returns true if the packet has already been sent by SendGopCache()
+	bool IsSentByGopCache(const std::shared_ptr<const RtpPacket> &rtp_packet);
+
 	void ChangeRendition();
 
 	bool SendPlaylistInfo(const std::shared_ptr<const RtcPlaylist> &playlist) const;
@@ -144,15 +162,27 @@ private:
 	std::shared_ptr<const RtcRendition> _next_rendition	   = nullptr;
 	std::shared_mutex _change_rendition_lock;
 
+	// GOP cache
+	bool _gop_cache_sent = false;
+	uint32_t _gop_cache_track_id = 0;
+	uint8_t _gop_cache_payload_type = 0;
+	std::optional<uint16_t> _gop_cache_last_sequence_number;
+
 	uint16_t _video_rtp_sequence_number = 0;
 	uint16_t _audio_rtp_sequence_number = 0;
 	uint16_t _wide_sequence_number		= 0;
 
+	std::shared_ptr<mon::StreamMetricsHandle> _metrics_handle;
+
 	ov::StopWatch _abr_test_watch;
 	bool _changed = false;
 
+	// Copied by value, so it can be read while the pacer thread overwrites the slot
 	struct RtpSentLog
 	{
+		// False if nothing has been recorded in the slot yet
+		bool _valid						 = false;
+
 		uint16_t _wide_sequence_number	 = 0;
 		uint16_t _sequence_number		 = 0;
 
@@ -167,34 +197,37 @@ private:
 		uint32_t _sent_bytes			 = 0;
 		std::chrono::system_clock::time_point _sent_time;
 
-		ov::String ToString()
+		ov::String ToString() const
 		{
 			return ov::String::FormatString("WideSeq(%d) SSRC(%u) Seq(%d) Track(%d) PT(%d) Timestamp(%u) Marker(%s) OriginSeq(%d) SentBytes(%u)",
 											_wide_sequence_number, _ssrc, _sequence_number, _track_id, _payload_type, _timestamp, _marker == true ? "O" : "X", _origin_sequence_number, _sent_bytes);
 		}
 	};
 
+	// Called in the pacer thread
 	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number);
 
-	std::shared_mutex _rtp_record_map_lock;
-	// For NACK
-	// video sequence number % MAX_RTP_RECORDS : RtpSentRecord
-	std::unordered_map<uint16_t, std::shared_ptr<RtpSentLog>> _video_rtp_sent_record_map;
-	// For TRANSPORT-CC
-	// wide sequence number % MAX_RTP_RECORDS : RtpSentRecord
-	std::unordered_map<uint16_t, std::shared_ptr<RtpSentLog>> _wide_rtp_sent_record_map;
+	// Guards the rings below, which are written by the pacer thread and read by the thread that processes the RTCP packets.
+	// It is held only while an entry is copied.
+	std::mutex _rtp_sent_log_lock;
+	// For NACK, indexed by (video sequence number & (RTC_SENT_LOG_SIZE - 1))
+	std::array<RtpSentLog, RTC_SENT_LOG_SIZE> _video_rtp_sent_log_ring;
+	// For TRANSPORT-CC, indexed by (wide sequence number & (RTC_SENT_LOG_SIZE - 1))
+	std::array<RtpSentLog, RTC_SENT_LOG_SIZE> _wide_rtp_sent_log_ring;
 
-	std::shared_ptr<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
-	std::shared_ptr<RtpSentLog> TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number);
+	// Returns std::nullopt if the packet has not been sent, or its slot has been overwritten by a newer packet
+	std::optional<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
+	std::optional<RtpSentLog> TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number);
 
 	bool SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number);
 	bool SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms);
 
 	// For Estimated bitrate
-	double _total_sent_seconds = 0;
-	uint64_t _total_sent_bytes = 0;
 	double _estimated_bitrates = 0;
 	ov::StopWatch _bitrate_estimate_watch;
+	// Only accessed in the thread that processes the RTCP packets
+	SendSideBandwidthEstimator _bandwidth_estimator;
+	std::shared_ptr<RtcPacer> _pacer;
 
 	// Auto switch rendition
 	bool _auto_abr = true;
@@ -11,6 +11,7 @@
 #include <base/info/media_extradata.h>
 #include <modules/bitstream/h264/h264_decoder_configuration_record.h>
 #include <modules/bitstream/nalu/nal_stream_converter.h>
+#include <modules/rtp_rtcp/fec_xor_kernel.h>
 #include <modules/rtp_rtcp/rtp_header_extension/rtp_header_extension_abs_send_time.h>
 #include <modules/rtp_rtcp/rtp_header_extension/rtp_header_extension_framemarking.h>
 #include <modules/rtp_rtcp/rtp_header_extension/rtp_header_extension_playout_delay.h>
@@ -131,12 +132,21 @@ bool RtcStream::Start()
 
 	_rtx_enabled		   = webrtc_config.IsRtxEnabled();
 	_ulpfec_enabled		   = webrtc_config.IsUlpfecEnalbed();
+	_ulpfec_scheme		   = webrtc_config.GetUlpfecProtection().GetScheme();
+	_ulpfec_rate		   = webrtc_config.GetUlpfecProtection().GetRate();
 	_jitter_buffer_enabled = webrtc_config.IsJitterBufferEnabled();
 
 	auto playoutDelay	   = webrtc_config.GetPlayoutDelay(&_playout_delay_enabled);
 	_playout_delay_min	   = playoutDelay.GetMin();
 	_playout_delay_max	   = playoutDelay.GetMax();
 
+	bool gop_cache_enabled = false;
+	auto gop_cache_config  = webrtc_config.GetGopCache(&gop_cache_enabled);
+	if (gop_cache_enabled == true)
+	{
+		EnableGopCache(PublisherType::Webrtc, std::max<int64_t>(gop_cache_config.GetMaxSize(), 0));
+	}
+
 	if (webrtc_config.GetBandwidthEstimationType() == WebRtcBandwidthEstimationType::TransportCc)
 	{
 		_transport_cc_enabled = true;
@@ -232,10 +242,10 @@ bool RtcStream::Start()
 		}
 	}
 
-	logti("WebRTC Stream has been created : %s/%u\nRtx(%s) Ulpfec(%s) JitterBuffer(%s) PlayoutDelay(%s min:%d max: %d)",
+	logti("WebRTC Stream has been created : %s/%u\nRtx(%s) Ulpfec(%s rate:%d xor:%s) JitterBuffer(%s) PlayoutDelay(%s min:%d max: %d)",
 		  GetName().CStr(), GetId(),
 		  ov::Converter::ToString(_rtx_enabled).CStr(),
-		  ov::Converter::ToString(_ulpfec_enabled).CStr(),
+		  ov::Converter::ToString(_ulpfec_enabled).CStr(), _ulpfec_rate, FecXorKernel::GetName(),
 		  ov::Converter::ToString(_jitter_buffer_enabled).CStr(),
 		  ov::Converter::ToString(_playout_delay_enabled).CStr(),
 		  _playout_delay_min, _playout_delay_max);
@@ -670,8 +680,18 @@ std::shared_ptr<PayloadAttr> RtcStream::MakeRtxPayloadAttr(const std::shared_ptr
 
 bool RtcStream::OnRtpPacketized(std::shared_ptr<RtpPacket> packet)
 {
-	auto stream_packet = std::make_any<std::shared_ptr<RtpPacket>>(packet);
-	BroadcastPacket(stream_packet);
+	// Broadcast when the frame is packetized
+	_packetized_list.push_back(packet);
+
+	// FEC packets are not cached because they protect the original timestamps,
+	// which are rebased when the cached packets are sent to a new session
+	if (packet->IsVideoPacket() && (packet->IsUlpfec() == false))
+	{
+		CacheGopPacket(GetGopCacheKey(packet->GetTrackId(), packet->PayloadType()),
+					   packet->IsKeyframe() && packet->IsFirstPacketOfFrame(),
+					   packet->GetDataLength(),
+					   std::make_any<std::shared_ptr<RtpPacket>>(packet));
+	}
 
 	if (_rtx_enabled == true)
 	{
@@ -681,6 +701,12 @@ bool RtcStream::OnRtpPacketized(std::shared_ptr<RtpPacket> packet)
 		{
 			history->StoreRtpPacket(packet);
 		}
+
+		// Report the memory usage once per GOP
+		if (packet->IsKeyframe() && packet->IsFirstPacketOfFrame())
+		{
+			UpdateRtxHistoryMetrics();
+		}
 	}
 
 	return true;
@@ -784,6 +810,8 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 						  data->GetLength(),
 						  fragmentation,
 						  &rtp_video_header);
+
+	BroadcastPacketizedList();
 }
 
 void RtcStream::PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
@@ -815,6 +843,21 @@ void RtcStream::PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_pa
 						  data->GetLength(),
 						  fragmentation,
 						  nullptr);
+
+	BroadcastPacketizedList();
+}
+
+void RtcStream::BroadcastPacketizedList()
+{
+	if (_packetized_list.empty())
+	{
+		return;
+	}
+
+	auto packet_list = std::make_shared<const RtpPacketList>(std::move(_packetized_list));
+	_packetized_list.clear();
+
+	BroadcastPacket(std::make_any<std::shared_ptr<const RtpPacketList>>(packet_list));
 }
 
 uint16_t RtcStream::AllocateVP8PictureID()
@@ -911,6 +954,7 @@ void RtcStream::AddPacketizer(const std::shared_ptr<const MediaTrack> &track)
 	if (_ulpfec_enabled == true)
 	{
 		packetizer->SetUlpfec(static_cast<uint8_t>(FixedRtcPayloadType::RED_PAYLOAD_TYPE), static_cast<uint8_t>(FixedRtcPayloadType::ULPFEC_PAYLOAD_TYPE));
+		packetizer->SetUlpfecProtection(_ulpfec_scheme, _ulpfec_rate);
 	}
 
 	// Experimental : PlayoutDelay extension
@@ -934,9 +978,9 @@ std::shared_ptr<RtpPacketizer> RtcStream::GetPacketizer(uint32_t id)
 	return _packetizers[id];
 }
 
-ov::String RtcStream::GetRtpHistoryKey(uint32_t track_id, uint8_t payload_type)
+uint64_t RtcStream::GetRtpHistoryKey(uint32_t track_id, uint8_t payload_type)
 {
-	return ov::String::FormatString("%u:%u", track_id, payload_type);
+	return (static_cast<uint64_t>(track_id) << 8) | payload_type;
 }
 
 void RtcStream::AddRtpHistory(const std::shared_ptr<const MediaTrack> &track)
@@ -964,14 +1008,55 @@ void RtcStream::AddRtpHistory(const std::shared_ptr<const MediaTrack> &track)
 
 std::shared_ptr<RtpHistory> RtcStream::GetHistory(uint32_t track_id, uint8_t origin_payload_type)
 {
-	auto key = GetRtpHistoryKey(track_id, origin_payload_type);
+	auto it = _rtp_history_map.find(GetRtpHistoryKey(track_id, origin_payload_type));
 
-	if (_rtp_history_map.find(key) == _rtp_history_map.end())
+	if (it == _rtp_history_map.end())
 	{
 		return nullptr;
 	}
 
-	return _rtp_history_map[key];
+	return it->second;
+}
+
+void RtcStream::UpdateRtxHistoryMetrics()
+{
+	auto stream_metrics = StreamMetrics(*this);
+	if (stream_metrics == nullptr)
+	{
+		return;
+	}
+
+	uint64_t size = 0;
+
+	for (const auto &[key, history] : _rtp_history_map)
+	{
+		size += history->GetStoredBytes();
+	}
+
+	stream_metrics->SetRtxHistorySize(size);
+}
+
+uint64_t RtcStream::GetGopCacheKey(uint32_t track_id, uint8_t payload_type)
+{
+	return (static_cast<uint64_t>(track_id) << 8) | payload_type;
+}
+
+std::vector<std::shared_ptr<RtpPacket>> RtcStream::GetGopCachePackets(uint32_t track_id, uint8_t payload_type) const
+{
+	std::vector<std::shared_ptr<RtpPacket>> packet_list;
+
+	auto gop_cache = GetGopCache();
+	if (gop_cache == nullptr)
+	{
+		return packet_list;
+	}
+
+	for (const auto &packet : gop_cache->GetPackets(GetGopCacheKey(track_id, payload_type)))
+	{
+		packet_list.push_back(std::any_cast<std::shared_ptr<RtpPacket>>(packet));
+	}
+
+	return packet_list;
 }
 
 std::shared_ptr<RtxRtpPacket> RtcStream::GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number)
@@ -16,6 +16,7 @@
 #include <modules/jitter_buffer/jitter_buffer.h>
 #include <modules/rtp_rtcp/rtp_history.h>
 #include <modules/rtp_rtcp/rtp_rtcp_defines.h>
+#include <modules/rtp_rtcp/ulpfec_generator.h>
 #include <modules/sdp/session_description.h>
 
 #include "rtc_playlist.h"
@@ -24,6 +25,9 @@
 class RtcStream final : public pub::Stream, public RtpPacketizerInterface
 {
 public:
+	// The packets of a frame, which are delivered to the sessions at once
+	using RtpPacketList = std::vector<std::shared_ptr<RtpPacket>>;
+
 	static std::shared_ptr<RtcStream> Create(const std::shared_ptr<pub::Application> application,
 											 const info::Stream &info,
 											 uint32_t worker_count);
@@ -48,6 +52,9 @@ public:
 
 	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number);
 
+	// RTP packets from the last keyframe to now (empty if the GOP cache is disabled)
+	std::vector<std::shared_ptr<RtpPacket>> GetGopCachePackets(uint32_t track_id, uint8_t payload_type) const;
+
 	// RtpRtcpPacketizerInterface Implementation
 	bool OnRtpPacketized(std::shared_ptr<RtpPacket> packet) override;
 
@@ -80,10 +87,16 @@ private:
 
 	void AddPacketizer(const std::shared_ptr<const MediaTrack> &track);
 	std::shared_ptr<RtpPacketizer> GetPacketizer(uint32_t track_id);
+	// Delivers the packets collected by OnRtpPacketized() to the sessions
+	void BroadcastPacketizedList();
 
-	ov::String GetRtpHistoryKey(uint32_t track_id, uint8_t payload_type);
+	static uint64_t GetGopCacheKey(uint32_t track_id, uint8_t payload_type);
+
+	static uint64_t GetRtpHistoryKey(uint32_t track_id, uint8_t payload_type);
 	void AddRtpHistory(const std::shared_ptr<const MediaTrack> &track);
 	std::shared_ptr<RtpHistory> GetHistory(uint32_t track_id, uint8_t origin_payload_type);
+	// Reports the memory used by the RTX histories to the stream metrics
+	void UpdateRtxHistoryMetrics();
 
 	uint32_t GetSsrc(cmn::MediaType media_type);
 
@@ -100,8 +113,11 @@ private:
 	std::shared_mutex _packetizers_lock;
 	std::map<uint32_t, std::shared_ptr<RtpPacketizer>> _packetizers;
 
-	// RtpHistoryKey string, RtpHistory
-	std::map<ov::String, std::shared_ptr<RtpHistory>> _rtp_history_map;
+	// The packets of the frame being packetized, so that the sessions can protect them with SRTP in a batch
+	RtpPacketList _packetized_list;
+
+	// RtpHistoryKey, RtpHistory
+	std::unordered_map<uint64_t, std::shared_ptr<RtpHistory>> _rtp_history_map;
 
 	uint32_t _video_ssrc		= 0;
 	uint32_t _video_rtx_ssrc	= 0;
@@ -109,6 +125,8 @@ private:
 
 	bool _rtx_enabled			= true;
 	bool _ulpfec_enabled		= true;
+	WebRtcFecScheme _ulpfec_scheme = WebRtcFecScheme::Consecutive;
+	int _ulpfec_rate			= ULPFEC_DEFAULT_PROTECTION_RATE;
 	bool _jitter_buffer_enabled = false;
 	bool _playout_delay_enabled = false;
 	int _playout_delay_min		= 0;
@@ -345,12 +345,12 @@ std::shared_ptr<const SessionDescription> WebRtcPublisher::OnRequestOffer(const
 		ice_candidates->insert(ice_candidates->end(), candidates.cbegin(), candidates.cend());
 	}
 
-	// Copy SDP
+	// Copy SDP - The SDP of the stream is used as a template, and only the per-session lines are patched
 	auto session_description = std::make_shared<SessionDescription>(*file_sdp);
 
 	session_description->SetOrigin("OvenMediaEngine", ov::Unique::GenerateUint32(), 2, "IN", 4, "127.0.0.1");
 	session_description->SetIceUfrag(_ice_port->GenerateUfrag());
-	session_description->Update();
+	session_description->UpdateOriginAndIce();
 
 	// Passed AccessControl
 	ws_session->AddUserData("authorized", true);
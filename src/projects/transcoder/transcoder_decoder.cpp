@@ -375,6 +375,8 @@ void TranscodeDecoder::Stop()
 
 void TranscodeDecoder::SendBuffer(std::shared_ptr<const MediaPacket> packet)
 {
+	_latency_tracker.OnInput(packet->GetPts(), GetTimebase());
+
 	_input_buffer.Enqueue(std::move(packet));
 }
 
@@ -417,6 +419,8 @@ void TranscodeDecoder::Complete(TranscodeResult result, std::shared_ptr<MediaFra
 	if (frame != nullptr)
 	{
 		frame->SetTrackId(_decoder_id);
+
+		_latency_tracker.OnOutput(frame->GetPts(), GetTimebase());
 	}
 
 	_complete_handler(result, _decoder_id, std::move(frame));
@@ -11,6 +11,7 @@
 #include "base/info/stream.h"
 #include "base/info/codec.h"
 #include "codec/codec_base.h"
+#include "transcoder_latency_tracker.h"
 
 class TranscodeDecoder : public TranscodeBase<MediaPacket, MediaFrame>
 {
@@ -56,4 +57,6 @@ protected:
 	AVCodecParserContext *_parser = nullptr;
 	AVPacket *_pkt;
 	AVFrame *_frame;
+
+	TranscodeLatencyTracker _latency_tracker{"decode"};
 };
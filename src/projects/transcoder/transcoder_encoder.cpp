@@ -404,7 +404,9 @@ std::shared_ptr<MediaTrack> &TranscodeEncoder::GetRefTrack()
 void TranscodeEncoder::SendBuffer(std::shared_ptr<const MediaFrame> frame)
 {
 	// logte("%lld, msid:%u", frame->GetPts(), frame->GetMsid());
-		
+
+	_latency_tracker.OnInput(frame->GetPts(), GetTimebase());
+
 	if (_input_buffer.IsExceedWaitEnable() == true)
 	{
 		_input_buffer.Enqueue(std::move(frame), false, 1000);
@@ -450,6 +452,11 @@ void TranscodeEncoder::Complete(TranscodeResult result, std::shared_ptr<MediaPac
 		return;
 	}
 
+	if (packet != nullptr)
+	{
+		_latency_tracker.OnOutput(packet->GetPts(), GetTimebase());
+	}
+
 	_complete_handler(result, _encoder_id, std::move(packet));
 }
 
@@ -11,6 +11,7 @@
 #include "base/info/stream.h"
 #include "base/info/codec.h"
 #include "codec/codec_base.h"
+#include "transcoder_latency_tracker.h"
 
 class TranscodeEncoder : public TranscodeBase<MediaFrame, MediaPacket>
 {
@@ -77,4 +78,6 @@ protected:
 	AVCodecContext *_codec_context = nullptr;
 	AVPacket *_packet = nullptr;
 	AVFrame *_frame = nullptr;
+
+	TranscodeLatencyTracker _latency_tracker{"encode"};
 };
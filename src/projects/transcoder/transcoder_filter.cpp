@@ -157,6 +157,8 @@ bool TranscodeFilter::SendBuffer(std::shared_ptr<MediaFrame> buffer)
 		return false;
 	}
 
+	_latency_tracker.OnInput(buffer->GetPts(), GetInputTrack()->GetTimeBase());
+
 	return _internal->SendBuffer(std::move(buffer));
 }
 
@@ -256,6 +258,8 @@ void TranscodeFilter::OnComplete(TranscodeResult result, std::shared_ptr<MediaFr
 	// This is used when encoding with hardware acceleration.
 	if (frame)
 	{
+		_latency_tracker.OnOutput(frame->GetPts(), GetOutputTrack()->GetTimeBase());
+
 		frame->SetCodecModuleId(GetOutputTrack()->GetCodecModuleId());
 		frame->SetCodecDeviceId(GetOutputTrack()->GetCodecDeviceId());
 	}
@@ -8,6 +8,7 @@
 #include "base/info/stream.h"
 #include "filter/filter_base.h"
 #include "transcoder_context.h"
+#include "transcoder_latency_tracker.h"
 
 enum class TranscodeFilterType : int8_t
 {
@@ -72,4 +73,6 @@ private:
 
 	std::shared_mutex _mutex;
 	std::shared_ptr<FilterBase> _internal;
+
+	TranscodeLatencyTracker _latency_tracker{"filter"};
 };
@@ -0,0 +1,72 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_latency_tracker.h"
+
+#include <monitoring/histogram_registry.h>
+
+#include <cmath>
+
+#include "transcoder_private.h"
+
+namespace
+{
+	int64_t GetNowUs()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+}  // namespace
+
+TranscodeLatencyTracker::TranscodeLatencyTracker(const char *stage)
+{
+	_histogram = mon::HistogramRegistry::GetInstance()->Get(
+		"ome_transcode_stage_latency_microseconds",
+		"Time from the input to the output of the same timestamp in each transcoding stage",
+		ov::String::FormatString("stage=\"%s\"", stage));
+}
+
+int64_t TranscodeLatencyTracker::ToMicroseconds(int64_t pts, const cmn::Timebase &timebase)
+{
+	return std::llround(static_cast<double>(pts) * timebase.GetExpr() * 1000000.0);
+}
+
+void TranscodeLatencyTracker::OnInput(int64_t pts, const cmn::Timebase &timebase)
+{
+	auto &slot = _slots[_next_slot_index];
+	_next_slot_index = (_next_slot_index + 1) % _slots.size();
+
+	// The oldest input is overwritten if its output is not produced (e.g. dropped) until now.
+	// Empty the key first, so that OnOutput() doesn't pair the new time with the old key.
+	slot.key.store(EmptyKey, std::memory_order_relaxed);
+	slot.received_time_us.store(GetNowUs(), std::memory_order_relaxed);
+	slot.key.store(ToMicroseconds(pts, timebase), std::memory_order_release);
+}
+
+void TranscodeLatencyTracker::OnOutput(int64_t pts, const cmn::Timebase &timebase)
+{
+	auto pts_us = ToMicroseconds(pts, timebase);
+
+	for (auto &slot : _slots)
+	{
+		auto key = slot.key.load(std::memory_order_acquire);
+
+		if ((key == EmptyKey) || (std::abs(key - pts_us) > TRANSCODE_LATENCY_TRACKER_TOLERANCE_US))
+		{
+			continue;
+		}
+
+		auto received_time_us = slot.received_time_us.load(std::memory_order_relaxed);
+
+		// Take the slot, so that an output of the same timestamp is not measured twice
+		if (slot.key.compare_exchange_strong(key, EmptyKey, std::memory_order_relaxed))
+		{
+			_histogram->Observe(std::max<int64_t>(GetNowUs() - received_time_us, 0));
+		}
+
+		return;
+	}
+}
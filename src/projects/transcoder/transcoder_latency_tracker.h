@@ -0,0 +1,52 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/mediarouter/media_type.h>
+#include <base/ovlibrary/histogram.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <array>
+
+// The number of inputs that can be in flight in a stage
+#define TRANSCODE_LATENCY_TRACKER_SLOT_COUNT 64
+// An output matches an input if their timestamps differ less than this (the timebases may differ)
+#define TRANSCODE_LATENCY_TRACKER_TOLERANCE_US 1000
+
+// Measures the time that a stage (decoder/filter/encoder) takes from receiving an input to producing
+// the output of the same timestamp, and observes it in the "ome_transcode_stage_latency_microseconds" histogram.
+//
+// The outputs that don't match any input (e.g. audio frames split by the resampler) are not measured.
+// OnInput() must be called from a single thread, and it doesn't take any lock.
+class TranscodeLatencyTracker
+{
+public:
+	// stage: "decode", "filter" or "encode"
+	explicit TranscodeLatencyTracker(const char *stage);
+
+	void OnInput(int64_t pts, const cmn::Timebase &timebase);
+	void OnOutput(int64_t pts, const cmn::Timebase &timebase);
+
+private:
+	static constexpr int64_t EmptyKey = INT64_MIN;
+
+	struct Slot
+	{
+		// The timestamp of the input in microseconds
+		std::atomic<int64_t> key{EmptyKey};
+		// steady_clock in microseconds when the input was received
+		std::atomic<int64_t> received_time_us{0};
+	};
+
+	static int64_t ToMicroseconds(int64_t pts, const cmn::Timebase &timebase);
+
+	std::array<Slot, TRANSCODE_LATENCY_TRACKER_SLOT_COUNT> _slots;
+	size_t _next_slot_index = 0;
+
+	std::shared_ptr<ov::Histogram> _histogram;
+};